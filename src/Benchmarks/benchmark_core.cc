@@ -0,0 +1,156 @@
+#include <Benchmarks/benchmarks_common.hh>
+
+using namespace Benchmark;
+
+/*
+ * Build the grid face by face with add_face() and in one go with add_faces()
+ */
+OPENMESH_BENCHMARK(add_face) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    Mesh grid;
+    make_grid(grid, sizes[s]);
+
+    // face list of the grid
+    std::vector<Mesh::VertexHandle> vertices;
+    std::vector<unsigned int>       face_sizes;
+    for (Mesh::FaceIter f_it = grid.faces_begin(); f_it != grid.faces_end(); ++f_it) {
+      for (Mesh::FaceVertexIter fv_it = grid.fv_iter(*f_it); fv_it.is_valid(); ++fv_it)
+        vertices.push_back(*fv_it);
+      face_sizes.push_back(3);
+    }
+
+    BestTime single, bulk;
+    for (int r = 0; r < settings().repetitions; ++r) {
+      Mesh mesh;
+      for (size_t i = 0; i < grid.n_vertices(); ++i)
+        mesh.add_vertex(grid.point(Mesh::VertexHandle(int(i))));
+
+      single.start();
+      for (size_t f = 0; f < face_sizes.size(); ++f)
+        mesh.add_face(&vertices[3*f], 3);
+      single.stop();
+
+      mesh.clean();
+      for (size_t i = 0; i < grid.n_vertices(); ++i)
+        mesh.add_vertex(grid.point(Mesh::VertexHandle(int(i))));
+
+      bulk.start();
+      mesh.add_faces(&vertices[0], &face_sizes[0], face_sizes.size());
+      bulk.stop();
+    }
+
+    _reporter.add("add_face", "add_face",  grid.n_vertices(), single.seconds());
+    _reporter.add("add_face", "add_faces", grid.n_vertices(), bulk.seconds());
+  }
+}
+
+/*
+ * Traverse all one-rings with the vertex-vertex, vertex-face and
+ * face-vertex circulators
+ */
+OPENMESH_BENCHMARK(circulators) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    Mesh mesh;
+    make_grid(mesh, sizes[s]);
+
+    BestTime vv, vf, fv;
+    int sum = 0;
+    for (int r = 0; r < settings().repetitions; ++r) {
+      vv.start();
+      for (Mesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it)
+        for (Mesh::VertexVertexIter vv_it = mesh.vv_iter(*v_it); vv_it.is_valid(); ++vv_it)
+          sum += (*vv_it).idx();
+      vv.stop();
+
+      vf.start();
+      for (Mesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end(); ++v_it)
+        for (Mesh::VertexFaceIter vf_it = mesh.vf_iter(*v_it); vf_it.is_valid(); ++vf_it)
+          sum += (*vf_it).idx();
+      vf.stop();
+
+      fv.start();
+      for (Mesh::FaceIter f_it = mesh.faces_begin(); f_it != mesh.faces_end(); ++f_it)
+        for (Mesh::FaceVertexIter fv_it = mesh.fv_iter(*f_it); fv_it.is_valid(); ++fv_it)
+          sum += (*fv_it).idx();
+      fv.stop();
+    }
+
+    // keep the compiler from removing the loops
+    if (sum == 42)
+      std::clog << sum << std::endl;
+
+    _reporter.add("circulators", "vv", mesh.n_vertices(), vv.seconds());
+    _reporter.add("circulators", "vf", mesh.n_vertices(), vf.seconds());
+    _reporter.add("circulators", "fv", mesh.n_vertices(), fv.seconds());
+  }
+}
+
+/*
+ * Face and vertex normals, serial and with all cores
+ */
+OPENMESH_BENCHMARK(update_normals) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    Mesh mesh;
+    make_grid(mesh, sizes[s]);
+    mesh.request_face_normals();
+    mesh.request_vertex_normals();
+
+    BestTime serial, parallel;
+    for (int r = 0; r < settings().repetitions; ++r) {
+      serial.start();
+      mesh.update_normals();
+      serial.stop();
+
+      parallel.start();
+      mesh.update_normals(0);
+      parallel.stop();
+    }
+
+    _reporter.add("update_normals", "serial",   mesh.n_vertices(), serial.seconds());
+    _reporter.add("update_normals", "parallel", mesh.n_vertices(), parallel.seconds());
+  }
+}
+
+/*
+ * Delete every fourth vertex and compact the mesh
+ */
+OPENMESH_BENCHMARK(garbage_collection) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    BestTime swap_timer, ordered_timer;
+    size_t n_vertices = 0;
+
+    for (int r = 0; r < settings().repetitions; ++r) {
+      for (int mode = 0; mode < 2; ++mode) {
+        Mesh mesh;
+        make_grid(mesh, sizes[s]);
+        n_vertices = mesh.n_vertices();
+
+        mesh.request_vertex_status();
+        mesh.request_edge_status();
+        mesh.request_face_status();
+        for (size_t i = 0; i < mesh.n_vertices(); i += 4)
+          mesh.delete_vertex(Mesh::VertexHandle(int(i)));
+
+        std::vector<Mesh::VertexHandle> vh_map;
+        BestTime& timer = (mode == 0) ? swap_timer : ordered_timer;
+        timer.start();
+        if (mode == 0)
+          mesh.garbage_collection();
+        else
+          mesh.garbage_collection(&vh_map, NULL, NULL, true);
+        timer.stop();
+      }
+    }
+
+    _reporter.add("garbage_collection", "delete_every_4th_vertex", n_vertices, swap_timer.seconds());
+    _reporter.add("garbage_collection", "delete_every_4th_vertex_preserve_order", n_vertices, ordered_timer.seconds());
+  }
+}
@@ -0,0 +1,122 @@
+#include <Benchmarks/benchmarks_common.hh>
+#include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Tools/Utils/HeapT.hh>
+#include <OpenMesh/Tools/Utils/IndexedHeapT.hh>
+
+#include <cstdlib>
+
+namespace {
+
+/*
+ * Mimics DecimaterT::HeapInterface: the keys and heap positions are
+ * stored in per vertex arrays.
+ */
+class HeapInterface
+{
+public:
+
+  HeapInterface(std::vector<float>& _keys, std::vector<int>& _pos)
+    : keys_(&_keys), pos_(&_pos)
+  { }
+
+  bool less(OpenMesh::VertexHandle _h0, OpenMesh::VertexHandle _h1)
+  { return (*keys_)[_h0.idx()] < (*keys_)[_h1.idx()]; }
+
+  bool greater(OpenMesh::VertexHandle _h0, OpenMesh::VertexHandle _h1)
+  { return (*keys_)[_h0.idx()] > (*keys_)[_h1.idx()]; }
+
+  float get_key(OpenMesh::VertexHandle _h)
+  { return (*keys_)[_h.idx()]; }
+
+  int get_heap_position(OpenMesh::VertexHandle _h)
+  { return (*pos_)[_h.idx()]; }
+
+  void set_heap_position(OpenMesh::VertexHandle _h, int _pos)
+  { (*pos_)[_h.idx()] = _pos; }
+
+private:
+  std::vector<float>* keys_;
+  std::vector<int>*   pos_;
+};
+
+typedef OpenMesh::Utils::HeapT<OpenMesh::VertexHandle, HeapInterface>        BinaryHeap;
+typedef OpenMesh::Utils::IndexedHeapT<OpenMesh::VertexHandle, HeapInterface> IndexedHeap;
+
+/// Fill the heap with all entries
+void build(BinaryHeap& _heap, const std::vector<OpenMesh::VertexHandle>& _entries)
+{
+  for (size_t i = 0; i < _entries.size(); ++i)
+    _heap.insert(_entries[i]);
+}
+
+void build(IndexedHeap& _heap, const std::vector<OpenMesh::VertexHandle>& _entries)
+{
+  _heap.build(_entries.begin(), _entries.end());
+}
+
+/*
+ * Decimation like access pattern: fill the heap, then repeatedly pop the
+ * front and change the keys of a few other entries.
+ */
+template <class Heap>
+double run_heap(size_t _n, bool _bulk_build)
+{
+  Benchmark::BestTime timer;
+
+  for (int r = 0; r < Benchmark::settings().repetitions; ++r)
+  {
+    srand(1);
+    std::vector<float> keys(_n);
+    std::vector<int>   pos(_n, -1);
+    for (size_t i = 0; i < _n; ++i)
+      keys[i] = float(rand()) / float(RAND_MAX);
+
+    std::vector<OpenMesh::VertexHandle> entries;
+    entries.reserve(_n);
+    for (size_t i = 0; i < _n; ++i)
+      entries.push_back(OpenMesh::VertexHandle(int(i)));
+
+    timer.start();
+
+    Heap heap((HeapInterface(keys, pos)));
+    heap.reserve(_n);
+    if (_bulk_build)
+      build(heap, entries);
+    else
+      for (size_t i = 0; i < _n; ++i)
+        heap.insert(entries[i]);
+
+    while (!heap.empty())
+    {
+      const OpenMesh::VertexHandle front = heap.front();
+      heap.pop_front();
+
+      // update the keys of a few "neighbors"
+      for (int k = 1; k <= 6; ++k)
+      {
+        OpenMesh::VertexHandle vh(int((front.idx() + k * 7919) % _n));
+        if (heap.is_stored(vh))
+        {
+          keys[vh.idx()] += 0.01f * float(k);
+          heap.update(vh);
+        }
+      }
+    }
+
+    timer.stop();
+  }
+
+  return timer.seconds();
+}
+
+}
+
+OPENMESH_BENCHMARK(heap) {
+
+  const size_t max_n = Benchmark::settings().quick ? 100000 : 1000000;
+  for (size_t n = 10000; n <= max_n; n *= 10) {
+    _reporter.add("heap", "HeapT",                n, run_heap<BinaryHeap>(n, false));
+    _reporter.add("heap", "IndexedHeapT",         n, run_heap<IndexedHeap>(n, false));
+    _reporter.add("heap", "IndexedHeapT_build",   n, run_heap<IndexedHeap>(n, true));
+  }
+}
@@ -0,0 +1,71 @@
+#include <Benchmarks/benchmarks_common.hh>
+
+#include <cstdio>
+
+using namespace Benchmark;
+
+namespace {
+
+struct Format
+{
+  const char*                     name;
+  const char*                     extension;
+  OpenMesh::IO::Options::Flag     options;
+};
+
+const Format formats[] = {
+  { "obj",             ".obj", OpenMesh::IO::Options::Default      },
+  { "off",             ".off", OpenMesh::IO::Options::Default      },
+  { "off_binary",      ".off", OpenMesh::IO::Options::Binary       },
+  { "ply",             ".ply", OpenMesh::IO::Options::Default      },
+  { "ply_binary",      ".ply", OpenMesh::IO::Options::Binary       },
+  { "stl",             ".stl", OpenMesh::IO::Options::Default      },
+  { "stl_binary",      ".stl", OpenMesh::IO::Options::Binary       },
+  { "om",              ".om",  OpenMesh::IO::Options::Binary       },
+  { "om_connectivity", ".om",  OpenMesh::IO::Options::Connectivity }
+};
+
+const size_t n_formats = sizeof(formats) / sizeof(formats[0]);
+
+}
+
+/*
+ * Write the grid with every writer and read it back with the matching reader
+ */
+OPENMESH_BENCHMARK(io) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    Mesh mesh;
+    make_grid(mesh, sizes[s]);
+
+    for (size_t f = 0; f < n_formats; ++f) {
+      const std::string filename = std::string("OpenMesh_bench_tmp") + formats[f].extension;
+
+      OpenMesh::IO::Options opt(formats[f].options);
+
+      BestTime write, read;
+      bool ok = true;
+      for (int r = 0; r < settings().repetitions && ok; ++r) {
+        write.start();
+        ok = OpenMesh::IO::write_mesh(mesh, filename, opt);
+        write.stop();
+
+        Mesh result;
+        OpenMesh::IO::Options read_opt = opt;
+        read.start();
+        ok = ok && OpenMesh::IO::read_mesh(result, filename, read_opt);
+        read.stop();
+      }
+      std::remove(filename.c_str());
+
+      if (!ok) {
+        std::cerr << "io: " << formats[f].name << " failed" << std::endl;
+        continue;
+      }
+
+      _reporter.add("io_write", formats[f].name, mesh.n_vertices(), write.seconds());
+      _reporter.add("io_read",  formats[f].name, mesh.n_vertices(), read.seconds());
+    }
+  }
+}
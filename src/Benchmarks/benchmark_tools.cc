@@ -0,0 +1,110 @@
+#include <Benchmarks/benchmarks_common.hh>
+
+#include <OpenMesh/Tools/Decimater/DecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ParallelDecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+
+#include <OpenMesh/Tools/Subdivider/Uniform/Sqrt3T.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/LoopT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/CompositeSqrt3T.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/CompositeLoopT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/Sqrt3InterpolatingSubdividerLabsikGreinerT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/ModifiedButterFlyT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/LongestEdgeT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/CatmullClarkT.hh>
+
+using namespace Benchmark;
+
+namespace {
+
+typedef OpenMesh::TriMesh_ArrayKernelT<OpenMesh::Subdivider::Uniform::CompositeTraits> CompositeMesh;
+
+/// Decimate a grid to 10% of its vertices
+template <class Decimater>
+double run_decimater(int _n)
+{
+  typedef typename OpenMesh::Decimater::ModQuadricT<Mesh>::Handle HModQuadric;
+
+  BestTime timer;
+  for (int r = 0; r < settings().repetitions; ++r) {
+    Mesh mesh;
+    make_grid(mesh, _n);
+
+    timer.start();
+    Decimater decimater(mesh);
+    HModQuadric hModQuadric;
+    decimater.add(hModQuadric);
+    decimater.initialize();
+    decimater.decimate_to(mesh.n_vertices() / 10);
+    mesh.garbage_collection();
+    timer.stop();
+  }
+  return timer.seconds();
+}
+
+/// One step of a uniform subdivision scheme
+template <class MeshT, class Subdivider>
+double run_subdivider(int _n, bool _triangles, Subdivider& _subdivider)
+{
+  BestTime timer;
+  for (int r = 0; r < settings().repetitions; ++r) {
+    MeshT mesh;
+    make_grid(mesh, _n, _triangles);
+
+    timer.start();
+    _subdivider.attach(mesh);
+    _subdivider(1);
+    _subdivider.detach();
+    timer.stop();
+  }
+  return timer.seconds();
+}
+
+}
+
+OPENMESH_BENCHMARK(decimater) {
+
+  const std::vector<int> sizes = grid_sizes();
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    const size_t n_vertices = (sizes[s]+1) * (sizes[s]+1);
+    _reporter.add("decimater", "DecimaterT_ModQuadricT", n_vertices,
+                  run_decimater< OpenMesh::Decimater::DecimaterT<Mesh> >(sizes[s]));
+    _reporter.add("decimater", "ParallelDecimaterT_ModQuadricT", n_vertices,
+                  run_decimater< OpenMesh::Decimater::ParallelDecimaterT<Mesh> >(sizes[s]));
+  }
+}
+
+OPENMESH_BENCHMARK(subdivider) {
+
+  using namespace OpenMesh::Subdivider::Uniform;
+
+  // one step multiplies the size by up to four, skip the largest grid
+  std::vector<int> sizes = grid_sizes();
+  if (sizes.size() > 2)
+    sizes.resize(2);
+
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    const int    n          = sizes[s];
+    const size_t n_vertices = (n+1) * (n+1);
+
+    LoopT<Mesh>                  loop;
+    Sqrt3T<Mesh>                 sqrt3;
+    ModifiedButterflyT<Mesh>     butterfly;
+    InterpolatingSqrt3LGT<Mesh>  sqrt3_lg;
+    LongestEdgeT<Mesh>           longest_edge;
+    CompositeLoopT<CompositeMesh>  composite_loop;
+    CompositeSqrt3T<CompositeMesh> composite_sqrt3;
+    CatmullClarkT<PolyMesh>      catmull_clark;
+
+    longest_edge.set_max_edge_length(0.5 / n);
+
+    _reporter.add("subdivider", "LoopT",                 n_vertices, run_subdivider<Mesh>(n, true, loop));
+    _reporter.add("subdivider", "Sqrt3T",                n_vertices, run_subdivider<Mesh>(n, true, sqrt3));
+    _reporter.add("subdivider", "ModifiedButterflyT",    n_vertices, run_subdivider<Mesh>(n, true, butterfly));
+    _reporter.add("subdivider", "InterpolatingSqrt3LGT", n_vertices, run_subdivider<Mesh>(n, true, sqrt3_lg));
+    _reporter.add("subdivider", "LongestEdgeT",          n_vertices, run_subdivider<Mesh>(n, true, longest_edge));
+    _reporter.add("subdivider", "CompositeLoopT",        n_vertices, run_subdivider<CompositeMesh>(n, true, composite_loop));
+    _reporter.add("subdivider", "CompositeSqrt3T",       n_vertices, run_subdivider<CompositeMesh>(n, true, composite_sqrt3));
+    _reporter.add("subdivider", "CatmullClarkT",         n_vertices, run_subdivider<PolyMesh>(n, false, catmull_clark));
+  }
+}
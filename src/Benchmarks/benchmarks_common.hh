@@ -0,0 +1,207 @@
+#ifndef OPENMESH_BENCHMARKS_COMMON_HH
+#define OPENMESH_BENCHMARKS_COMMON_HH
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/IO/MeshIO.hh>
+#include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
+#include <OpenMesh/Core/Mesh/PolyMesh_ArrayKernelT.hh>
+#include <OpenMesh/Tools/Utils/Timer.hh>
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cfloat>
+
+namespace Benchmark {
+
+typedef OpenMesh::TriMesh_ArrayKernelT<>  Mesh;
+typedef OpenMesh::PolyMesh_ArrayKernelT<> PolyMesh;
+
+/// Global settings, given on the command line
+struct Settings
+{
+  Settings() : quick(false), repetitions(3) {}
+
+  /// Skip the largest meshes
+  bool quick;
+
+  /// Number of runs per measurement, the fastest run is reported
+  int repetitions;
+};
+
+inline Settings& settings()
+{
+  static Settings s;
+  return s;
+}
+
+/// Resolutions of the synthetic grids, see make_grid()
+inline std::vector<int> grid_sizes()
+{
+  std::vector<int> sizes;
+  sizes.push_back(64);
+  sizes.push_back(256);
+  if (!settings().quick)
+    sizes.push_back(1024);
+  return sizes;
+}
+
+/** Collects the measurements of all benchmarks and writes them as CSV
+ *  (one line per measurement) or as a JSON document. \c size is the
+ *  number of vertices of the input mesh, \c seconds the fastest of
+ *  Settings::repetitions runs.
+ */
+class Reporter
+{
+public:
+
+  /// Record one measurement
+  void add(const std::string& _benchmark, const std::string& _variant,
+           size_t _size, double _seconds)
+  {
+    results_.push_back(Result(_benchmark, _variant, _size, _seconds));
+    std::clog << _benchmark << ' ' << _variant << ' ' << _size << ": "
+              << _seconds << "s" << std::endl;
+  }
+
+  void write_csv(std::ostream& _os) const
+  {
+    _os << "benchmark,variant,size,seconds\n";
+    for (size_t i = 0; i < results_.size(); ++i)
+      _os << results_[i].benchmark << ',' << results_[i].variant << ','
+          << results_[i].size << ',' << results_[i].seconds << '\n';
+  }
+
+  void write_json(std::ostream& _os) const
+  {
+    _os << "{\n"
+        << "  \"openmesh_version\": \"" << ((OM_VERSION >> 16) & 0xff) << '.'
+                                        << ((OM_VERSION >> 8) & 0xff) << "\",\n"
+        << "  \"repetitions\": " << settings().repetitions << ",\n"
+        << "  \"results\": [";
+    for (size_t i = 0; i < results_.size(); ++i)
+      _os << (i ? ",\n" : "\n")
+          << "    {\"benchmark\": \"" << results_[i].benchmark
+          << "\", \"variant\": \"" << results_[i].variant
+          << "\", \"size\": " << results_[i].size
+          << ", \"seconds\": " << results_[i].seconds << "}";
+    _os << "\n  ]\n}\n";
+  }
+
+private:
+
+  struct Result
+  {
+    Result(const std::string& _benchmark, const std::string& _variant,
+           size_t _size, double _seconds)
+      : benchmark(_benchmark), variant(_variant), size(_size), seconds(_seconds) {}
+
+    std::string benchmark;
+    std::string variant;
+    size_t      size;
+    double      seconds;
+  };
+
+  std::vector<Result> results_;
+};
+
+/** Measures the fastest of several runs:
+ *  \code
+ *  BestTime t;
+ *  for (int r = 0; r < settings().repetitions; ++r) {
+ *    // setup
+ *    t.start();
+ *    // measured code
+ *    t.stop();
+ *  }
+ *  \endcode
+ */
+class BestTime
+{
+public:
+  BestTime() : best_(DBL_MAX) {}
+
+  void start() { timer_.start(); }
+  void stop()  { timer_.stop(); best_ = std::min(best_, timer_.seconds()); }
+
+  double seconds() const { return best_; }
+
+private:
+  OpenMesh::Utils::Timer timer_;
+  double                 best_;
+};
+
+/** Create a height field over a _n x _n grid of quads, split into two
+ *  triangles each if _triangles is true. The mesh has (_n+1)^2 vertices.
+ */
+template <class MeshT>
+void make_grid(MeshT& _mesh, int _n, bool _triangles = true)
+{
+  _mesh.clear();
+  _mesh.reserve((_n+1)*(_n+1), 3*_n*_n, (_triangles ? 2 : 1)*_n*_n);
+
+  for (int j = 0; j <= _n; ++j)
+    for (int i = 0; i <= _n; ++i)
+    {
+      const float x = float(i) / float(_n), y = float(j) / float(_n);
+      _mesh.add_vertex(typename MeshT::Point(x, y, 0.1f * std::sin(6.f*x) * std::cos(5.f*y)));
+    }
+
+  std::vector<typename MeshT::VertexHandle> face(4);
+  for (int j = 0; j < _n; ++j)
+    for (int i = 0; i < _n; ++i)
+    {
+      typename MeshT::VertexHandle v00(j*(_n+1)+i),     v10(j*(_n+1)+i+1),
+                                   v01((j+1)*(_n+1)+i), v11((j+1)*(_n+1)+i+1);
+      if (_triangles)
+      {
+        face.resize(3);
+        face[0] = v00; face[1] = v10; face[2] = v11; _mesh.add_face(face);
+        face[0] = v00; face[1] = v11; face[2] = v01; _mesh.add_face(face);
+      }
+      else
+      {
+        face.resize(4);
+        face[0] = v00; face[1] = v10; face[2] = v11; face[3] = v01; _mesh.add_face(face);
+      }
+    }
+}
+
+typedef void (*BenchmarkFunction)(Reporter& _reporter);
+
+struct BenchmarkEntry
+{
+  BenchmarkEntry(const char* _name, BenchmarkFunction _function)
+    : name(_name), function(_function) {}
+
+  std::string       name;
+  BenchmarkFunction function;
+};
+
+/// All registered benchmarks
+inline std::vector<BenchmarkEntry>& registry()
+{
+  static std::vector<BenchmarkEntry> benchmarks;
+  return benchmarks;
+}
+
+/// Registers a benchmark function at static initialization time
+struct Registrar
+{
+  Registrar(const char* _name, BenchmarkFunction _function)
+  {
+    registry().push_back(BenchmarkEntry(_name, _function));
+  }
+};
+
+}
+
+/// Define and register a benchmark
+#define OPENMESH_BENCHMARK(_name) \
+  static void _name(Benchmark::Reporter& _reporter); \
+  static Benchmark::Registrar _name##_registrar(#_name, _name); \
+  static void _name(Benchmark::Reporter& _reporter)
+
+#endif // OPENMESH_BENCHMARKS_COMMON_HH
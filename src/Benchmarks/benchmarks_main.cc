@@ -0,0 +1,82 @@
+#include <Benchmarks/benchmarks_common.hh>
+
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+
+void usage_and_exit(int _xcode)
+{
+  std::cerr << "Usage: OpenMesh_bench [options] [benchmark...]\n\n"
+            << "Runs all benchmarks whose name contains one of the given\n"
+            << "strings, or all benchmarks if none is given.\n\n"
+            << "Options:\n"
+            << "  --format csv|json  Output format (default csv)\n"
+            << "  --output <file>    Write the results to <file> instead of stdout\n"
+            << "  --repetitions <n>  Runs per measurement, the fastest is reported (default 3)\n"
+            << "  --quick            Skip the largest meshes\n"
+            << "  --list             List the benchmarks\n";
+  exit(_xcode);
+}
+
+int main(int argc, char** argv)
+{
+  Benchmark::Reporter reporter;
+  const std::vector<Benchmark::BenchmarkEntry>& benchmarks = Benchmark::registry();
+
+  std::string              format("csv"), output;
+  std::vector<std::string> filters;
+
+  for (int a = 1; a < argc; ++a)
+  {
+    if (!strcmp(argv[a], "--format") && a+1 < argc)
+      format = argv[++a];
+    else if (!strcmp(argv[a], "--output") && a+1 < argc)
+      output = argv[++a];
+    else if (!strcmp(argv[a], "--repetitions") && a+1 < argc)
+      Benchmark::settings().repetitions = std::max(1, atoi(argv[++a]));
+    else if (!strcmp(argv[a], "--quick"))
+      Benchmark::settings().quick = true;
+    else if (!strcmp(argv[a], "--list"))
+    {
+      for (size_t i = 0; i < benchmarks.size(); ++i)
+        std::cout << benchmarks[i].name << std::endl;
+      return 0;
+    }
+    else if (argv[a][0] == '-')
+      usage_and_exit(!strcmp(argv[a], "--help") ? 0 : 1);
+    else
+      filters.push_back(argv[a]);
+  }
+
+  if (format != "csv" && format != "json")
+    usage_and_exit(1);
+
+  for (size_t i = 0; i < benchmarks.size(); ++i)
+  {
+    bool selected = filters.empty();
+    for (size_t f = 0; f < filters.size() && !selected; ++f)
+      selected = (benchmarks[i].name.find(filters[f]) != std::string::npos);
+
+    if (selected)
+      benchmarks[i].function(reporter);
+  }
+
+  std::ofstream file;
+  if (!output.empty())
+  {
+    file.open(output.c_str());
+    if (!file)
+    {
+      std::cerr << "Cannot open " << output << std::endl;
+      return 1;
+    }
+  }
+  std::ostream& os = output.empty() ? std::cout : file;
+
+  if (format == "json")
+    reporter.write_json(os);
+  else
+    reporter.write_csv(os);
+
+  return 0;
+}
@@ -49,7 +49,12 @@
 #include <iostream>
 #include <iterator>
 #include <fstream>
+#include <sstream>
 #include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+#include <cstdlib>
 //
 #include <OpenMesh/Core/IO/MeshIO.hh>
 #include <OpenMesh/Core/Mesh/TriMesh_ArrayKernelT.hh>
@@ -57,6 +62,16 @@
 #include <OpenMesh/Tools/Utils/Timer.hh>
 #include <OpenMesh/Tools/Utils/getopt.h>
 
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <dirent.h>
+#endif
+
+#ifdef _OPENMP
+#  include <omp.h>
+#endif
+
 
 struct MyTraits : public OpenMesh::DefaultTraits
 {
@@ -76,7 +91,8 @@ void usage_and_exit(int xcode)
    using std::cout;
    using std::endl;
    
-   cout << "\nUsage: mconvert [option] <input> [<output>]\n\n";
+   cout << "\nUsage: mconvert [option] <input> [<output>]\n"
+        << "       mconvert [option] -L <list> | -D <directory> [-e <ext>] [-O <directory>] [-j <n>]\n\n";
    cout << "   Convert from one 3D geometry format to another.\n"
         << "   Or simply display some information about the object\n"
         << "   stored in <input>.\n"
@@ -87,6 +103,7 @@ void usage_and_exit(int xcode)
    cout << "    -l\tStore least significant bit first (LSB, little endian).\n" << endl;
    cout << "    -m\tStore most significant bit first (MSB, big endian).\n" << endl;
    cout << "    -s\tSwap byte order.\n" << endl;
+   cout << "    -z\tCompress the data if supported by target format (OM).\n" << endl;
    cout << "  -B\tUse binary mode if supported by source format.\n" << endl;
    cout << "    -S\tSwap byte order of input data.\n" << endl;
    cout << "  -c\tCopy vertex color if provided by input.\n" << endl;
@@ -97,6 +114,15 @@ void usage_and_exit(int xcode)
    cout << "  -t\tCopy vertex texture coordinates if provided by input file.\n" << endl;
    cout << "  -T \"x y z\"\tTranslate object by vector (x, y, z)'\"\n"
         << std::endl;
+   cout << "Batch mode:\n"
+        << endl;
+   cout << "  -L <list>\tConvert the files listed in <list>, one file per line.\n" << endl;
+   cout << "  -D <directory>\tConvert all readable files in <directory>.\n" << endl;
+   cout << "    -e <ext>\tExtension of the output files, e.g. ply. Without it\n"
+        << "    \t\tthe files are only read.\n" << endl;
+   cout << "    -O <directory>\tWrite the output files to <directory>. Default is\n"
+        << "    \t\tthe directory of each input file.\n" << endl;
+   cout << "    -j <n>\tConvert <n> files at the same time (needs OpenMP).\n" << endl;
    cout << endl;
    
    exit(xcode);
@@ -143,113 +169,99 @@ std::istream& operator >> (std::istream& _is, Option<T>& _opt )
 
 // ----------------------------------------------------------------------------
 
-int main(int argc, char *argv[] )
+/// Options of a conversion, shared by all files of a batch
+struct Settings
 {
-  // ------------------------------------------------------------ command line
+  Settings() : rev_normals(false), obj_center(false) {}
 
-  int c;
-  std::string ifname, ofname;
-  bool rev_normals = false;
-  bool obj_center  = false;
   OpenMesh::IO::Options opt, ropt;
-
+  bool rev_normals;
+  bool obj_center;
   Option< MyMesh::Point > tvec;
+};
 
-  while ( (c=getopt(argc, argv, "bBcdCi:hlmnNo:sStT:"))!=-1 )
-  {
-    switch(c)
-    {
-      case 'b': opt  += OpenMesh::IO::Options::Binary; break;
-      case 'B': ropt += OpenMesh::IO::Options::Binary; break;
-      case 'l': opt  += OpenMesh::IO::Options::LSB; break;
-      case 'm': opt  += OpenMesh::IO::Options::MSB; break;
-      case 's': opt  += OpenMesh::IO::Options::Swap; break;
-      case 'S': ropt += OpenMesh::IO::Options::Swap; break;
-      case 'n': opt  += OpenMesh::IO::Options::VertexNormal; break;
-      case 'N': rev_normals = true; break;
-      case 'C': obj_center  = true; break;
-      case 'c': opt  += OpenMesh::IO::Options::VertexColor; break;
-      case 'd': opt  += OpenMesh::IO::Options::FaceColor; break;
-      case 't': opt  += OpenMesh::IO::Options::VertexTexCoord; break;
-      case 'T': 
-      {
-        std::cout << optarg << std::endl;
-        std::stringstream str; str << optarg;
-        str >> tvec;
-        std::cout << tvec << std::endl;
-        break;
-      }
-      case 'i': ifname = optarg; break;
-      case 'o': ofname = optarg; break;
-      case 'h':
-        usage_and_exit(0);
-      case '?':
-      default:
-        usage_and_exit(1);
-    }
-  }
+/// What a conversion did, used for the throughput report
+struct Statistics
+{
+  Statistics() : n_vertices(0), n_faces(0), bytes(0), seconds(0.0) {}
 
-  if (ifname.empty())
-  { 
-    if (optind < argc)
-      ifname = argv[optind++];
-    else
-      usage_and_exit(1);
-  }
+  size_t n_vertices;
+  size_t n_faces;
+  size_t bytes;    // size of the input file
+  double seconds;  // read, process and write
+};
 
+// ----------------------------------------------------------------------------
+
+/// Read _ifname, apply the features in _settings and write the result to
+/// _ofname, if it is not empty. Progress is reported to _log.
+bool convert( const std::string& _ifname, const std::string& _ofname,
+              const Settings& _settings, std::ostream& _log, Statistics& _stats )
+{
   MyMesh mesh;
-  OpenMesh::Utils::Timer  timer;
+  OpenMesh::Utils::Timer  timer, total;
+  OpenMesh::IO::Options   opt  = _settings.opt;
+  OpenMesh::IO::Options   ropt = _settings.ropt;
+
+  total.start();
 
   // ------------------------------------------------------------ read
 
-  std::cout << "reading.." << std::endl;
+  _log << "reading.." << std::endl;
   {
     bool rc;
     timer.start();
-    rc = OpenMesh::IO::read_mesh( mesh, ifname, ropt );
+    rc = OpenMesh::IO::read_mesh( mesh, _ifname, ropt );
     timer.stop();
     if (rc)
-      std::cout << "  read in " << timer.as_string() << std::endl;
+      _log << "  read in " << timer.as_string() << std::endl;
     else
     {
-      std::cout << "  read failed\n" << std::endl;
-      return 1;
+      _log << "  read failed\n" << std::endl;
+      return false;
     }       
     timer.reset();
   }
 
+  {
+    std::ifstream ifs( _ifname.c_str(), std::ios::in | std::ios::binary );
+    ifs.seekg( 0, std::ios::end );
+    _stats.bytes = ifs ? size_t(ifs.tellg()) : 0;
+  }
+  _stats.n_vertices = mesh.n_vertices();
+  _stats.n_faces    = mesh.n_faces();
+
 
   // ---------------------------------------- some information about input
-  std::cout << (ropt.check(OpenMesh::IO::Options::Binary) 
-                ? "  source is binary\n"
-                : "  source is ascii\n");   
+  _log << (ropt.check(OpenMesh::IO::Options::Binary) 
+           ? "  source is binary\n"
+           : "  source is ascii\n");   
 
-  std::cout << "  #V " << mesh.n_vertices() << std::endl;
-  std::cout << "  #E " << mesh.n_edges() << std::endl;
-  std::cout << "  #F " << mesh.n_faces() << std::endl;
+  _log << "  #V " << mesh.n_vertices() << std::endl;
+  _log << "  #E " << mesh.n_edges() << std::endl;
+  _log << "  #F " << mesh.n_faces() << std::endl;
 
   if (ropt.vertex_has_texcoord())
-    std::cout << "  has texture coordinates" << std::endl;
+    _log << "  has texture coordinates" << std::endl;
     
   if (ropt.vertex_has_normal())
-    std::cout << "  has vertex normals" << std::endl;
+    _log << "  has vertex normals" << std::endl;
 
   if (ropt.vertex_has_color())
-    std::cout << "  has vertex colors" << std::endl;
+    _log << "  has vertex colors" << std::endl;
     
   if (ropt.face_has_normal())
-    std::cout << "  has face normals" << std::endl;
+    _log << "  has face normals" << std::endl;
 
   if (ropt.face_has_color())
-    std::cout << "  has face colors" << std::endl;
+    _log << "  has face colors" << std::endl;
 
   // 
-  if (ofname.empty())
+  if (_ofname.empty())
   {
-    if ( optind < argc )
-      ofname = argv[optind++];
-    else
-      return 0;
+    total.stop();
+    _stats.seconds = total.seconds();
+    return true;
   }
 
   // ------------------------------------------------------------ features
@@ -257,46 +269,46 @@ int main(int argc, char *argv[] )
   // ---------------------------------------- compute normal feature
   if ( opt.vertex_has_normal() && !ropt.vertex_has_normal())
   {
-    std::cout << "compute normals" << std::endl;
+    _log << "compute normals" << std::endl;
 
     timer.start();
     mesh.update_face_normals();
     timer.stop();
-    std::cout << "  " << mesh.n_faces()
-              << " face normals in " << timer.as_string() << std::endl;
+    _log << "  " << mesh.n_faces()
+         << " face normals in " << timer.as_string() << std::endl;
     timer.reset();
        
     timer.start();
     mesh.update_vertex_normals();
     timer.stop();
-    std::cout << "  " << mesh.n_vertices()
-              << " vertex normals in " << timer.as_string() << std::endl;
+    _log << "  " << mesh.n_vertices()
+         << " vertex normals in " << timer.as_string() << std::endl;
     timer.reset();       
   }
 
 
   // ---------------------------------------- reverse normal feature
-  if ( rev_normals && ropt.vertex_has_normal() )
+  if ( _settings.rev_normals && ropt.vertex_has_normal() )
   {
-    std::cout << "reverse normal directions" << std::endl;
+    _log << "reverse normal directions" << std::endl;
     timer.start();
     MyMesh::VertexIter vit = mesh.vertices_begin();
     for (; vit != mesh.vertices_end(); ++vit)
       mesh.set_normal( *vit, -mesh.normal( *vit ) );
     timer.stop();
-    std::cout << "  " << mesh.n_vertices()
-              << " vertex normals in " << timer.as_string() << std::endl;
+    _log << "  " << mesh.n_vertices()
+         << " vertex normals in " << timer.as_string() << std::endl;
     timer.reset();       
        
   }
 
 
   // ---------------------------------------- centering feature
-  if ( obj_center )
+  if ( _settings.obj_center )
   {
     OpenMesh::Vec3f cog(0,0,0);
     size_t nv;
-    std::cout << "center object" << std::endl;
+    _log << "center object" << std::endl;
     timer.start();    
     MyMesh::VertexIter vit = mesh.vertices_begin();
     for (; vit != mesh.vertices_end(); ++vit)
@@ -304,7 +316,7 @@ int main(int argc, char *argv[] )
     timer.stop();
     nv   = mesh.n_vertices();
     cog *= 1.0f/mesh.n_vertices();
-    std::cout << "  cog = [" << cog << "]'" << std::endl;
+    _log << "  cog = [" << cog << "]'" << std::endl;
     if (cog.sqrnorm() > 0.8) // actually one should consider the size of object
     {
       vit = mesh.vertices_begin();
@@ -315,32 +327,32 @@ int main(int argc, char *argv[] )
       nv += mesh.n_vertices();
     }
     else
-      std::cout << "    already centered!" << std::endl;
-    std::cout << "  visited " << nv
-              << " vertices in " << timer.as_string() << std::endl;
+      _log << "    already centered!" << std::endl;
+    _log << "  visited " << nv
+         << " vertices in " << timer.as_string() << std::endl;
     timer.reset();       
   }
 
 
   // ---------------------------------------- translate feature
-  if ( tvec.is_valid() )
+  if ( _settings.tvec.is_valid() )
   {
-    std::cout << "Translate object by " << tvec << std::endl;
+    _log << "Translate object by " << _settings.tvec << std::endl;
 
     timer.start();
     MyMesh::VertexIter vit = mesh.vertices_begin();
     for (; vit != mesh.vertices_end(); ++vit)
-      mesh.set_point( *vit , mesh.point( *vit ) + tvec.first );
+      mesh.set_point( *vit , mesh.point( *vit ) + _settings.tvec.first );
     timer.stop();
-    std::cout << "  moved " << mesh.n_vertices()
-              << " vertices in " << timer.as_string() << std::endl;
+    _log << "  moved " << mesh.n_vertices()
+         << " vertices in " << timer.as_string() << std::endl;
   }
 
   // ---------------------------------------- color vertices feature
   if (  opt.check( OpenMesh::IO::Options::VertexColor ) &&
         !ropt.check( OpenMesh::IO::Options::VertexColor ) )
   {
-    std::cout << "Color vertices" << std::endl;
+    _log << "Color vertices" << std::endl;
 
     double d  = 256.0/double(mesh.n_vertices());
     double d2 = d/2.0;
@@ -357,15 +369,15 @@ int main(int argc, char *argv[] )
       b -= d;
     }
     timer.stop();
-    std::cout << "  colored " << mesh.n_vertices()
-              << " vertices in " << timer.as_string() << std::endl;
+    _log << "  colored " << mesh.n_vertices()
+         << " vertices in " << timer.as_string() << std::endl;
   }
 
   // ---------------------------------------- color faces feature
   if (  opt.check( OpenMesh::IO::Options::FaceColor ) &&
         !ropt.check( OpenMesh::IO::Options::FaceColor ) )
   {
-    std::cout << "Color faces" << std::endl;
+    _log << "Color faces" << std::endl;
 
     double d  = 256.0/double(mesh.n_faces());
     double d2 = d/2.0;
@@ -382,45 +394,326 @@ int main(int argc, char *argv[] )
       b -= d;
     }
     timer.stop();
-    std::cout << "  colored " << mesh.n_faces()
-              << " faces in " << timer.as_string() << std::endl;
+    _log << "  colored " << mesh.n_faces()
+         << " faces in " << timer.as_string() << std::endl;
   }
 
   // ------------------------------------------------------------ write
   
-  std::cout << "writing.." << std::endl;    
+  _log << "writing.." << std::endl;    
   {
     bool rc;
     timer.start();
-    rc = OpenMesh::IO::write_mesh( mesh, ofname, opt );          
+    rc = OpenMesh::IO::write_mesh( mesh, _ofname, opt );          
     timer.stop();
        
     if (!rc)
     {
-      std::cerr << "  error writing mesh!" << std::endl;
-      return 1;
+      _log << "  error writing mesh!" << std::endl;
+      return false;
     }
        
     // -------------------------------------- write output and some info
     if ( opt.check(OpenMesh::IO::Options::Binary) )
     {          
-      std::cout << "  "
-                << OpenMesh::IO::binary_size(mesh, ofname, opt)
-                << std::endl;
+      _log << "  "
+           << OpenMesh::IO::binary_size(mesh, _ofname, opt)
+           << std::endl;
     }
     if ( opt.vertex_has_normal() )
-      std::cout << "  with vertex normals" << std::endl;
+      _log << "  with vertex normals" << std::endl;
     if ( opt.vertex_has_color() )
-      std::cout << "  with vertex colors" << std::endl;
+      _log << "  with vertex colors" << std::endl;
     if ( opt.vertex_has_texcoord() )
-      std::cout << "  with vertex texcoord" << std::endl;
+      _log << "  with vertex texcoord" << std::endl;
     if ( opt.face_has_normal() )
-      std::cout << "  with face normals" << std::endl;
+      _log << "  with face normals" << std::endl;
     if ( opt.face_has_color() )
-      std::cout << "  with face colors" << std::endl;
-    std::cout << "  wrote in " << timer.as_string() << std::endl;
+      _log << "  with face colors" << std::endl;
+    _log << "  wrote in " << timer.as_string() << std::endl;
     timer.reset();       
   }
 
-  return 0;
+  total.stop();
+  _stats.seconds = total.seconds();
+
+  return true;
+}
+
+// ----------------------------------------------------------------------------
+
+/// Append the non-empty lines of _listname to _files
+bool read_file_list( const std::string& _listname, std::vector<std::string>& _files )
+{
+  std::ifstream ifs( _listname.c_str() );
+  if ( !ifs )
+    return false;
+
+  std::string line;
+  while ( std::getline(ifs, line) )
+  {
+    // trim leading and trailing white space, e.g. the \r of DOS files
+    std::string::size_type first = line.find_first_not_of(" \t\r");
+    std::string::size_type last  = line.find_last_not_of(" \t\r");
+    if ( first != std::string::npos && line[first] != '#' )
+      _files.push_back( line.substr(first, last-first+1) );
+  }
+  return true;
+}
+
+/// Append all files in _dirname with an extension a reader is registered for
+bool read_directory( const std::string& _dirname, std::vector<std::string>& _files )
+{
+  std::vector<std::string> names;
+  std::string dir = _dirname;
+  if ( !dir.empty() && dir[dir.size()-1] != '/' && dir[dir.size()-1] != '\\' )
+    dir += '/';
+
+#if defined(_WIN32)
+  WIN32_FIND_DATAA data;
+  HANDLE handle = FindFirstFileA( (dir + "*").c_str(), &data );
+  if ( handle == INVALID_HANDLE_VALUE )
+    return false;
+  do
+  {
+    if ( !(data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) )
+      names.push_back( data.cFileName );
+  } while ( FindNextFileA(handle, &data) );
+  FindClose( handle );
+#else
+  DIR* d = opendir( dir.c_str() );
+  if ( !d )
+    return false;
+  while ( struct dirent* entry = readdir(d) )
+    if ( entry->d_name[0] != '.' )
+      names.push_back( entry->d_name );
+  closedir( d );
+#endif
+
+  std::sort( names.begin(), names.end() );
+
+  // can_read() opens the file for readers checking a magic number, therefore
+  // look the extension up in the filters, e.g. "... (  *.off );;..."
+  const std::string& filters = OpenMesh::IO::IOManager().qt_read_filters();
+
+  for (size_t i=0; i<names.size(); ++i)
+  {
+    std::string::size_type dot = names[i].rfind('.');
+    if ( dot == std::string::npos )
+      continue;
+
+    std::string ext = names[i].substr(dot+1);
+    std::transform( ext.begin(), ext.end(), ext.begin(), ::tolower );
+
+    if ( filters.find(" *." + ext + " ") != std::string::npos )
+      _files.push_back( dir + names[i] );
+  }
+  return true;
+}
+
+/// Name of the output file for _ifname, with the extension _ext and in
+/// the directory _odir, if it is not empty
+std::string output_name( const std::string& _ifname,
+                         const std::string& _odir, const std::string& _ext )
+{
+  std::string::size_type slash = _ifname.find_last_of("/\\");
+  std::string dir  = (slash == std::string::npos) ? "" : _ifname.substr(0, slash+1);
+  std::string name = (slash == std::string::npos) ? _ifname : _ifname.substr(slash+1);
+
+  std::string::size_type dot = name.rfind('.');
+  if ( dot != std::string::npos )
+    name = name.substr(0, dot);
+
+  if ( !_odir.empty() )
+  {
+    dir = _odir;
+    if ( dir[dir.size()-1] != '/' && dir[dir.size()-1] != '\\' )
+      dir += '/';
+  }
+
+  return dir + name + "." + _ext;
+}
+
+/// Convert all _files with _n_workers conversions running at the same time
+/// and report the throughput per file and of the whole batch.
+int convert_batch( const std::vector<std::string>& _files,
+                   const std::string& _odir, const std::string& _ext,
+                   const Settings& _settings, int _n_workers )
+{
+  const int n_files = int(_files.size());
+  int       n_failed = 0;
+  size_t    bytes = 0;
+
+#ifdef _OPENMP
+  if ( _n_workers < 1 )
+    _n_workers = omp_get_max_threads();
+#else
+  if ( _n_workers > 1 )
+    std::cerr << "Compiled without OpenMP, converting on a single thread." << std::endl;
+  _n_workers = 1;
+#endif
+
+  // files with the same name and different extensions would be written
+  // to the same output file, convert only the first of them
+  std::vector<std::string> ofnames( _files.size() );
+  std::vector<bool>        duplicate( _files.size(), false );
+  if ( !_ext.empty() )
+  {
+    std::set<std::string> used;
+    for (size_t i=0; i<_files.size(); ++i)
+    {
+      ofnames[i]   = output_name(_files[i], _odir, _ext);
+      duplicate[i] = !used.insert(ofnames[i]).second;
+    }
+  }
+
+  OpenMesh::Utils::Timer timer;
+  timer.start();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(_n_workers) reduction(+:n_failed, bytes)
+#endif
+  for (int i=0; i<n_files; ++i)
+  {
+    const std::string& ofname = ofnames[i];
+
+    std::ostringstream log;
+    Statistics         stats;
+    bool               ok = false;
+
+    if ( duplicate[i] )
+      log << "  " << ofname << " is the output of another file" << std::endl;
+    else
+      ok = convert( _files[i], ofname, _settings, log, stats );
+
+    std::ostringstream line;
+    line << "[" << i+1 << "/" << n_files << "] " << _files[i];
+    if ( !ofname.empty() )
+      line << " -> " << ofname;
+
+    if ( ok )
+    {
+      const double mb = double(stats.bytes) / (1024.0*1024.0);
+      line << ": " << stats.n_vertices << " vertices, " << stats.n_faces << " faces, "
+           << mb << " MB in " << OpenMesh::Utils::Timer::as_string(stats.seconds);
+      if ( stats.seconds > 0.0 )
+        line << " (" << mb / stats.seconds << " MB/s, "
+             << double(stats.n_vertices) / stats.seconds << " vertices/s)";
+      bytes += stats.bytes;
+    }
+    else
+    {
+      line << ": failed\n" << log.str();
+      ++n_failed;
+    }
+
+#ifdef _OPENMP
+#pragma omp critical(mconvert_report)
+#endif
+    std::cout << line.str() << std::endl;
+  }
+
+  timer.stop();
+
+  const double mb = double(bytes) / (1024.0*1024.0);
+  std::cout << "converted " << n_files-n_failed << " of " << n_files << " files, "
+            << mb << " MB in " << timer.as_string();
+  if ( timer.seconds() > 0.0 )
+    std::cout << " (" << mb / timer.seconds() << " MB/s, "
+              << double(n_files) / timer.seconds() << " files/s)";
+  std::cout << " with " << _n_workers << " worker(s)" << std::endl;
+
+  return n_failed ? 1 : 0;
+}
+
+// ----------------------------------------------------------------------------
+
+int main(int argc, char *argv[] )
+{
+  // ------------------------------------------------------------ command line
+
+  int c;
+  std::string ifname, ofname;
+  std::string listname, dirname, odir, ext;
+  int n_workers = 0;
+  Settings settings;
+
+  OpenMesh::IO::Options& opt  = settings.opt;
+  OpenMesh::IO::Options& ropt = settings.ropt;
+
+  while ( (c=getopt(argc, argv, "bBcdCD:e:i:hj:lL:mnNo:O:sStT:z"))!=-1 )
+  {
+    switch(c)
+    {
+      case 'b': opt  += OpenMesh::IO::Options::Binary; break;
+      case 'B': ropt += OpenMesh::IO::Options::Binary; break;
+      case 'l': opt  += OpenMesh::IO::Options::LSB; break;
+      case 'm': opt  += OpenMesh::IO::Options::MSB; break;
+      case 's': opt  += OpenMesh::IO::Options::Swap; break;
+      case 'S': ropt += OpenMesh::IO::Options::Swap; break;
+      case 'n': opt  += OpenMesh::IO::Options::VertexNormal; break;
+      case 'N': settings.rev_normals = true; break;
+      case 'C': settings.obj_center  = true; break;
+      case 'c': opt  += OpenMesh::IO::Options::VertexColor; break;
+      case 'd': opt  += OpenMesh::IO::Options::FaceColor; break;
+      case 't': opt  += OpenMesh::IO::Options::VertexTexCoord; break;
+      case 'z': opt  += OpenMesh::IO::Options::Compressed; break;
+      case 'T': 
+      {
+        std::cout << optarg << std::endl;
+        std::stringstream str; str << optarg;
+        str >> settings.tvec;
+        std::cout << settings.tvec << std::endl;
+        break;
+      }
+      case 'i': ifname = optarg; break;
+      case 'o': ofname = optarg; break;
+      case 'L': listname = optarg; break;
+      case 'D': dirname = optarg; break;
+      case 'O': odir = optarg; break;
+      case 'e': ext = optarg; if (!ext.empty() && ext[0] == '.') ext.erase(0, 1); break;
+      case 'j': n_workers = atoi(optarg); break;
+      case 'h':
+        usage_and_exit(0);
+      case '?':
+      default:
+        usage_and_exit(1);
+    }
+  }
+
+  // ------------------------------------------------------------ batch mode
+
+  if ( !listname.empty() || !dirname.empty() )
+  {
+    std::vector<std::string> files;
+
+    if ( !listname.empty() && !read_file_list(listname, files) )
+    {
+      std::cerr << "cannot read file list " << listname << std::endl;
+      return 1;
+    }
+    if ( !dirname.empty() && !read_directory(dirname, files) )
+    {
+      std::cerr << "cannot read directory " << dirname << std::endl;
+      return 1;
+    }
+
+    return convert_batch( files, odir, ext, settings, n_workers );
+  }
+
+  // ------------------------------------------------------------ single file
+
+  if (ifname.empty())
+  { 
+    if (optind < argc)
+      ifname = argv[optind++];
+    else
+      usage_and_exit(1);
+  }
+
+  if ( ofname.empty() && optind < argc )
+    ofname = argv[optind++];
+
+  Statistics stats;
+  return convert( ifname, ofname, settings, std::cout, stats ) ? 0 : 1;
 }
@@ -113,6 +113,40 @@ read(const std::string& _filename, BaseImporter& _bi, Options& _opt)
 //-----------------------------------------------------------------------------
 
 
+bool
+_IOManager_::
+read_stream(const std::string& _filename, StreamCallback& _callback, Options& _opt, size_t _batch_size)
+{
+  // custom properties can only be stored in a mesh kernel
+  _opt -= Options::Custom;
+
+  // The OBJ reader assigns the vertex attributes while reading the faces,
+  // i.e. after the vertices have been delivered, and would drop them.
+  std::set<BaseReader*>::const_iterator it     =  reader_modules_.begin();
+  std::set<BaseReader*>::const_iterator it_end =  reader_modules_.end();
+
+  for(; it != it_end; ++it)
+    if ((*it)->can_u_read(_filename))
+    {
+      if ( (*it)->get_extensions() == "obj" &&
+           (_opt.vertex_has_normal() || _opt.vertex_has_texcoord() || _opt.vertex_has_color()) )
+      {
+        omerr() << "[OpenMesh::IO::_IOManager_] Vertex normals, colors and texture coordinates can not be streamed from OBJ files, ignoring them\n";
+        _opt -= Options::VertexNormal;
+        _opt -= Options::VertexTexCoord;
+        _opt -= Options::VertexColor;
+      }
+      break;
+    }
+
+  StreamImporter importer(_callback, _batch_size);
+  return read(_filename, importer, _opt);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 bool
 _IOManager_::
 write(const std::string& _filename, BaseExporter& _be, Options _opt, std::streamsize _precision)
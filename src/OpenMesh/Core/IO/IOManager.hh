@@ -71,6 +71,7 @@
 #include <OpenMesh/Core/IO/reader/BaseReader.hh>
 #include <OpenMesh/Core/IO/writer/BaseWriter.hh>
 #include <OpenMesh/Core/IO/importer/BaseImporter.hh>
+#include <OpenMesh/Core/IO/importer/StreamImporter.hh>
 #include <OpenMesh/Core/IO/exporter/BaseExporter.hh>
 #include <OpenMesh/Core/Utils/SingletonT.hh>
 
@@ -132,6 +133,18 @@ public:
 	    Options& _opt);
 
 
+  /** Read the vertices and faces of file _filename in batches of up to
+      _batch_size elements, which are passed to _callback without building
+      a mesh, see StreamImporter. Only readers that do not need a mesh
+      kernel are supported (e.g. OFF, OBJ, PLY and STL). Vertex normals,
+      colors and texture coordinates are not streamed from OBJ files.
+  */
+  bool read_stream(const std::string& _filename,
+                   StreamCallback& _callback,
+                   Options& _opt,
+                   size_t _batch_size = 65536);
+
+
   /** Write a mesh to file _filename. The source data structure is specified
       by the given BaseExporter. The \c save method consecutively queries all
       of its writer modules. True is returned upon success, false if all
@@ -0,0 +1,225 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+//=============================================================================
+//
+//  CLASS MappedFile - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/IO/MappedFile.hh>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <unistd.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+MappedFile::MappedFile()
+  : data_(0), size_(0)
+#if defined(_WIN32)
+  , file_(INVALID_HANDLE_VALUE), mapping_(0)
+#endif
+{
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+MappedFile::MappedFile(const std::string& _filename)
+  : data_(0), size_(0)
+#if defined(_WIN32)
+  , file_(INVALID_HANDLE_VALUE), mapping_(0)
+#endif
+{
+  open(_filename);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+#if defined(_WIN32)
+
+bool MappedFile::open(const std::string& _filename)
+{
+  close();
+
+  file_ = CreateFileA(_filename.c_str(), GENERIC_READ, FILE_SHARE_READ, 0,
+                      OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, 0);
+  if (file_ == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER file_size;
+  if (!GetFileSizeEx(file_, &file_size) || file_size.QuadPart == 0 ||
+      (unsigned long long)file_size.QuadPart > (unsigned long long)((size_t)-1))
+  {
+    close();
+    return false;
+  }
+
+  mapping_ = CreateFileMappingA(file_, 0, PAGE_READONLY, 0, 0, 0);
+  if (!mapping_)
+  {
+    close();
+    return false;
+  }
+
+  data_ = static_cast<const char*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+  if (!data_)
+  {
+    close();
+    return false;
+  }
+
+  size_ = size_t(file_size.QuadPart);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void MappedFile::close()
+{
+  if (data_)
+    UnmapViewOfFile(data_);
+  if (mapping_)
+    CloseHandle(mapping_);
+  if (file_ != INVALID_HANDLE_VALUE)
+    CloseHandle(file_);
+
+  data_    = 0;
+  size_    = 0;
+  mapping_ = 0;
+  file_    = INVALID_HANDLE_VALUE;
+}
+
+#else // POSIX
+
+bool MappedFile::open(const std::string& _filename)
+{
+  close();
+
+  int fd = ::open(_filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0 ||
+      (unsigned long long)st.st_size > (unsigned long long)((size_t)-1))
+  {
+    ::close(fd);
+    return false;
+  }
+
+  void* p = mmap(0, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+
+  // The mapping stays valid after the descriptor is closed
+  ::close(fd);
+
+  if (p == MAP_FAILED)
+    return false;
+
+#if defined(MADV_SEQUENTIAL)
+  madvise(p, size_t(st.st_size), MADV_SEQUENTIAL);
+#endif
+
+  data_ = static_cast<const char*>(p);
+  size_ = size_t(st.st_size);
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void MappedFile::close()
+{
+  if (data_)
+    munmap(const_cast<char*>(data_), size_);
+
+  data_ = 0;
+  size_ = 0;
+}
+
+#endif
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,132 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+//=============================================================================
+//
+//  CLASS MappedFile
+//
+//=============================================================================
+
+#ifndef OPENMESH_IO_MAPPEDFILE_HH
+#define OPENMESH_IO_MAPPEDFILE_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/Noncopyable.hh>
+// -------------------- STL
+#include <cstddef>
+#include <string>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Read-only memory mapping of a whole file.
+
+    The readers use this class to parse binary files directly from the
+    page cache instead of copying every value through a std::istream.
+    If the platform does not support memory mapping (or mapping fails),
+    is_open() returns false and the caller has to fall back to stream
+    based reading.
+*/
+class OPENMESHDLLEXPORT MappedFile : private Utils::Noncopyable
+{
+public:
+
+  /// Construct an unmapped object
+  MappedFile();
+
+  /// Map the file _filename, check is_open() for success
+  explicit MappedFile(const std::string& _filename);
+
+  /// Unmaps the file
+  ~MappedFile();
+
+  /// Map the file _filename. Returns false, if the file could not be mapped.
+  bool open(const std::string& _filename);
+
+  /// Unmap the file
+  void close();
+
+  /// Is a file currently mapped?
+  bool is_open() const { return data_ != 0; }
+
+  /// Pointer to the first byte of the mapped file
+  const char* data() const { return data_; }
+
+  /// Size of the mapped file in bytes
+  size_t size() const { return size_; }
+
+private:
+
+  const char* data_;
+  size_t      size_;
+
+#if defined(_WIN32)
+  void*       file_;
+  void*       mapping_;
+#endif
+};
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_IO_MAPPEDFILE_HH defined
+//=============================================================================
@@ -143,6 +143,34 @@ read_mesh(Mesh&         _mesh,
 
 
 
+/** \brief Read the file _filename in batches without building a mesh.
+
+    The vertices and faces are passed to _callback in batches of up to
+    _batch_size elements instead of being stored in a mesh. For OFF and
+    PLY files the memory needed does not depend on the size of the file.
+    The OBJ reader keeps a table of all vertices and the STL reader one of
+    all distinct points to resolve the face indices. Vertex normals, colors
+    and texture coordinates are not streamed from OBJ files. See
+    OpenMesh::IO::StreamImporter for details.
+
+    @param _filename   file to load
+    @param _callback   receives the vertex and face batches
+    @param _opt        Reader options, see read_mesh()
+    @param _batch_size maximal number of vertices or faces per batch
+
+    @return Successful?
+*/
+inline bool
+read_stream(const std::string&  _filename,
+            StreamCallback&     _callback,
+            Options&            _opt,
+            size_t              _batch_size = 65536)
+{
+  return IOManager().read_stream(_filename, _callback, _opt, _batch_size);
+}
+
+
+
 //-----------------------------------------------------------------------------
 
 
@@ -0,0 +1,443 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+//=============================================================================
+//
+//  OM chunk codecs - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/IO/OMCodec.hh>
+// -------------------- STL
+#include <cstring>
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+namespace OMFormat {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+#ifndef DOXY_IGNORE_THIS
+
+namespace {
+
+// -------------------- delta + varint
+
+inline uint64 load_le(const unsigned char* _p, unsigned int _width)
+{
+  uint64 v = 0;
+  for (unsigned int i = 0; i < _width; ++i)
+    v |= uint64(_p[i]) << (8*i);
+  return v;
+}
+
+inline void store_le(unsigned char* _p, uint64 _v, unsigned int _width)
+{
+  for (unsigned int i = 0; i < _width; ++i)
+    _p[i] = static_cast<unsigned char>(_v >> (8*i));
+}
+
+inline uint64 width_mask(unsigned int _width)
+{
+  return _width < 8 ? (uint64(1) << (8*_width)) - 1 : ~uint64(0);
+}
+
+inline bool valid_delta_parameters(unsigned int _width, unsigned int _stride)
+{
+  return (_width == 1 || _width == 2 || _width == 4 || _width == 8) && _stride > 0;
+}
+
+bool compress_delta_varint(unsigned int _width, unsigned int _stride,
+                           const unsigned char* _data, size_t _size,
+                           std::string& _packed)
+{
+  if (!valid_delta_parameters(_width, _stride) || _size % _width)
+    return false;
+
+  const size_t n    = _size / _width;
+  const uint64 mask = width_mask(_width);
+  const uint64 sign = uint64(1) << (8*_width - 1);
+
+  // at most 10 bytes per value
+  std::vector<unsigned char> out(n * 10 + 1);
+  size_t o = 0;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    const uint64 v    = load_le(_data + i*_width, _width);
+    const uint64 prev = i >= _stride ? load_le(_data + (i-_stride)*_width, _width) : 0;
+
+    // difference as signed value of _width bytes, then zigzag
+    uint64 d = (v - prev) & mask;
+    if (d & sign)
+      d |= ~mask;
+    uint64 z = (d << 1) ^ (uint64(0) - (d >> 63));
+
+    while (z >= 0x80)
+    {
+      out[o++] = static_cast<unsigned char>(z | 0x80);
+      z >>= 7;
+    }
+    out[o++] = static_cast<unsigned char>(z);
+  }
+
+  _packed.assign(reinterpret_cast<const char*>(&out[0]), o);
+  return true;
+}
+
+bool decompress_delta_varint(unsigned int _width, unsigned int _stride,
+                             const unsigned char* _packed, size_t _packed_size,
+                             unsigned char* _data, size_t _size)
+{
+  if (!valid_delta_parameters(_width, _stride) || _size % _width)
+    return false;
+
+  const size_t n    = _size / _width;
+  const uint64 mask = width_mask(_width);
+  size_t p = 0;
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    uint64 z = 0;
+    for (unsigned int shift = 0; ; shift += 7)
+    {
+      if (p == _packed_size || shift > 63)
+        return false;
+      const unsigned char b = _packed[p++];
+      z |= uint64(b & 0x7f) << shift;
+      if (!(b & 0x80))
+        break;
+    }
+
+    const uint64 d    = (z >> 1) ^ (uint64(0) - (z & 1));
+    const uint64 prev = i >= _stride ? load_le(_data + (i-_stride)*_width, _width) : 0;
+
+    store_le(_data + i*_width, (prev + d) & mask, _width);
+  }
+
+  return p == _packed_size;
+}
+
+
+// -------------------- LZ77
+//
+// The data is a list of sequences. Each sequence starts with a token
+// byte, the upper 4 bits hold the number of literals, the lower 4 bits
+// the match length minus 4. A value of 15 is continued by bytes that are
+// added to it as long as they are 255. The literals follow, then the
+// offset of the match (2 bytes, little endian) into the data decoded so
+// far. The last sequence only has literals.
+
+const unsigned int LZ_MIN_MATCH  = 4;
+const unsigned int LZ_HASH_BITS  = 14;
+const size_t       LZ_MAX_OFFSET = 0xffff;
+
+inline uint32 read32(const unsigned char* _p)
+{
+  uint32 v;
+  memcpy(&v, _p, 4);
+  return v;
+}
+
+inline unsigned int lz_hash(uint32 _v)
+{
+  return (_v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+inline void lz_put_length(std::vector<unsigned char>& _out, size_t _len)
+{
+  for (; _len >= 255; _len -= 255)
+    _out.push_back(255);
+  _out.push_back(static_cast<unsigned char>(_len));
+}
+
+void lz_put_sequence(std::vector<unsigned char>& _out,
+                     const unsigned char* _literals, size_t _n_literals,
+                     size_t _offset, size_t _match)
+{
+  const size_t match = _match ? _match - LZ_MIN_MATCH : 0;
+
+  _out.push_back(static_cast<unsigned char>(
+                   ((_n_literals < 15 ? _n_literals : 15) << 4) | (match < 15 ? match : 15)));
+
+  if (_n_literals >= 15)
+    lz_put_length(_out, _n_literals - 15);
+
+  _out.insert(_out.end(), _literals, _literals + _n_literals);
+
+  if (_match)
+  {
+    _out.push_back(static_cast<unsigned char>(_offset));
+    _out.push_back(static_cast<unsigned char>(_offset >> 8));
+    if (match >= 15)
+      lz_put_length(_out, match - 15);
+  }
+}
+
+bool compress_lz(const unsigned char* _data, size_t _size, std::string& _packed)
+{
+  std::vector<unsigned char> out;
+  out.reserve(_size / 2 + 16);
+
+  // position + 1 of the last occurrence of each hashed 4 byte sequence
+  std::vector<size_t> table(size_t(1) << LZ_HASH_BITS, 0);
+
+  size_t i = 0, anchor = 0;
+
+  while (i + LZ_MIN_MATCH <= _size)
+  {
+    const uint32       v = read32(_data + i);
+    const unsigned int h = lz_hash(v);
+    const size_t       c = table[h];
+    table[h] = i + 1;
+
+    if (c && i - (c-1) <= LZ_MAX_OFFSET && read32(_data + c-1) == v)
+    {
+      const size_t match_start = c - 1;
+      size_t len = LZ_MIN_MATCH;
+      while (i + len < _size && _data[match_start + len] == _data[i + len])
+        ++len;
+
+      lz_put_sequence(out, _data + anchor, i - anchor, i - match_start, len);
+
+      i += len;
+      anchor = i;
+    }
+    else
+      i += 1 + ((i - anchor) >> 6); // skip faster over data without matches
+  }
+
+  if (anchor < _size || out.empty())
+    lz_put_sequence(out, _data + anchor, _size - anchor, 0, 0);
+
+  _packed.assign(reinterpret_cast<const char*>(&out[0]), out.size());
+  return true;
+}
+
+inline bool lz_get_length(const unsigned char* _packed, size_t _packed_size,
+                          size_t& _p, size_t& _len)
+{
+  unsigned char b;
+  do
+  {
+    if (_p == _packed_size)
+      return false;
+    b = _packed[_p++];
+    _len += b;
+  } while (b == 255);
+  return true;
+}
+
+// A sequence of n bytes decodes to at most 255*n bytes: the token, the
+// offset and each length byte add at most 255 to the match length.
+const size_t LZ_MAX_RATIO = 255;
+
+bool decompress_lz(const unsigned char* _packed, size_t _packed_size,
+                   unsigned char* _data, size_t _size)
+{
+  size_t p = 0, o = 0;
+
+  while (p < _packed_size)
+  {
+    const unsigned char token = _packed[p++];
+
+    size_t n_literals = token >> 4;
+    if (n_literals == 15 && !lz_get_length(_packed, _packed_size, p, n_literals))
+      return false;
+
+    if (n_literals > _packed_size - p || n_literals > _size - o)
+      return false;
+
+    if (n_literals)
+      memcpy(_data + o, _packed + p, n_literals);
+    p += n_literals;
+    o += n_literals;
+
+    // last sequence
+    if (p == _packed_size)
+      break;
+
+    if (_packed_size - p < 2)
+      return false;
+    const size_t offset = size_t(_packed[p]) | (size_t(_packed[p+1]) << 8);
+    p += 2;
+
+    size_t len = token & 0x0f;
+    if (len == 15 && !lz_get_length(_packed, _packed_size, p, len))
+      return false;
+    len += LZ_MIN_MATCH;
+
+    if (offset == 0 || offset > o || len > _size - o)
+      return false;
+
+    // byte by byte, the match may overlap the output
+    const unsigned char* src = _data + o - offset;
+    for (size_t k = 0; k < len; ++k)
+      _data[o + k] = src[k];
+    o += len;
+  }
+
+  return o == _size;
+}
+
+} // namespace
+
+#endif
+
+
+//-----------------------------------------------------------------------------
+
+
+bool is_supported(Chunk::Codec _codec)
+{
+  switch (_codec)
+  {
+    case Chunk::Codec_None:
+    case Chunk::Codec_DeltaVarint:
+    case Chunk::Codec_LZ:
+      return true;
+  }
+  return false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool compress(Chunk::Codec _codec, unsigned int _width, unsigned int _stride,
+              const char* _data, size_t _size, std::string& _packed)
+{
+  const unsigned char* data = reinterpret_cast<const unsigned char*>(_data);
+
+  switch (_codec)
+  {
+    case Chunk::Codec_None:
+      _packed.assign(_data, _size);
+      return true;
+
+    case Chunk::Codec_DeltaVarint:
+      return compress_delta_varint(_width, _stride, data, _size, _packed);
+
+    case Chunk::Codec_LZ:
+      return compress_lz(data, _size, _packed);
+  }
+  return false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+bool decompress(Chunk::Codec _codec, unsigned int _width, unsigned int _stride,
+                const char* _packed, size_t _packed_size,
+                size_t _size, std::string& _data)
+{
+  const unsigned char* packed = reinterpret_cast<const unsigned char*>(_packed);
+
+  // _size comes from the file, check that _packed can hold that much data
+  // before allocating it
+  switch (_codec)
+  {
+    case Chunk::Codec_None:
+      if (_packed_size != _size)
+        return false;
+      break;
+
+    case Chunk::Codec_DeltaVarint:
+      // at least one byte per value
+      if (!valid_delta_parameters(_width, _stride) || _size / _width > _packed_size)
+        return false;
+      break;
+
+    case Chunk::Codec_LZ:
+      if (_size / LZ_MAX_RATIO > _packed_size)
+        return false;
+      break;
+
+    default:
+      return false;
+  }
+
+  _data.resize(_size);
+  if (_size == 0)
+    return _packed_size == 0 || _codec == Chunk::Codec_LZ;
+
+  unsigned char* data = reinterpret_cast<unsigned char*>(&_data[0]);
+
+  switch (_codec)
+  {
+    case Chunk::Codec_None:
+      memcpy(data, _packed, _size);
+      return true;
+
+    case Chunk::Codec_DeltaVarint:
+      return decompress_delta_varint(_width, _stride, packed, _packed_size, data, _size);
+
+    case Chunk::Codec_LZ:
+      return decompress_lz(packed, _packed_size, data, _size);
+  }
+  return false;
+}
+
+
+//=============================================================================
+} // namespace OMFormat
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
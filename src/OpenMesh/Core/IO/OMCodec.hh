@@ -0,0 +1,114 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+//=============================================================================
+//
+//  OM chunk codecs
+//
+//=============================================================================
+
+#ifndef OPENMESH_IO_OMCODEC_HH
+#define OPENMESH_IO_OMCODEC_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/IO/OMFormat.hh>
+// -------------------- STL
+#include <cstddef>
+#include <string>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+namespace OMFormat {
+
+
+//== FUNCTIONS ================================================================
+
+/** \name Compression of chunk data
+    The codecs work on the bytes of a chunk as they are stored in the file,
+    which is always little endian. Codec_DeltaVarint is meant for index
+    lists and coordinates, where neighbouring elements have similar values,
+    Codec_LZ for everything else.
+*/
+//@{
+
+/// Does this version of the library know the codec?
+OPENMESHDLLEXPORT bool is_supported(Chunk::Codec _codec);
+
+/** Compress the _size bytes at _data with _codec into _packed.
+    _width and _stride are the parameters of Codec_DeltaVarint and are
+    ignored by the other codecs. Returns false if the codec can not
+    handle the data (unknown codec, size not a multiple of _width, ...). */
+OPENMESHDLLEXPORT bool compress(Chunk::Codec _codec, unsigned int _width, unsigned int _stride,
+              const char* _data, size_t _size, std::string& _packed);
+
+/** Decompress the _packed_size bytes at _packed into _data, which is
+    resized to _size bytes. Returns false if the data is corrupt, i.e. does
+    not decompress to exactly _size bytes. A _size that _packed_size bytes
+    can not hold with _codec is rejected before any memory is allocated. */
+OPENMESHDLLEXPORT bool decompress(Chunk::Codec _codec, unsigned int _width, unsigned int _stride,
+                const char* _packed, size_t _packed_size,
+                size_t _size, std::string& _data);
+
+//@}
+
+
+//=============================================================================
+} // namespace OMFormat
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_IO_OMCODEC_HH defined
+//=============================================================================
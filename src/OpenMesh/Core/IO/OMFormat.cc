@@ -88,6 +88,7 @@ namespace OMFormat {
   operator << (uint16& val, const Chunk::Header& hdr)
   {
     val = 0;
+    val |= hdr.compressed_ << OMFormat::Chunk::OFF_COMPRESSED;
     val |= hdr.name_   << OMFormat::Chunk::OFF_NAME;
     val |= hdr.entity_ << OMFormat::Chunk::OFF_ENTITY;
     val |= hdr.type_   << OMFormat::Chunk::OFF_TYPE;  
@@ -104,7 +105,7 @@ namespace OMFormat {
   Chunk::Header&
   operator << (Chunk::Header& hdr, const uint16 val)
   {
-    hdr.reserved_ = 0;
+    hdr.compressed_ = val >> OMFormat::Chunk::OFF_COMPRESSED;
     hdr.name_     = val >> OMFormat::Chunk::OFF_NAME;
     hdr.entity_   = val >> OMFormat::Chunk::OFF_ENTITY;
     hdr.type_     = val >> OMFormat::Chunk::OFF_TYPE;
@@ -146,6 +147,7 @@ namespace OMFormat {
       case Chunk::Type_Color:    return "Color";
       case Chunk::Type_Custom:   return "Custom";
       case Chunk::Type_Topology: return "Topology";
+      case Chunk::Type_Connectivity: return "Connectivity";
     }
     return NULL;
   }
@@ -195,6 +197,17 @@ namespace OMFormat {
     return NULL;
   }
 
+  const char *as_string(Chunk::Codec c)
+  {
+    switch(c)
+    {
+      case Chunk::Codec_None        : return "None";
+      case Chunk::Codec_DeltaVarint : return "DeltaVarint";
+      case Chunk::Codec_LZ          : return "LZ";
+    }
+    return NULL;
+  }
+
 
 //-----------------------------------------------------------------------------
 
@@ -220,6 +233,8 @@ namespace OMFormat {
 	      ? as_string(Chunk::Float_Size(_c.bits_)) 
 	      : as_string(Chunk::Integer_Size(_c.bits_)));
     }
+    if ( _c.compressed_ )
+      _os << '\n' << "compressed";
     return _os;
   }
 
@@ -165,13 +165,14 @@ namespace OMFormat {
     typedef uint32 esize_t; // element size, used for custom properties
 
     enum Type {
-      Type_Pos       = 0x00,
-      Type_Normal    = 0x01,
-      Type_Texcoord  = 0x02,
-      Type_Status    = 0x03,
-      Type_Color     = 0x04,
-      Type_Custom    = 0x06,
-      Type_Topology  = 0x07
+      Type_Pos          = 0x00,
+      Type_Normal       = 0x01,
+      Type_Texcoord     = 0x02,
+      Type_Status       = 0x03,
+      Type_Color        = 0x04,
+      Type_Custom       = 0x06,
+      Type_Topology     = 0x07,
+      Type_Connectivity = 0x08
     };
 
     enum Entity {
@@ -206,7 +207,7 @@ namespace OMFormat {
       Float_128 = 0x02  // 16 bytes for long double (an assumption!)
     };
 
-    static const int SIZE_RESERVED = 1; //  1
+    static const int SIZE_COMPRESSED = 1; //  1
     static const int SIZE_NAME     = 1; //  2
     static const int SIZE_ENTITY   = 3; //  5
     static const int SIZE_TYPE     = 4; //  9
@@ -216,8 +217,8 @@ namespace OMFormat {
     static const int SIZE_DIM      = 3; // 14
     static const int SIZE_BITS     = 2; // 16
 
-    static const int OFF_RESERVED = 0;                          //  0
-    static const int OFF_NAME     = SIZE_RESERVED + OFF_RESERVED; //  2
+    static const int OFF_COMPRESSED = 0;                              //  0
+    static const int OFF_NAME     = SIZE_COMPRESSED + OFF_COMPRESSED; //  2
     static const int OFF_ENTITY   = SIZE_NAME     + OFF_NAME;   //  3
     static const int OFF_TYPE     = SIZE_ENTITY   + OFF_ENTITY; //  5
     static const int OFF_SIGNED   = SIZE_TYPE     + OFF_TYPE;   //  9
@@ -231,14 +232,19 @@ namespace OMFormat {
     // Entries signed_, float_, dim_, bits_ are not used when type_
     // equals Type_Custom
     //
+    // If compressed_ is set, a CodecHeader and the compressed chunk data
+    // follow the header (and the property name of named chunks). The
+    // data decompresses to what would have been stored without it.
+    //
     struct Header // 16 bits long
     {
-      unsigned reserved_: SIZE_RESERVED;
+      unsigned compressed_: SIZE_COMPRESSED; // bool, was reserved (always 0)
       unsigned name_    : SIZE_NAME;   // 1 named property, 0 anonymous
       unsigned entity_  : SIZE_ENTITY; // 0 vertex, 1 mesh, 2 edge,
                                        // 4 halfedge, 6 face
       unsigned type_    : SIZE_TYPE;   // 0 pos, 1 normal, 2 texcoord,
                                        // 3 status, 4 color 6 custom 7 topology
+                                       // 8 connectivity
       unsigned signed_  : SIZE_SIGNED; // bool
       unsigned float_   : SIZE_FLOAT;  // bool
       unsigned dim_     : SIZE_DIM;    // 0 1D, 1 2D, 2 3D, .., 7 8D
@@ -248,6 +254,45 @@ namespace OMFormat {
     }; // struct Header
 
 
+    enum Codec {
+      Codec_None         = 0x00, // stored as is
+      Codec_DeltaVarint  = 0x01, // little endian integers (or float bit
+                                 // patterns) of width_ bytes, difference to
+                                 // the value stride_ elements before,
+                                 // zigzag and varint coded
+      Codec_LZ           = 0x02  // LZ77 byte compressor (LZ4 like sequences)
+    };
+
+    struct CodecHeader // 11 bytes long
+    {
+      uint8  codec_;       // Codec
+      uint8  width_;       // parameters of the codec
+      uint8  stride_;
+      uint32 raw_size_;    // size of the chunk data
+      uint32 packed_size_; // size of the compressed data that follows
+
+      size_t store( std::ostream& _os, bool _swap ) const
+      {
+        _os.write( (const char*)this, 3); // codec_, width_, stride_
+        size_t bytes = 3;
+        bytes += binary<uint32_t>::store( _os, raw_size_, _swap );
+        bytes += binary<uint32_t>::store( _os, packed_size_, _swap );
+        return bytes;
+      }
+
+      size_t restore( std::istream& _is, bool _swap )
+      {
+        if (_is.read( (char*)this, 3 ).eof())
+          return 0;
+
+        size_t bytes = 3;
+        bytes += binary<uint32_t>::restore( _is, raw_size_, _swap );
+        bytes += binary<uint32_t>::restore( _is, packed_size_, _swap );
+        return bytes;
+      }
+    };
+
+
     class PropertyName : public std::string
     {
     public:
@@ -296,7 +341,7 @@ namespace OMFormat {
   /// Return the size of a scale in bytes.
   inline size_t scalar_size( const Chunk::Header& _hdr )
   {
-    return _hdr.float_ ? (0x01 << _hdr.bits_) : (0x04 << _hdr.bits_);
+    return _hdr.float_ ? (0x04 << _hdr.bits_) : (0x01 << _hdr.bits_);
   }
 
 
@@ -469,6 +514,7 @@ namespace OMFormat {
   const char *as_string(Chunk::Dim d);
   const char *as_string(Chunk::Integer_Size d);
   const char *as_string(Chunk::Float_Size d);
+  const char *as_string(Chunk::Codec c);
 
   std::ostream& operator << ( std::ostream& _os, const Header& _h );
   std::ostream& operator << ( std::ostream& _os, const Chunk::Header& _c );
@@ -509,6 +555,17 @@ namespace OMFormat {
     return bytes;
   }
 
+  // -------------------- (re-)store codec header
+
+  template <> inline
+  size_t store( std::ostream& _os, const OMFormat::Chunk::CodecHeader& _hdr, bool _swap)
+  { return _hdr.store( _os, _swap ); }
+
+  template <> inline
+  size_t restore( std::istream& _is, OMFormat::Chunk::CodecHeader& _hdr, bool _swap )
+  { return _hdr.restore( _is, _swap ); }
+
+
   // -------------------- (re-)store integer with wanted number of bits (bytes)
 
   typedef GenProg::TrueType  t_signed;
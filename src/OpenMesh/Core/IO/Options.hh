@@ -116,7 +116,10 @@ public:
       ColorAlpha     = 0x0800, ///< Has (r) / store (w) alpha values for colors
       ColorFloat     = 0x1000, ///< Has (r) / store (w) float values for colors (currently only implemented for PLY and OFF files)
       Custom         = 0x2000, ///< Has (r)             custom properties (currently only implemented in PLY Reader ASCII version)
-      TexFile        = 0x4000  ///< Has (r) / store (w) texture file string
+      TexFile        = 0x4000, ///< Has (r) / store (w) texture file string
+      Connectivity   = 0x8000, ///< Has (r) / store (w) the raw half-edge connectivity (currently only implemented for OM files)
+      DeferredProperties = 0x10000, ///< Restore (r) fixed-size custom properties from the mapped file on first access of the property (currently only implemented for OM files)
+      Compressed     = 0x20000  ///< Has (r) / store (w) compressed chunks (currently only implemented for OM files)
   };
 
 public:
@@ -128,12 +128,85 @@ public:
   virtual Vec3f colorf(EdgeHandle _eh)    const = 0;
   virtual Vec4f colorAf(EdgeHandle _eh)   const = 0;
 
+  // get the data of the vertices [_begin,_begin+_n) into arrays of _n
+  // elements. Writers use these in bulk exports, the default
+  // implementations call the functions for single vertices above.
+  virtual void points(size_t _begin, size_t _n, Vec3f* _points) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _points[i] = point(VertexHandle(int(_begin + i)));
+  }
+
+  virtual void vertex_normals(size_t _begin, size_t _n, Vec3f* _normals) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _normals[i] = normal(VertexHandle(int(_begin + i)));
+  }
+
+  virtual void vertex_colorsA(size_t _begin, size_t _n, Vec4uc* _colors) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _colors[i] = colorA(VertexHandle(int(_begin + i)));
+  }
+
+  virtual void vertex_colorsAf(size_t _begin, size_t _n, Vec4f* _colors) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _colors[i] = colorAf(VertexHandle(int(_begin + i)));
+  }
+
+  virtual void vertex_texcoords(size_t _begin, size_t _n, Vec2f* _texcoords) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _texcoords[i] = texcoord(VertexHandle(int(_begin + i)));
+  }
+
+  // get the data of the faces [_begin,_begin+_n), see above
+  virtual void face_valences(size_t _begin, size_t _n, unsigned int* _valences) const
+  {
+    std::vector<VertexHandle> vhandles;
+    for (size_t i = 0; i < _n; ++i)
+      _valences[i] = get_vhandles(FaceHandle(int(_begin + i)), vhandles);
+  }
+
+  /// The vertex indices of all faces one after another, returns their number
+  virtual size_t face_vertex_indices(size_t _begin, size_t _n, int* _indices) const
+  {
+    std::vector<VertexHandle> vhandles;
+    size_t k = 0;
+    for (size_t i = 0; i < _n; ++i)
+    {
+      get_vhandles(FaceHandle(int(_begin + i)), vhandles);
+      for (size_t j = 0; j < vhandles.size(); ++j)
+        _indices[k++] = vhandles[j].idx();
+    }
+    return k;
+  }
+
+  virtual void face_colorsA(size_t _begin, size_t _n, Vec4uc* _colors) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _colors[i] = colorA(FaceHandle(int(_begin + i)));
+  }
+
+  virtual void face_colorsAf(size_t _begin, size_t _n, Vec4f* _colors) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _colors[i] = colorAf(FaceHandle(int(_begin + i)));
+  }
+
   // get mesh data
   virtual std::string texfile()   const = 0;
 
   // get reference to base kernel
   virtual const BaseKernel* kernel() { return 0; }
 
+  // get the raw half-edge connectivity, see ArrayKernel::get_connectivity()
+  virtual bool get_connectivity(std::vector<int>& /* _vertex_halfedges */,
+                                std::vector<int>& /* _halfedges */,
+                                std::vector<int>& /* _face_halfedges */) const
+  { return false; }
+
 
   // query number of faces, vertices, normals, texcoords
   virtual size_t n_vertices()   const = 0;
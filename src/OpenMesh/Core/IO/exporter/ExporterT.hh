@@ -61,6 +61,7 @@
 //=== INCLUDES ================================================================
 
 // C++
+#include <algorithm>
 #include <vector>
 
 // OpenMesh
@@ -196,14 +197,14 @@ public:
 
   Vec3f colorf(EdgeHandle _eh)    const
   {
-    return (mesh_.has_vertex_colors()
+    return (mesh_.has_edge_colors()
 	    ? color_cast<Vec3f>(mesh_.color(_eh))
 	    : Vec3f(0, 0, 0));
   }
 
   Vec4f colorAf(EdgeHandle _eh)   const
   {
-    return (mesh_.has_vertex_colors()
+    return (mesh_.has_edge_colors()
       ? color_cast<Vec4f>(mesh_.color(_eh))
       : Vec4f(0, 0, 0, 0));
   }
@@ -260,14 +261,14 @@ public:
 
   Vec3f colorf(FaceHandle _fh)    const
   {
-    return (mesh_.has_vertex_colors()
+    return (mesh_.has_face_colors()
 	    ? color_cast<Vec3f>(mesh_.color(_fh))
 	    : Vec3f(0, 0, 0));
   }
 
   Vec4f colorAf(FaceHandle _fh)   const
   {
-    return (mesh_.has_vertex_colors()
+    return (mesh_.has_face_colors()
       ? color_cast<Vec4f>(mesh_.color(_fh))
       : Vec4f(0, 0, 0, 0));
   }
@@ -283,6 +284,83 @@ public:
     }
   }
 
+  // get the data of ranges of vertices and faces, see BaseExporter
+
+  void points(size_t _begin, size_t _n, Vec3f* _points) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _points[i] = vector_cast<Vec3f>(mesh_.point(VertexHandle(int(_begin + i))));
+  }
+
+  void vertex_normals(size_t _begin, size_t _n, Vec3f* _normals) const
+  {
+    if (!mesh_.has_vertex_normals())
+      std::fill(_normals, _normals + _n, Vec3f(0.0f, 0.0f, 0.0f));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _normals[i] = vector_cast<Vec3f>(mesh_.normal(VertexHandle(int(_begin + i))));
+  }
+
+  void vertex_colorsA(size_t _begin, size_t _n, Vec4uc* _colors) const
+  {
+    if (!mesh_.has_vertex_colors())
+      std::fill(_colors, _colors + _n, Vec4uc(0, 0, 0, 0));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _colors[i] = color_cast<Vec4uc>(mesh_.color(VertexHandle(int(_begin + i))));
+  }
+
+  void vertex_colorsAf(size_t _begin, size_t _n, Vec4f* _colors) const
+  {
+    if (!mesh_.has_vertex_colors())
+      std::fill(_colors, _colors + _n, Vec4f(0, 0, 0, 0));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _colors[i] = color_cast<Vec4f>(mesh_.color(VertexHandle(int(_begin + i))));
+  }
+
+  void vertex_texcoords(size_t _begin, size_t _n, Vec2f* _texcoords) const
+  {
+    if (!mesh_.has_vertex_texcoords2D())
+      std::fill(_texcoords, _texcoords + _n, Vec2f(0.0f, 0.0f));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _texcoords[i] = vector_cast<Vec2f>(mesh_.texcoord2D(VertexHandle(int(_begin + i))));
+  }
+
+  void face_valences(size_t _begin, size_t _n, unsigned int* _valences) const
+  {
+    for (size_t i = 0; i < _n; ++i)
+      _valences[i] = mesh_.valence(FaceHandle(int(_begin + i)));
+  }
+
+  size_t face_vertex_indices(size_t _begin, size_t _n, int* _indices) const
+  {
+    size_t k = 0;
+    for (size_t i = 0; i < _n; ++i)
+      for (typename Mesh::CFVIter fv_it=mesh_.cfv_iter(FaceHandle(int(_begin + i))); fv_it.is_valid(); ++fv_it)
+        _indices[k++] = fv_it->idx();
+    return k;
+  }
+
+  void face_colorsA(size_t _begin, size_t _n, Vec4uc* _colors) const
+  {
+    if (!mesh_.has_face_colors())
+      std::fill(_colors, _colors + _n, Vec4uc(0, 0, 0, 0));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _colors[i] = color_cast<Vec4uc>(mesh_.color(FaceHandle(int(_begin + i))));
+  }
+
+  void face_colorsAf(size_t _begin, size_t _n, Vec4f* _colors) const
+  {
+    if (!mesh_.has_face_colors())
+      std::fill(_colors, _colors + _n, Vec4f(0, 0, 0, 0));
+    else
+      for (size_t i = 0; i < _n; ++i)
+        _colors[i] = color_cast<Vec4f>(mesh_.color(FaceHandle(int(_begin + i))));
+  }
+
   // get mesh data
 
   std::string texfile()   const
@@ -294,6 +372,14 @@ public:
 
   virtual const BaseKernel* kernel() { return &mesh_; }
 
+  virtual bool get_connectivity(std::vector<int>& _vertex_halfedges,
+                                std::vector<int>& _halfedges,
+                                std::vector<int>& _face_halfedges) const
+  {
+    mesh_.get_connectivity(_vertex_halfedges, _halfedges, _face_halfedges);
+    return true;
+  }
+
 
   // query number of faces, vertices, normals, texcoords
   size_t n_vertices()  const { return mesh_.n_vertices(); }
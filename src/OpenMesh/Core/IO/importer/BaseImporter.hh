@@ -103,6 +103,22 @@ public:
   typedef std::vector<VertexHandle> VHandles;
   virtual FaceHandle add_face(const VHandles& _indices) = 0;
 
+  // add many faces, given one after the other by their _face_sizes,
+  // returns the number of faces added
+  virtual size_t add_faces(const VHandles& _indices, const std::vector<unsigned int>& _face_sizes)
+  {
+    size_t   n_added = 0;
+    VHandles face;
+    VHandles::const_iterator it = _indices.begin();
+    for (size_t f = 0; f < _face_sizes.size(); it += _face_sizes[f++])
+    {
+      face.assign(it, it + _face_sizes[f]);
+      if (add_face(face).is_valid())
+        ++n_added;
+    }
+    return n_added;
+  }
+
   // add texture coordinates per face, _vh references the first texcoord
   virtual void add_face_texcoords( FaceHandle _fh, VertexHandle _vh, const std::vector<Vec2f>& _face_texcoords) = 0;
 
@@ -177,6 +193,13 @@ public:
 		                  unsigned int /* nE */,
 		                  unsigned int /* nF */) {}
 
+  // create all edges and faces from the raw half-edge connectivity,
+  // see ArrayKernel::set_connectivity()
+  virtual bool set_connectivity(const std::vector<int>& /* _vertex_halfedges */,
+                                const std::vector<int>& /* _halfedges */,
+                                const std::vector<int>& /* _face_halfedges */)
+  { return false; }
+
   // query number of faces, vertices, normals, texcoords
   virtual size_t n_vertices()   const = 0;
   virtual size_t n_faces()      const = 0;
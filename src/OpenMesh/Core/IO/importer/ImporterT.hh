@@ -112,27 +112,8 @@ public:
 
     if (_indices.size() > 2)
     {
-      VHandles::const_iterator it, it2, end(_indices.end());
-
-
-      // test for valid vertex indices
-      for (it=_indices.begin(); it!=end; ++it)
-        if (! mesh_.is_valid_handle(*it))
-        {
-          omerr() << "ImporterT: Face contains invalid vertex index\n";
-          return fh;
-        }
-
-
-      // don't allow double vertices
-      for (it=_indices.begin(); it!=end; ++it)
-        for (it2=it+1; it2!=end; ++it2)
-          if (*it == *it2)
-          {
-            omerr() << "ImporterT: Face has equal vertices\n";
-            failed_faces_.push_back(_indices);
-            return fh;
-          }
+      if (!check_face(_indices.begin(), _indices.end()))
+        return fh;
 
 
       // try to add face
@@ -163,6 +144,56 @@ public:
     return fh;
   }
 
+  virtual size_t add_faces(const VHandles& _indices, const std::vector<unsigned int>& _face_sizes)
+  {
+    // halfedge normals are assigned face by face in add_face()
+    if (mesh_.has_halfedge_normals())
+      return BaseImporter::add_faces(_indices, _face_sizes);
+
+    // Faces that do not pass the checks of add_face() are left out, the
+    // faces are only copied if there are any.
+    VHandles                  indices;
+    std::vector<unsigned int> face_sizes;
+    bool                      copied = false;
+
+    size_t offset = 0;
+    for (size_t f = 0; f < _face_sizes.size(); offset += _face_sizes[f++])
+    {
+      const unsigned int n = _face_sizes[f];
+      const bool passed = n > 2 &&
+        check_face(_indices.begin() + offset, _indices.begin() + offset + n);
+
+      if (!passed && !copied)
+      {
+        indices.assign(_indices.begin(), _indices.begin() + offset);
+        face_sizes.assign(_face_sizes.begin(), _face_sizes.begin() + f);
+        copied = true;
+      }
+      else if (passed && copied)
+      {
+        indices.insert(indices.end(), _indices.begin() + offset, _indices.begin() + offset + n);
+        face_sizes.push_back(n);
+      }
+    }
+
+    const VHandles&                  add_indices = copied ? indices    : _indices;
+    const std::vector<unsigned int>& add_sizes   = copied ? face_sizes : _face_sizes;
+    if (add_sizes.empty())
+      return 0;
+
+    std::vector<FaceHandle> fhandles(add_sizes.size());
+    const size_t n_added = mesh_.add_faces(&add_indices[0], &add_sizes[0], add_sizes.size(), &fhandles[0]);
+
+    // faces that could not be added are failed faces, as in add_face()
+    offset = 0;
+    for (size_t f = 0; f < add_sizes.size(); offset += add_sizes[f++])
+      if (!fhandles[f].is_valid())
+        failed_faces_.push_back(VHandles(add_indices.begin() + offset,
+                                         add_indices.begin() + offset + add_sizes[f]));
+
+    return n_added;
+  }
+
   // vertex attributes
 
   virtual void set_point(VertexHandle _vh, const Vec3f& _point)
@@ -329,6 +360,13 @@ public:
     mesh_.reserve(nV, nE, nF);
   }
 
+  bool set_connectivity(const std::vector<int>& _vertex_halfedges,
+                        const std::vector<int>& _halfedges,
+                        const std::vector<int>& _face_halfedges)
+  {
+    return mesh_.set_connectivity(_vertex_halfedges, _halfedges, _face_halfedges);
+  }
+
   // query number of faces, vertices, normals, texcoords
   size_t n_vertices()  const { return mesh_.n_vertices(); }
   size_t n_faces()     const { return mesh_.n_faces(); }
@@ -387,6 +425,32 @@ public:
 
 private:
 
+  // Test for valid vertex indices and don't allow double vertices. A face
+  // with double vertices is a failed face.
+  bool check_face(VHandles::const_iterator _begin, VHandles::const_iterator _end)
+  {
+    VHandles::const_iterator it, it2;
+
+    for (it=_begin; it!=_end; ++it)
+      if (! mesh_.is_valid_handle(*it))
+      {
+        omerr() << "ImporterT: Face contains invalid vertex index\n";
+        return false;
+      }
+
+    for (it=_begin; it!=_end; ++it)
+      for (it2=it+1; it2!=_end; ++it2)
+        if (*it == *it2)
+        {
+          omerr() << "ImporterT: Face has equal vertices\n";
+          failed_faces_.push_back(VHandles(_begin, _end));
+          return false;
+        }
+
+    return true;
+  }
+
+
   Mesh& mesh_;
   std::vector<VHandles>  failed_faces_;
   // stores normals for halfedges of the next face
@@ -0,0 +1,323 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+//=============================================================================
+//
+//  Implements an importer module delivering the file in batches
+//
+//=============================================================================
+
+
+#ifndef __STREAMIMPORTER_HH__
+#define __STREAMIMPORTER_HH__
+
+
+//=== INCLUDES ================================================================
+
+
+#include <OpenMesh/Core/IO/importer/BaseImporter.hh>
+#include <OpenMesh/Core/Utils/color_cast.hh>
+
+// STL
+#include <vector>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace IO {
+
+
+//=== IMPLEMENTATION ==========================================================
+
+
+/// Consecutive vertices of a file, see StreamImporter
+struct VertexBatch
+{
+  VertexBatch() : first(0) {}
+
+  /// Number of vertices in the batch
+  size_t size() const { return points.size(); }
+
+  /// Index of the first vertex of the batch in the file
+  size_t first;
+
+  /// Vertex coordinates
+  std::vector<Vec3f>  points;
+
+  /// Vertex normals, empty if the batch has none
+  std::vector<Vec3f>  normals;
+
+  /// Vertex colors, empty if the batch has none
+  std::vector<Vec4uc> colors;
+
+  /// Vertex texture coordinates, empty if the batch has none
+  std::vector<Vec2f>  texcoords;
+};
+
+
+/// Consecutive faces of a file, see StreamImporter
+struct FaceBatch
+{
+  FaceBatch() : first(0), offsets(1, 0) {}
+
+  /// Number of faces in the batch
+  size_t size() const { return offsets.size() - 1; }
+
+  /// Number of vertices of the i'th face of the batch
+  size_t valence(size_t _i) const { return offsets[_i+1] - offsets[_i]; }
+
+  /// Vertex indices of the i'th face of the batch
+  const int* face(size_t _i) const { return &indices[offsets[_i]]; }
+
+  /// Index of the first face of the batch in the file
+  size_t first;
+
+  /// Vertex indices (in the file) of all faces of the batch
+  std::vector<int>    indices;
+
+  /// Start of each face in indices followed by the end of the last face
+  std::vector<size_t> offsets;
+};
+
+
+/** Receives the batches of a StreamImporter. A face batch is delivered
+    after all vertices its faces refer to.
+*/
+class OPENMESHDLLEXPORT StreamCallback
+{
+public:
+
+  virtual ~StreamCallback() {}
+
+  /// Called for each batch of vertices
+  virtual void vertices(const VertexBatch& _batch) = 0;
+
+  /// Called for each batch of faces
+  virtual void faces(const FaceBatch& _batch) = 0;
+};
+
+
+/**
+ *  This importer does not build a mesh. It collects the vertices and
+ *  faces produced by a reader in batches of a fixed size and passes them
+ *  to a StreamCallback, so the importer needs no memory depending on the
+ *  size of the file (the reader itself may, see read_stream()). The vertex
+ *  handles returned are the indices in the file, no connectivity is
+ *  created.
+ *
+ *  Attributes of vertices that have already been delivered are dropped,
+ *  as are face, edge and halfedge attributes. Readers which need a mesh
+ *  kernel (OM, custom PLY properties) are not supported.
+ */
+class StreamImporter : public BaseImporter
+{
+public:
+
+  /// Deliver batches of up to _batch_size vertices and faces to _callback
+  StreamImporter(StreamCallback& _callback, size_t _batch_size = 65536)
+  : callback_(_callback), batch_size_(_batch_size ? _batch_size : 1),
+    n_vertices_(0), n_faces_(0)
+  {}
+
+
+  virtual VertexHandle add_vertex(const Vec3f& _point)
+  {
+    if (vertices_.size() == batch_size_)
+      flush_vertices();
+    vertices_.points.push_back(_point);
+    if (!vertices_.normals.empty())   vertices_.normals.resize(vertices_.size());
+    if (!vertices_.colors.empty())    vertices_.colors.resize(vertices_.size());
+    if (!vertices_.texcoords.empty()) vertices_.texcoords.resize(vertices_.size());
+    return VertexHandle(int(n_vertices_++));
+  }
+
+  virtual VertexHandle add_vertex()
+  {
+    return add_vertex(Vec3f(0.0f, 0.0f, 0.0f));
+  }
+
+  virtual FaceHandle add_face(const VHandles& _indices)
+  {
+    if (faces_.size() == batch_size_)
+      flush_faces();
+    for (size_t i = 0; i < _indices.size(); ++i)
+      faces_.indices.push_back(_indices[i].idx());
+    faces_.offsets.push_back(faces_.indices.size());
+    return FaceHandle(int(n_faces_++));
+  }
+
+  // vertex attributes
+
+  virtual void set_point(VertexHandle _vh, const Vec3f& _point)
+  {
+    const int i = index(_vh);
+    if (i >= 0) vertices_.points[i] = _point;
+  }
+
+  virtual void set_normal(VertexHandle _vh, const Vec3f& _normal)
+  {
+    const int i = index(_vh);
+    if (i < 0) return;
+    vertices_.normals.resize(vertices_.size());
+    vertices_.normals[i] = _normal;
+  }
+
+  virtual void set_color(VertexHandle _vh, const Vec4uc& _color)
+  {
+    const int i = index(_vh);
+    if (i < 0) return;
+    vertices_.colors.resize(vertices_.size());
+    vertices_.colors[i] = _color;
+  }
+
+  virtual void set_color(VertexHandle _vh, const Vec3uc& _color)
+  { set_color(_vh, color_cast<Vec4uc>(_color)); }
+
+  virtual void set_color(VertexHandle _vh, const Vec3f& _color)
+  { set_color(_vh, color_cast<Vec4uc>(_color)); }
+
+  virtual void set_color(VertexHandle _vh, const Vec4f& _color)
+  { set_color(_vh, color_cast<Vec4uc>(_color)); }
+
+  virtual void set_texcoord(VertexHandle _vh, const Vec2f& _texcoord)
+  {
+    const int i = index(_vh);
+    if (i < 0) return;
+    vertices_.texcoords.resize(vertices_.size());
+    vertices_.texcoords[i] = _texcoord;
+  }
+
+  // not streamed
+
+  virtual void set_texcoord(HalfedgeHandle, const Vec2f&) {}
+  virtual void add_face_texcoords(FaceHandle, VertexHandle, const std::vector<Vec2f>&) {}
+  virtual void set_face_texindex(FaceHandle, int) {}
+  virtual void set_color(EdgeHandle, const Vec3uc&) {}
+  virtual void set_color(EdgeHandle, const Vec4uc&) {}
+  virtual void set_color(EdgeHandle, const Vec3f&) {}
+  virtual void set_color(EdgeHandle, const Vec4f&) {}
+  virtual void set_normal(FaceHandle, const Vec3f&) {}
+  virtual void set_color(FaceHandle, const Vec3uc&) {}
+  virtual void set_color(FaceHandle, const Vec4uc&) {}
+  virtual void set_color(FaceHandle, const Vec3f&) {}
+  virtual void set_color(FaceHandle, const Vec4f&) {}
+  virtual void set_texfile(const std::string&) {}
+  virtual void add_texture_information(int, std::string) {}
+
+  // query number of vertices and faces read so far
+
+  virtual size_t n_vertices() const { return n_vertices_; }
+  virtual size_t n_faces()    const { return n_faces_; }
+  virtual size_t n_edges()    const { return 0; }
+
+  virtual void prepare()
+  {
+    vertices_ = VertexBatch();
+    faces_    = FaceBatch();
+    n_vertices_ = n_faces_ = 0;
+  }
+
+  /// Deliver the remaining vertices and faces
+  virtual void finish()
+  {
+    flush_faces();
+    flush_vertices();
+  }
+
+private:
+
+  // index of _vh in the current vertex batch, -1 if delivered already
+  int index(VertexHandle _vh) const
+  {
+    const int i = _vh.idx() - int(vertices_.first);
+    return (i >= 0 && size_t(i) < vertices_.size()) ? i : -1;
+  }
+
+  void flush_vertices()
+  {
+    if (vertices_.size() == 0)
+      return;
+    callback_.vertices(vertices_);
+    vertices_.first = n_vertices_;
+    vertices_.points.clear();
+    vertices_.normals.clear();
+    vertices_.colors.clear();
+    vertices_.texcoords.clear();
+  }
+
+  void flush_faces()
+  {
+    if (faces_.size() == 0)
+      return;
+    // the faces may refer to vertices of the current batch
+    flush_vertices();
+    callback_.faces(faces_);
+    faces_.first = n_faces_;
+    faces_.indices.clear();
+    faces_.offsets.resize(1);
+  }
+
+  StreamCallback& callback_;
+  size_t          batch_size_;
+  size_t          n_vertices_;
+  size_t          n_faces_;
+  VertexBatch     vertices_;
+  FaceBatch       faces_;
+};
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif
+//=============================================================================
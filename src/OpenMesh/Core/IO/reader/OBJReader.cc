@@ -73,9 +73,13 @@ using std::isspace;
 
 #include <istream>
 #include <fstream>
+#include <sstream>
+#include <locale>
 #include <vector>
 #include <algorithm>
 #include <functional>
+#include <cfloat>
+#include <cstring>
 
 //=== NAMESPACES ==============================================================
 
@@ -121,6 +125,165 @@ void remove_duplicated_vertices(BaseImporter::VHandles& _indices)
 
 //-----------------------------------------------------------------------------
 
+#ifndef DOXY_IGNORE_THIS
+
+// Allocation free parsing of the frequent line types (v, vt, vn, vc, f).
+// The functions work on the character range [_p,_end) of the current line,
+// advance _p behind the parsed token and mimic the behavior of the
+// std::istream operator>> previously used for these lines.
+
+static inline bool is_space(char _c)
+{
+  return _c == ' ' || _c == '\t' || _c == '\r' || _c == '\n' || _c == '\v' || _c == '\f';
+}
+
+static inline bool is_digit(char _c)
+{
+  return _c >= '0' && _c <= '9';
+}
+
+static inline void skip_spaces(const char*& _p, const char* _end)
+{
+  while (_p != _end && is_space(*_p))
+    ++_p;
+}
+
+static inline const char* find_space(const char* _p, const char* _end)
+{
+  while (_p != _end && !is_space(*_p))
+    ++_p;
+  return _p;
+}
+
+/// Parse an integer, returns false if no digits were found
+static bool parse_int(const char*& _p, const char* _end, int& _value)
+{
+  skip_spaces(_p, _end);
+
+  const char* p = _p;
+  bool negative = false;
+
+  if (p != _end && (*p == '-' || *p == '+'))
+    negative = (*p++ == '-');
+
+  if (p == _end || !is_digit(*p))
+    return false;
+
+  // checked before accumulating, long has only 32 bits on some platforms
+  unsigned int value    = 0;
+  bool         overflow = false;
+  for (; p != _end && is_digit(*p); ++p) {
+    const unsigned int digit = unsigned(*p - '0');
+    if (value > (0x7fffffffu - digit) / 10)
+      overflow = true;
+    else
+      value = 10 * value + digit;
+  }
+
+  if (overflow)
+    return false;
+
+  _value = negative ? -int(value) : int(value);
+  _p     = p;
+  return true;
+}
+
+/// Parse a decimal floating point number, returns false if no digits were found
+static bool parse_float(const char*& _p, const char* _end, float& _value)
+{
+  // Powers of ten that are exactly representable as float
+  static const float powers_of_ten[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f,
+                                 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+  skip_spaces(_p, _end);
+
+  const char* p     = _p;
+  const char* start = p;
+  bool negative = false;
+
+  if (p != _end && (*p == '-' || *p == '+'))
+    negative = (*p++ == '-');
+
+  // mantissa digits, as long as they fit exactly into a float
+  unsigned int mantissa = 0;
+  bool         exact    = true;
+  int          digits   = 0;
+  int          exponent = 0;
+
+  for (; p != _end && is_digit(*p); ++p, ++digits) {
+    if (mantissa < (1u << 24) / 10)
+      mantissa = 10 * mantissa + (*p - '0');
+    else
+      exact = false;
+  }
+
+  if (p != _end && *p == '.') {
+    ++p;
+    for (; p != _end && is_digit(*p); ++p, ++digits) {
+      if (mantissa < (1u << 24) / 10) {
+        mantissa = 10 * mantissa + (*p - '0');
+        --exponent;
+      }
+      else
+        exact = false;
+    }
+  }
+
+  if (digits == 0)
+    return false;
+
+  // optional exponent, only if at least one digit follows
+  if (p != _end && (*p == 'e' || *p == 'E')) {
+    const char* e = p + 1;
+    bool exp_negative = false;
+
+    if (e != _end && (*e == '-' || *e == '+'))
+      exp_negative = (*e++ == '-');
+
+    if (e != _end && is_digit(*e)) {
+      int exp_value = 0;
+      for (; e != _end && is_digit(*e); ++e)
+        if (exp_value < 10000)
+          exp_value = 10 * exp_value + (*e - '0');
+      exponent += exp_negative ? -exp_value : exp_value;
+      p = e;
+    }
+  }
+
+#if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+  // Mantissa and power of ten are exact, so a single IEEE operation gives
+  // the correctly rounded result.
+  if (exact && exponent >= -10 && exponent <= 10) {
+    float value = float(mantissa);
+    if (exponent < 0)
+      value /= powers_of_ten[-exponent];
+    else
+      value *= powers_of_ten[exponent];
+    _value = negative ? -value : value;
+    _p     = p;
+    return true;
+  }
+#else
+  (void)powers_of_ten;
+  (void)exact;
+#endif
+
+  // Slow path for long mantissas or large exponents. The stream uses the
+  // classic locale, strtod() would depend on the C locale of the
+  // application (decimal comma) and round twice.
+  std::istringstream number(std::string(start, p));
+  number.imbue(std::locale::classic());
+  float value = 0.0f;
+  number >> value;
+  _value = value;
+  _p     = p;
+  return true;
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+
 _OBJReader_::
 _OBJReader_()
 {
@@ -146,18 +309,19 @@ read(const std::string& _filename, BaseImporter& _bi, Options& _opt)
     return false;
   }
 
+  std::string path;
   {
 #if defined(WIN32)
     std::string::size_type dot = _filename.find_last_of("\\/");
 #else
     std::string::size_type dot = _filename.rfind("/");
 #endif
-    path_ = (dot == std::string::npos)
+    path = (dot == std::string::npos)
       ? "./"
       : std::string(_filename.substr(0,dot+1));
   }
 
-  bool result = read(in, _bi, _opt);
+  bool result = read(in, _bi, _opt, path);
 
   in.close();
   return result;
@@ -167,7 +331,7 @@ read(const std::string& _filename, BaseImporter& _bi, Options& _opt)
 
 bool
 _OBJReader_::
-read_material(std::istream& _in)
+read_material(std::istream& _in, MaterialList& _materials)
 {
   std::string line;
   std::string keyWrd;
@@ -180,7 +344,7 @@ read_material(std::istream& _in)
   int         textureId = 1;
 
 
-  materials_.clear();
+  _materials.clear();
   mat.cleanup();
 
   while( _in && !_in.eof() )
@@ -202,7 +366,7 @@ read_material(std::istream& _in)
     {
       if (indef && !key.empty() && mat.is_valid())
       {
-        materials_[key] = mat;
+        _materials[key] = mat;
         mat.cleanup();
       }
     }
@@ -280,7 +444,7 @@ read_material(std::istream& _in)
     }
 
     if ( _in && indef && mat.is_valid() && !key.empty())
-      materials_[key] = mat;
+      _materials[key] = mat;
   }
   return true;
 }
@@ -290,6 +454,15 @@ read_material(std::istream& _in)
 bool
 _OBJReader_::
 read(std::istream& _in, BaseImporter& _bi, Options& _opt)
+{
+  return read(_in, _bi, _opt, std::string());
+}
+
+//-----------------------------------------------------------------------------
+
+bool
+_OBJReader_::
+read(std::istream& _in, BaseImporter& _bi, Options& _opt, const std::string& _path)
 {
 
   std::string line;
@@ -303,8 +476,10 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
   std::vector<Vec2f>        texcoords;
   std::vector<Vec2f>        face_texcoords;
   std::vector<VertexHandle> vertexHandles;
+  BaseImporter::VHandles    faceVertices;
 
   std::string               matname;
+  MaterialList              materials;
 
 
   // Options supplied by the user
@@ -322,87 +497,32 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
       return false;
     }
 
-    // Trim Both leading and trailing spaces
-    trimString(line);
+    // Trim Both leading and trailing spaces (without copying the line)
+    const char* begin = line.c_str();
+    const char* end   = begin + line.size();
+
+    while (begin != end && (*begin == ' ' || *begin == '\t' || *begin == '\r' || *begin == '\n'))
+      ++begin;
+    while (end != begin && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n'))
+      --end;
 
     // comment
-    if ( line.size() == 0 || line[0] == '#' || isspace(line[0]) ) {
+    if ( begin == end || *begin == '#' || is_space(*begin) ) {
       continue;
     }
 
-    std::stringstream stream(line);
-
-    stream >> keyWrd;
-
-    // material file
-    if (keyWrd == "mtllib")
-    {
-      std::string matFile;
-
-      // Get the rest of the line, removing leading or trailing spaces
-      // This will define the filename of the texture
-      std::getline(stream,matFile);
-      trimString(matFile);
-
-      matFile = path_ + matFile;
-
-      //omlog() << "Load material file " << matFile << std::endl;
-
-      std::ifstream matStream;
-      openRead(matFile, _opt, matStream);
-
-      if ( matStream ){
-
-        if ( !read_material( matStream ) )
-	        omerr() << "  Warning! Could not read file properly!\n";
-        matStream.close();
-
-      }else
-	      omerr() << "  Warning! Material file '" << matFile << "' not found!\n";
-
-      //omlog() << "  " << materials_.size() << " materials loaded.\n";
-
-      if ( !materials_.empty() ) {
-        Material& material = materials_.begin()->second;
-        if ( material.has_map_Kd() ) {
-          _bi.set_texfile(material.map_Kd());
-        }
-      }
-
-      /*
-      for ( MaterialList::iterator material = materials_.begin(); material != materials_.end(); ++material )
-      {
-        // Save the texture information in a property
-        if ( (*material).second.has_map_Kd() )
-          _bi.add_texture_information( (*material).second.map_Kd_index() , (*material).second.map_Kd() );
-      }
-      */
-
-    }
-
-    // usemtl
-    else if (keyWrd == "usemtl")
-    {
-      stream >> matname;
-      if (materials_.find(matname)==materials_.end())
-      {
-        omerr() << "Warning! Material '" << matname
-              << "' not defined in material file.\n";
-        matname="";
-      }
-    }
+    // keyword
+    const char*  p       = find_space(begin, end);
+    const size_t keySize = size_t(p - begin);
 
     // vertex
-    else if (keyWrd == "v")
+    if (keySize == 1 && begin[0] == 'v')
     {
-      stream >> x; stream >> y; stream >> z;
-
-      if ( !stream.fail() )
+      if ( parse_float(p, end, x) && parse_float(p, end, y) && parse_float(p, end, z) )
       {
         vertexHandles.push_back(_bi.add_vertex(OpenMesh::Vec3f(x,y,z)));
-        stream >> r; stream >> g; stream >> b;
 
-        if ( !stream.fail() )
+        if ( parse_float(p, end, r) && parse_float(p, end, g) && parse_float(p, end, b) )
         {
           if (  userOptions.vertex_has_color() ) {
             fileOptions += Options::VertexColor;
@@ -413,11 +533,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     }
 
     // texture coord
-    else if (keyWrd == "vt")
+    else if (keySize == 2 && begin[0] == 'v' && begin[1] == 't')
     {
-      stream >> u; stream >> v;
-
-      if ( !stream.fail()  ){
+      if ( parse_float(p, end, u) && parse_float(p, end, v) ){
 
         if ( userOptions.vertex_has_texcoord() || userOptions.face_has_texcoord() ) {
           texcoords.push_back(OpenMesh::Vec2f(u, v));
@@ -436,11 +554,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     }
 
     // color per vertex
-    else if (keyWrd == "vc")
+    else if (keySize == 2 && begin[0] == 'v' && begin[1] == 'c')
     {
-      stream >> r; stream >> g; stream >> b;
-
-      if ( !stream.fail()   ){
+      if ( parse_float(p, end, r) && parse_float(p, end, g) && parse_float(p, end, b) ){
         if ( userOptions.vertex_has_color() ) {
           colors.push_back(OpenMesh::Vec3f(r,g,b));
           fileOptions += Options::VertexColor;
@@ -449,11 +565,9 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
     }
 
     // normal
-    else if (keyWrd == "vn")
+    else if (keySize == 2 && begin[0] == 'v' && begin[1] == 'n')
     {
-      stream >> x; stream >> y; stream >> z;
-
-      if ( !stream.fail() ) {
+      if ( parse_float(p, end, x) && parse_float(p, end, y) && parse_float(p, end, z) ) {
         if (userOptions.vertex_has_normal() ){
           normals.push_back(OpenMesh::Vec3f(x,y,z));
           fileOptions += Options::VertexNormal;
@@ -461,46 +575,36 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
       }
     }
 
-
     // face
-    else if (keyWrd == "f")
+    else if (keySize == 1 && begin[0] == 'f')
     {
-      int component(0), nV(0);
       int value;
 
       vhandles.clear();
       face_texcoords.clear();
 
-      // read full line after detecting a face
-      std::string faceLine;
-      std::getline(stream,faceLine);
-      std::stringstream lineData( faceLine );
-
       FaceHandle fh;
-      BaseImporter::VHandles faceVertices;
+      faceVertices.clear();
 
       // work on the line until nothing left to read
-      while ( !lineData.eof() )
+      for (skip_spaces(p, end); p != end; skip_spaces(p, end))
       {
-        // read one block from the line ( vertex/texCoord/normal )
-        std::string vertex;
-        lineData >> vertex;
+        // one block from the line ( vertex/texCoord/normal )
+        const char* vertexEnd = find_space(p, end);
+        int component = 0;
 
-        do{
+        while ( p != vertexEnd ) {
 
           //get the component (vertex/texCoord/normal)
-          size_t found=vertex.find("/");
+          const char* found = std::find(p, vertexEnd, '/');
 
           // parts are seperated by '/' So if no '/' found its the last component
-          if( found != std::string::npos ){
-
-            // read the index value
-            std::stringstream tmp( vertex.substr(0,found) );
+          if ( found != vertexEnd ) {
 
             // If we get an empty string this property is undefined in the file
-            if ( vertex.substr(0,found).empty() ) {
+            if ( found == p ) {
               // Switch to next field
-              vertex = vertex.substr(found+1);
+              p = found + 1;
 
               // Now we are at the next component
               ++component;
@@ -510,22 +614,22 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
             }
 
             // Read current value
-            tmp >> value;
+            if ( !parse_int(p, found, value) )
+              value = 0;
 
             // remove the read part from the string
-            vertex = vertex.substr(found+1);
+            p = found + 1;
 
           } else {
 
             // last component of the vertex, read it.
-            std::stringstream tmp( vertex );
-            tmp >> value;
+            bool ok = parse_int(p, vertexEnd, value);
 
-            // Clear vertex after finished reading the line
-            vertex="";
+            // Done with this vertex
+            p = vertexEnd;
 
             // Nothing to read here ( garbage at end of line )
-            if ( tmp.fail() ) {
+            if ( !ok ) {
               continue;
             }
           }
@@ -546,7 +650,7 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
               if (fileOptions.vertex_has_color() )
                 _bi.set_color(vhandles.back(), colors[value-1]);
               break;
-	      
+
             case 1: // texture coord
               if ( value < 0 ) {
                 // Calculation of index :
@@ -599,13 +703,7 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
 
           // Prepare for reading next component
           ++component;
-
-          // Read until line does not contain any other info
-        } while ( !vertex.empty() );
-
-        component = 0;
-        nV++;
-
+        }
       }
 
       // note that add_face can possibly triangulate the faces, which is why we have to
@@ -627,7 +725,7 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
         for( size_t i=0; i < _bi.n_faces()-n_faces; ++i )
           newfaces.push_back(FaceHandle(int(n_faces+i)));
 
-        Material& mat = materials_[matname];
+        Material& mat = materials[matname];
 
         if ( mat.has_Kd() ) {
           Vec3uc fc = color_cast<Vec3uc, Vec3f>(mat.Kd());
@@ -665,17 +763,77 @@ read(std::istream& _in, BaseImporter& _bi, Options& _opt)
         }
 
       } else {
-        std::vector<FaceHandle> newfaces;
-
-        for( size_t i=0; i < _bi.n_faces()-n_faces; ++i )
-          newfaces.push_back(FaceHandle(int(n_faces+i)));
 
         // Set the texture index to zero as we don't have any information
         if ( userOptions.face_has_texcoord() )
-          for (std::vector<FaceHandle>::iterator it = newfaces.begin(); it != newfaces.end(); ++it)
-            _bi.set_face_texindex(*it, 0);
+          for( size_t i=0; i < _bi.n_faces()-n_faces; ++i )
+            _bi.set_face_texindex(FaceHandle(int(n_faces+i)), 0);
+      }
+
+    }
+
+    // material file
+    else if (keySize == 6 && strncmp(begin, "mtllib", 6) == 0)
+    {
+      std::stringstream stream(std::string(begin, end));
+      stream >> keyWrd;
+
+      std::string matFile;
+
+      // Get the rest of the line, removing leading or trailing spaces
+      // This will define the filename of the texture
+      std::getline(stream,matFile);
+      trimString(matFile);
+
+      matFile = _path + matFile;
+
+      //omlog() << "Load material file " << matFile << std::endl;
+
+      std::ifstream matStream;
+      openRead(matFile, _opt, matStream);
+
+      if ( matStream ){
+
+        if ( !read_material( matStream, materials ) )
+	        omerr() << "  Warning! Could not read file properly!\n";
+        matStream.close();
+
+      }else
+	      omerr() << "  Warning! Material file '" << matFile << "' not found!\n";
+
+      //omlog() << "  " << materials.size() << " materials loaded.\n";
+
+      if ( !materials.empty() ) {
+        Material& material = materials.begin()->second;
+        if ( material.has_map_Kd() ) {
+          _bi.set_texfile(material.map_Kd());
+        }
       }
 
+      /*
+      for ( MaterialList::iterator material = materials.begin(); material != materials.end(); ++material )
+      {
+        // Save the texture information in a property
+        if ( (*material).second.has_map_Kd() )
+          _bi.add_texture_information( (*material).second.map_Kd_index() , (*material).second.map_Kd() );
+      }
+      */
+
+    }
+
+    // usemtl
+    else if (keySize == 6 && strncmp(begin, "usemtl", 6) == 0)
+    {
+      std::stringstream stream(std::string(begin, end));
+      stream >> keyWrd;
+
+      stream >> matname;
+      if (materials.find(matname)==materials.end())
+      {
+        omerr() << "Warning! Material '" << matname
+              << "' not defined in material file.\n";
+        matname="";
+      }
     }
 
   }
@@ -166,13 +166,14 @@ private:
 
   typedef std::map<std::string, Material> MaterialList;
 
-  MaterialList materials_;
-
-  bool read_material( std::istream& _in );
-
-private:
+  /// Read a file whose material files are looked up relative to \c _path.
+  /// All state of a read is local to this call.
+  bool read(std::istream& _in,
+            BaseImporter& _bi,
+            Options& _opt,
+            const std::string& _path);
 
-  std::string path_;
+  bool read_material( std::istream& _in, MaterialList& _materials );
 
 };
 
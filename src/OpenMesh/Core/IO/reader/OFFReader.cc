@@ -151,25 +151,33 @@ _OFFReader_::read(std::istream& _in, BaseImporter& _bi, Options& _opt )
    // filter relevant options for reading
    bool swap = _opt.check( Options::Swap );
 
+   //options that the user wants to read
+   Options userOptions = _opt;
 
-   userOptions_ = _opt;
+   //available options for reading, announced in the header line
+   Options options;
+   if ( !can_u_read(_in, options) )
+   {
+     omerr() << "[OFFReader] : invalid header" << std::endl;
+     return false;
+   }
 
    // build options to be returned
    _opt.clear();
 
-   if (options_.vertex_has_normal() && userOptions_.vertex_has_normal())     _opt += Options::VertexNormal;
-   if (options_.vertex_has_texcoord() && userOptions_.vertex_has_texcoord()) _opt += Options::VertexTexCoord;
-   if (options_.vertex_has_color() && userOptions_.vertex_has_color())       _opt += Options::VertexColor;
-   if (options_.face_has_color() && userOptions_.face_has_color())           _opt += Options::FaceColor;
-   if (options_.is_binary())                                                 _opt += Options::Binary;
+   if (options.vertex_has_normal() && userOptions.vertex_has_normal())     _opt += Options::VertexNormal;
+   if (options.vertex_has_texcoord() && userOptions.vertex_has_texcoord()) _opt += Options::VertexTexCoord;
+   if (options.vertex_has_color() && userOptions.vertex_has_color())       _opt += Options::VertexColor;
+   if (options.face_has_color() && userOptions.face_has_color())           _opt += Options::FaceColor;
+   if (options.is_binary())                                                _opt += Options::Binary;
 
    //force user-choice for the alpha value when reading binary
-   if ( options_.is_binary() && userOptions_.color_has_alpha() )
-     options_ += Options::ColorAlpha;
+   if ( options.is_binary() && userOptions.color_has_alpha() )
+     options += Options::ColorAlpha;
 
-    return (options_.is_binary() ?
- 	   read_binary(_in, _bi, _opt, swap) :
-	   read_ascii(_in, _bi, _opt));
+    return (options.is_binary() ?
+ 	   read_binary(_in, _bi, _opt, swap, options, userOptions) :
+	   read_ascii(_in, _bi, _opt, options, userOptions));
 
 }
 
@@ -178,7 +186,8 @@ _OFFReader_::read(std::istream& _in, BaseImporter& _bi, Options& _opt )
 //-----------------------------------------------------------------------------
 
 bool
-_OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) const
+_OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt,
+                        const Options& _options, const Options& _userOptions) const
 {
 
 
@@ -193,9 +202,7 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
   BaseImporter::VHandles  vhandles;
   VertexHandle            vh;
 
-  // read header line
-  std::string header;
-  std::getline(_in,header);
+  // the header line has already been parsed by can_u_read()
 
   // + #Vertice, #Faces, #Edges
   _in >> nV;
@@ -213,11 +220,11 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
     vh = _bi.add_vertex(v);
 
     //perhaps read NORMAL
-    if ( options_.vertex_has_normal() ){
+    if ( _options.vertex_has_normal() ){
 
       _in >> n[0]; _in >> n[1]; _in >> n[2];
 
-      if ( userOptions_.vertex_has_normal() )
+      if ( _userOptions.vertex_has_normal() )
         _bi.set_normal(vh, n);
     }
 
@@ -225,12 +232,12 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
     std::string line;
     std::getline(_in,line);
 
-    int colorType = getColorType(line, options_.vertex_has_texcoord() );
+    int colorType = getColorType(line, _options.vertex_has_texcoord() );
 
     std::stringstream stream( line );
 
     //perhaps read COLOR
-    if ( options_.vertex_has_color() ){
+    if ( _options.vertex_has_color() ){
 
       std::string trash;
 
@@ -240,24 +247,24 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
         case 2 : stream >> trash; stream >> trash; break; //corrupt format (ignore)
         // rgb int
         case 3 : stream >> c3[0];  stream >> c3[1];  stream >> c3[2];
-            if ( userOptions_.vertex_has_color() )
+            if ( _userOptions.vertex_has_color() )
               _bi.set_color( vh, Vec3uc( c3 ) );
             break;
         // rgba int
         case 4 : stream >> c4[0];  stream >> c4[1];  stream >> c4[2]; stream >> c4[3];
-            if ( userOptions_.vertex_has_color() )
+            if ( _userOptions.vertex_has_color() )
               _bi.set_color( vh, Vec4uc( c4 ) );
             break;
         // rgb floats
         case 5 : stream >> c3f[0];  stream >> c3f[1];  stream >> c3f[2];
-            if ( userOptions_.vertex_has_color() ) {
+            if ( _userOptions.vertex_has_color() ) {
               _bi.set_color( vh, c3f );
               _opt += Options::ColorFloat;
             }
             break;
         // rgba floats
         case 6 : stream >> c4f[0];  stream >> c4f[1];  stream >> c4f[2]; stream >> c4f[3];
-            if ( userOptions_.vertex_has_color() ) {
+            if ( _userOptions.vertex_has_color() ) {
               _bi.set_color( vh, c4f );
               _opt += Options::ColorFloat;
             }
@@ -269,9 +276,9 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
       }
     }
     //perhaps read TEXTURE COORDs
-    if ( options_.vertex_has_texcoord() ){
+    if ( _options.vertex_has_texcoord() ){
       stream >> t[0]; stream >> t[1];
-      if ( userOptions_.vertex_has_texcoord() )
+      if ( _userOptions.vertex_has_texcoord() )
         _bi.set_texcoord(vh, t);
     }
   }
@@ -307,7 +314,7 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
     FaceHandle fh = _bi.add_face(vhandles);
 
     //perhaps read face COLOR
-    if ( options_.face_has_color() ){
+    if ( _options.face_has_color() ){
 
       //take the rest of the line and check how colors are defined
       std::string line;
@@ -325,24 +332,24 @@ _OFFReader_::read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) con
         case 2 : stream >> trash; stream >> trash; break; //corrupt format (ignore)
         // rgb int
         case 3 : stream >> c3[0];  stream >> c3[1];  stream >> c3[2];
-            if ( userOptions_.face_has_color() )
+            if ( _userOptions.face_has_color() )
               _bi.set_color( fh, Vec3uc( c3 ) );
             break;
         // rgba int
         case 4 : stream >> c4[0];  stream >> c4[1];  stream >> c4[2]; stream >> c4[3];
-            if ( userOptions_.face_has_color() )
+            if ( _userOptions.face_has_color() )
               _bi.set_color( fh, Vec4uc( c4 ) );
             break;
         // rgb floats
         case 5 : stream >> c3f[0];  stream >> c3f[1];  stream >> c3f[2];
-            if ( userOptions_.face_has_color() ) {
+            if ( _userOptions.face_has_color() ) {
               _bi.set_color( fh, c3f );
               _opt += Options::ColorFloat;
             }
             break;
         // rgba floats
         case 6 : stream >> c4f[0];  stream >> c4f[1];  stream >> c4f[2]; stream >> c4f[3];
-            if ( userOptions_.face_has_color() ) {
+            if ( _userOptions.face_has_color() ) {
               _bi.set_color( fh, c4f );
               _opt += Options::ColorFloat;
             }
@@ -435,7 +442,8 @@ void _OFFReader_::readValue(std::istream& _in, unsigned int& _value) const{
 }
 
 bool
-_OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bool /*_swap*/) const
+_OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bool /*_swap*/,
+                         const Options& _options, const Options& _userOptions) const
 {
   unsigned int            i, j, k, l, idx;
   unsigned int            nV, nF, dummy;
@@ -448,9 +456,7 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
   BaseImporter::VHandles  vhandles;
   VertexHandle            vh;
 
-  // read header line
-  std::string header;
-  std::getline(_in,header);
+  // the header line has already been parsed by can_u_read()
 
   // + #Vertice, #Faces, #Edges
   readValue(_in, nV);
@@ -469,26 +475,26 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
 
     vh = _bi.add_vertex(v);
 
-    if ( options_.vertex_has_normal() ) {
+    if ( _options.vertex_has_normal() ) {
       readValue(_in, n[0]);
       readValue(_in, n[1]);
       readValue(_in, n[2]);
 
-      if ( userOptions_.vertex_has_normal() )
+      if ( _userOptions.vertex_has_normal() )
         _bi.set_normal(vh, n);
     }
 
-    if ( options_.vertex_has_color() ) {
-      if ( userOptions_.color_is_float() ) {
+    if ( _options.vertex_has_color() ) {
+      if ( _userOptions.color_is_float() ) {
         _opt += Options::ColorFloat;
         //with alpha
-        if ( options_.color_has_alpha() ){
+        if ( _options.color_has_alpha() ){
           readValue(_in, cAf[0]);
           readValue(_in, cAf[1]);
           readValue(_in, cAf[2]);
           readValue(_in, cAf[3]);
 
-          if ( userOptions_.vertex_has_color() )
+          if ( _userOptions.vertex_has_color() )
             _bi.set_color( vh, cAf );
         }else{
 
@@ -497,18 +503,18 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
           readValue(_in, cf[1]);
           readValue(_in, cf[2]);
 
-          if ( userOptions_.vertex_has_color() )
+          if ( _userOptions.vertex_has_color() )
             _bi.set_color( vh, cf );
         }
       } else {
         //with alpha
-        if ( options_.color_has_alpha() ){
+        if ( _options.color_has_alpha() ){
           readValue(_in, cA[0]);
           readValue(_in, cA[1]);
           readValue(_in, cA[2]);
           readValue(_in, cA[3]);
 
-          if ( userOptions_.vertex_has_color() )
+          if ( _userOptions.vertex_has_color() )
             _bi.set_color( vh, Vec4uc( cA ) );
         }else{
           //without alpha
@@ -516,17 +522,17 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
           readValue(_in, c[1]);
           readValue(_in, c[2]);
 
-          if ( userOptions_.vertex_has_color() )
+          if ( _userOptions.vertex_has_color() )
             _bi.set_color( vh, Vec3uc( c ) );
         }
       }
     }
 
-    if ( options_.vertex_has_texcoord()) {
+    if ( _options.vertex_has_texcoord()) {
       readValue(_in, t[0]);
       readValue(_in, t[1]);
 
-      if ( userOptions_.vertex_has_texcoord() )
+      if ( _userOptions.vertex_has_texcoord() )
         _bi.set_texcoord(vh, t);
     }
   }
@@ -561,16 +567,16 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
 
     //face color
     if ( _opt.face_has_color() ) {
-      if ( userOptions_.color_is_float() ) {
+      if ( _userOptions.color_is_float() ) {
         _opt += Options::ColorFloat;
         //with alpha
-        if ( options_.color_has_alpha() ){
+        if ( _options.color_has_alpha() ){
           readValue(_in, cAf[0]);
           readValue(_in, cAf[1]);
           readValue(_in, cAf[2]);
           readValue(_in, cAf[3]);
 
-          if ( userOptions_.face_has_color() )
+          if ( _userOptions.face_has_color() )
             _bi.set_color( fh , cAf );
         }else{
           //without alpha
@@ -578,18 +584,18 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
           readValue(_in, cf[1]);
           readValue(_in, cf[2]);
 
-          if ( userOptions_.face_has_color() )
+          if ( _userOptions.face_has_color() )
             _bi.set_color( fh, cf );
         }
       } else {
         //with alpha
-        if ( options_.color_has_alpha() ){
+        if ( _options.color_has_alpha() ){
           readValue(_in, cA[0]);
           readValue(_in, cA[1]);
           readValue(_in, cA[2]);
           readValue(_in, cA[3]);
 
-          if ( userOptions_.face_has_color() )
+          if ( _userOptions.face_has_color() )
             _bi.set_color( fh , Vec4uc( cA ) );
         }else{
           //without alpha
@@ -597,7 +603,7 @@ _OFFReader_::read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bo
           readValue(_in, c[1]);
           readValue(_in, c[2]);
 
-          if ( userOptions_.face_has_color() )
+          if ( _userOptions.face_has_color() )
             _bi.set_color( fh, Vec3uc( c ) );
         }
       }
@@ -622,7 +628,8 @@ bool _OFFReader_::can_u_read(const std::string& _filename) const
   {
     std::ifstream ifs;
     openRead(_filename, Options(), ifs);
-    if (ifs.is_open() && can_u_read(ifs))
+    Options options;
+    if (ifs.is_open() && can_u_read(ifs, options))
     {
       ifs.close();
       return true;
@@ -635,9 +642,9 @@ bool _OFFReader_::can_u_read(const std::string& _filename) const
 //-----------------------------------------------------------------------------
 
 
-bool _OFFReader_::can_u_read(std::istream& _is) const
+bool _OFFReader_::can_u_read(std::istream& _is, Options& _options) const
 {
-  options_.cleanup();
+  _options.cleanup();
 
   // read 1st line
   char line[LINE_LEN], *p;
@@ -651,14 +658,14 @@ bool _OFFReader_::can_u_read(std::istream& _is) const
   // check header: [ST][C][N][4][n]OFF BINARY
 
   if ( ( remainingChars > 1 ) && ( p[0] == 'S' && p[1] == 'T') )
-  { options_ += Options::VertexTexCoord; p += 2; remainingChars -= 2; }
+  { _options += Options::VertexTexCoord; p += 2; remainingChars -= 2; }
 
   if ( ( remainingChars > 0 ) && ( p[0] == 'C') )
-  { options_ += Options::VertexColor;
-    options_ += Options::FaceColor; ++p; --remainingChars; }
+  { _options += Options::VertexColor;
+    _options += Options::FaceColor; ++p; --remainingChars; }
 
   if ( ( remainingChars > 0 ) && ( p[0] == 'N') )
-  { options_ += Options::VertexNormal; ++p; --remainingChars; }
+  { _options += Options::VertexNormal; ++p; --remainingChars; }
 
   if ( ( remainingChars > 0 ) && (p[0] == '4' ) )
   { vertexDimensionTooHigh = true; ++p; --remainingChars; }
@@ -678,7 +685,7 @@ bool _OFFReader_::can_u_read(std::istream& _is) const
     remainingChars = 0;
 
   if ( ( remainingChars >= 6 ) && ( strncmp(p, "BINARY", 6) == 0 ) )
-    options_+= Options::Binary;
+    _options+= Options::Binary;
 
   // vertex Dimensions != 3 are currently not supported
   if (vertexDimensionTooHigh)
@@ -140,21 +140,19 @@ public:
 
 private:
 
-  bool can_u_read(std::istream& _is) const;
+  /// Parse the header line and store the contents announced in it in \c _options
+  bool can_u_read(std::istream& _is, Options& _options) const;
 
-  bool read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt) const;
-  bool read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bool swap) const;
+  bool read_ascii(std::istream& _in, BaseImporter& _bi, Options& _opt,
+                  const Options& _options, const Options& _userOptions) const;
+  bool read_binary(std::istream& _in, BaseImporter& _bi, Options& _opt, bool swap,
+                   const Options& _options, const Options& _userOptions) const;
 
   void readValue(std::istream& _in, float& _value) const;
   void readValue(std::istream& _in, int& _value) const;
   void readValue(std::istream& _in, unsigned int& _value) const;
 
   int getColorType(std::string & _line, bool _texCoordsAvailable) const;
-
-  //available options for reading
-  mutable Options options_;
-  //options that the user wants to read
-  mutable Options userOptions_;
 };
 
 
@@ -54,12 +54,17 @@
 #include <vector>
 #include <istream>
 #include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <algorithm>
 
 // OpenMesh
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/Endian.hh>
 #include <OpenMesh/Core/IO/OMFormat.hh>
+#include <OpenMesh/Core/IO/OMCodec.hh>
+#include <OpenMesh/Core/IO/MappedFile.hh>
 #include <OpenMesh/Core/IO/reader/OMReader.hh>
 
 
@@ -79,6 +84,106 @@ _OMReader_&  OMReader() { return __OMReaderInstance; }
 
 
 
+//=== HELPERS =================================================================
+
+
+/// Mapping of an OM file shared by the reader and the deferred properties
+class OMSharedMapping
+{
+public:
+
+  explicit OMSharedMapping(const std::string& _filename)
+  : file_(_filename), refs_(1)
+  {}
+
+  void ref()   { ++refs_; }
+  void unref() { if (--refs_ == 0) delete this; }
+
+  const MappedFile& file() const { return file_; }
+
+private:
+
+  ~OMSharedMapping() {}
+
+  MappedFile file_;
+  int        refs_;
+};
+
+
+/// Read only stream buffer over a block of memory
+class OMMemoryBuffer : public std::streambuf
+{
+public:
+
+  OMMemoryBuffer(const char* _data, size_t _size)
+  {
+    char* p = const_cast<char*>(_data);
+    setg(p, p, p + _size);
+  }
+};
+
+
+/// Restores a custom property from its chunk in the mapped file
+class OMPropertyLoader : public PropertyLoader
+{
+public:
+
+  OMPropertyLoader(OMSharedMapping* _mapping, size_t _offset, size_t _size, bool _swap)
+  : mapping_(_mapping), offset_(_offset), size_(_size), swap_(_swap)
+  {
+    mapping_->ref();
+  }
+
+  ~OMPropertyLoader() { mapping_->unref(); }
+
+  void load(BaseProperty& _bp)
+  {
+    OMMemoryBuffer buffer(mapping_->file().data() + offset_, size_);
+    std::istream is(&buffer);
+    is.unsetf(std::ios::skipws);
+    _bp.restore(is, swap_);
+  }
+
+private:
+
+  OMSharedMapping* mapping_;
+  size_t           offset_;
+  size_t           size_;
+  bool             swap_;
+};
+
+
+/** Read _size bytes into _data. _size comes from the file, so it is
+    checked against the rest of the stream if the stream can tell, and
+    otherwise read in blocks, so that a corrupt size fails at the end of
+    the stream instead of allocating the whole amount up front. */
+static bool read_block(std::istream& _is, size_t _size, std::string& _data)
+{
+  const std::streampos pos = _is.tellg();
+  if (pos != std::streampos(-1))
+  {
+    _is.seekg(0, std::ios::end);
+    const std::streampos end = _is.tellg();
+    _is.seekg(pos);
+    if (end != std::streampos(-1) && std::streamoff(_size) > std::streamoff(end - pos))
+      return false;
+  }
+
+  const size_t block = size_t(1) << 20;
+
+  _data.clear();
+  while (_data.size() < _size && _is.good())
+  {
+    const size_t offset = _data.size();
+    const size_t n      = std::min(block, _size - offset);
+    _data.resize(offset + n);
+    _is.read(&_data[offset], std::streamsize(n));
+  }
+
+  return _data.size() == _size && !_is.fail();
+}
+
+
 //=== IMPLEMENTATION ==========================================================
 
 
@@ -98,7 +203,6 @@ bool _OMReader_::read(const std::string& _filename, BaseImporter& _bi, Options&
     return false;
 
   _opt += Options::Binary; // only binary format supported!
-  fileOptions_ = Options::Binary;
 
   // Open file
   std::ifstream ifs;
@@ -115,13 +219,27 @@ bool _OMReader_::read(const std::string& _filename, BaseImporter& _bi, Options&
     return false;
   }
 
+  ReadState state;
+
+  // Keep the file mapped while the deferred custom properties need it
+  if (_opt.check(Options::DeferredProperties)) {
+    state.mapping = new OMSharedMapping(_filename);
+    if (!state.mapping->file().is_open()) {
+      state.mapping->unref();
+      state.mapping = 0;
+    }
+  }
+
   // Pass stream to read method, remember result
-  bool result = read(ifs, _bi, _opt);
+  bool result = read(ifs, _bi, _opt, state);
 
   // close input stream
   ifs.close();
 
-  _opt = _opt & fileOptions_;
+  if (state.mapping) {
+    state.mapping->unref();
+    state.mapping = 0;
+  }
 
   return result;
 }
@@ -130,13 +248,22 @@ bool _OMReader_::read(const std::string& _filename, BaseImporter& _bi, Options&
 
 
 bool _OMReader_::read(std::istream& _is, BaseImporter& _bi, Options& _opt)
+{
+  ReadState state;
+  return read(_is, _bi, _opt, state);
+}
+
+//-----------------------------------------------------------------------------
+
+
+bool _OMReader_::read(std::istream& _is, BaseImporter& _bi, Options& _opt, ReadState& _state) const
 {
   // check whether importer can give us an OpenMesh BaseKernel
   if (!_bi.kernel())
     return false;
 
   _opt += Options::Binary; // only binary format supported!
-  fileOptions_ = Options::Binary;
+  _state.fileOptions = Options::Binary;
 
   if (!_is.good()) {
     omerr() << "[OMReader] : cannot read from stream " << std::endl;
@@ -144,12 +271,12 @@ bool _OMReader_::read(std::istream& _is, BaseImporter& _bi, Options& _opt)
   }
 
   // Pass stream to read method, remember result
-  bool result = read_binary(_is, _bi, _opt);
+  bool result = read_binary(_is, _bi, _opt, _state);
 
   if (result)
     _opt += Options::Binary;
 
-  _opt = _opt & fileOptions_;
+  _opt = _opt & _state.fileOptions;
 
   return result;
 }
@@ -167,55 +294,38 @@ bool _OMReader_::read_ascii(std::istream& /* _is */, BaseImporter& /* _bi */, Op
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt) const
+bool _OMReader_::read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt, ReadState& _state) const
 {
   bool swap = _opt.check(Options::Swap) || (Endian::local() == Endian::MSB);
 
   // Initialize byte counter
-  bytes_ = 0;
+  _state.bytes = 0;
 
-  bytes_ += restore(_is, header_, swap);
+  _state.connectivity_restored = false;
+  _state.vertex_halfedges.clear();
+  _state.halfedges.clear();
+
+  _state.bytes += restore(_is, _state.header, swap);
 
 
   while (!_is.eof()) {
-    bytes_ += restore(_is, chunk_header_, swap);
+    _state.bytes += restore(_is, _state.chunk_header, swap);
 
     if (_is.eof())
       break;
 
     // Is this a named property restore the name
-    if (chunk_header_.name_) {
+    if (_state.chunk_header.name_) {
       OMFormat::Chunk::PropertyName pn;
-      bytes_ += restore(_is, property_name_, swap);
+      _state.bytes += restore(_is, _state.property_name, swap);
     }
 
-    // Read in the property data. If it is an anonymous or unknown named
-    // property, then skip data.
-    switch (chunk_header_.entity_) {
-      case OMFormat::Chunk::Entity_Vertex:
-        if (!read_binary_vertex_chunk(_is, _bi, _opt, swap))
-          return false;
-        break;
-      case OMFormat::Chunk::Entity_Face:
-        if (!read_binary_face_chunk(_is, _bi, _opt, swap))
-          return false;
-        break;
-      case OMFormat::Chunk::Entity_Edge:
-        if (!read_binary_edge_chunk(_is, _bi, _opt, swap))
-          return false;
-        break;
-      case OMFormat::Chunk::Entity_Halfedge:
-        if (!read_binary_halfedge_chunk(_is, _bi, _opt, swap))
-          return false;
-        break;
-      case OMFormat::Chunk::Entity_Mesh:
-        if (!read_binary_mesh_chunk(_is, _bi, _opt, swap))
-          return false;
-        break;
-      default:
+    if (_state.chunk_header.compressed_) {
+      if (!read_binary_compressed_chunk(_is, _bi, _opt, swap, _state))
         return false;
     }
-
+    else if (!read_binary_chunk(_is, _bi, _opt, swap, _state))
+      return false;
   }
 
   // File was successfully parsed.
@@ -223,6 +333,92 @@ bool _OMReader_::read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt
 }
 
 
+//-----------------------------------------------------------------------------
+
+bool _OMReader_::read_binary_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap, ReadState& _state) const
+{
+  // Read in the property data. If it is an anonymous or unknown named
+  // property, then skip data.
+  switch (_state.chunk_header.entity_) {
+    case OMFormat::Chunk::Entity_Vertex:
+      if (!read_binary_vertex_chunk(_is, _bi, _opt, _swap, _state))
+        return false;
+      break;
+    case OMFormat::Chunk::Entity_Face:
+      if (!read_binary_face_chunk(_is, _bi, _opt, _swap, _state))
+        return false;
+      break;
+    case OMFormat::Chunk::Entity_Edge:
+      if (!read_binary_edge_chunk(_is, _bi, _opt, _swap, _state))
+        return false;
+      break;
+    case OMFormat::Chunk::Entity_Halfedge:
+      if (!read_binary_halfedge_chunk(_is, _bi, _opt, _swap, _state))
+        return false;
+      break;
+    case OMFormat::Chunk::Entity_Mesh:
+      if (!read_binary_mesh_chunk(_is, _bi, _opt, _swap, _state))
+        return false;
+      break;
+    default:
+      return false;
+  }
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+bool _OMReader_::read_binary_compressed_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap, ReadState& _state) const
+{
+  using OMFormat::Chunk;
+
+  Chunk::CodecHeader codec_header;
+  _state.bytes += restore(_is, codec_header, _swap);
+
+  std::string packed;
+  const bool complete = read_block(_is, codec_header.packed_size_, packed);
+  _state.bytes += packed.size();
+
+  if (!complete) {
+    omerr() << "[OMReader] : Compressed chunk is truncated\n";
+    return false;
+  }
+
+  if (!OMFormat::is_supported(Chunk::Codec(codec_header.codec_))) {
+    omerr() << "[OMReader] : Chunk with unknown codec ignored!\n";
+    return true;
+  }
+
+  std::string raw;
+  if (!OMFormat::decompress(Chunk::Codec(codec_header.codec_), codec_header.width_, codec_header.stride_,
+                            packed.data(), packed.size(), codec_header.raw_size_, raw)) {
+    omerr() << "[OMReader] : Compressed chunk is corrupt\n";
+    return false;
+  }
+  std::string().swap(packed);
+
+  _state.fileOptions += Options::Compressed;
+
+  // The chunk functions read the decompressed data as if it was stored
+  // in the file. It is not in the mapped file, so properties are restored
+  // directly. The bytes of the file have been counted above.
+  std::istringstream in(raw);
+  std::string().swap(raw);
+
+  OMSharedMapping* mapping = _state.mapping;
+  const size_t     bytes   = _state.bytes;
+
+  _state.mapping = 0;
+  const bool result = read_binary_chunk(in, _bi, _opt, _swap, _state);
+  _state.mapping = mapping;
+  _state.bytes   = bytes;
+
+  return result;
+}
+
+
 //-----------------------------------------------------------------------------
 
 bool _OMReader_::can_u_read(const std::string& _filename) const
@@ -285,11 +481,11 @@ bool _OMReader_::supports(const OMFormat::uint8 /* version */) const
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_vertex_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap) const
+bool _OMReader_::read_binary_vertex_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap, ReadState& _state) const
 {
   using OMFormat::Chunk;
 
-  assert( chunk_header_.entity_ == Chunk::Entity_Vertex);
+  assert( _state.chunk_header.entity_ == Chunk::Entity_Vertex);
 
   OpenMesh::Vec3f v3f;
   OpenMesh::Vec2f v2f;
@@ -298,92 +494,101 @@ bool _OMReader_::read_binary_vertex_chunk(std::istream &_is, BaseImporter &_bi,
   OMFormat::Chunk::PropertyName custom_prop;
 
   size_t vidx = 0;
-  switch (chunk_header_.type_) {
+  switch (_state.chunk_header.type_) {
     case Chunk::Type_Pos:
-      assert( OMFormat::dimensions(chunk_header_) == size_t(OpenMesh::Vec3f::dim()));
+      assert( OMFormat::dimensions(_state.chunk_header) == size_t(OpenMesh::Vec3f::dim()));
 
-      for (; vidx < header_.n_vertices_ && !_is.eof(); ++vidx) {
-        bytes_ += vector_restore(_is, v3f, _swap);
+      for (; vidx < _state.header.n_vertices_ && !_is.eof(); ++vidx) {
+        _state.bytes += vector_restore(_is, v3f, _swap);
         _bi.add_vertex(v3f);
       }
       break;
 
     case Chunk::Type_Normal:
-      assert( OMFormat::dimensions(chunk_header_) == size_t(OpenMesh::Vec3f::dim()));
+      assert( OMFormat::dimensions(_state.chunk_header) == size_t(OpenMesh::Vec3f::dim()));
 
-      fileOptions_ += Options::VertexNormal;
-      for (; vidx < header_.n_vertices_ && !_is.eof(); ++vidx) {
-        bytes_ += vector_restore(_is, v3f, _swap);
-        if (fileOptions_.vertex_has_normal() && _opt.vertex_has_normal())
+      _state.fileOptions += Options::VertexNormal;
+      for (; vidx < _state.header.n_vertices_ && !_is.eof(); ++vidx) {
+        _state.bytes += vector_restore(_is, v3f, _swap);
+        if (_state.fileOptions.vertex_has_normal() && _opt.vertex_has_normal())
           _bi.set_normal(VertexHandle(int(vidx)), v3f);
       }
       break;
 
     case Chunk::Type_Texcoord:
-      assert( OMFormat::dimensions(chunk_header_) == size_t(OpenMesh::Vec2f::dim()));
+      assert( OMFormat::dimensions(_state.chunk_header) == size_t(OpenMesh::Vec2f::dim()));
 
-      fileOptions_ += Options::VertexTexCoord;
-      for (; vidx < header_.n_vertices_ && !_is.eof(); ++vidx) {
-        bytes_ += vector_restore(_is, v2f, _swap);
-        if (fileOptions_.vertex_has_texcoord() && _opt.vertex_has_texcoord())
+      _state.fileOptions += Options::VertexTexCoord;
+      for (; vidx < _state.header.n_vertices_ && !_is.eof(); ++vidx) {
+        _state.bytes += vector_restore(_is, v2f, _swap);
+        if (_state.fileOptions.vertex_has_texcoord() && _opt.vertex_has_texcoord())
           _bi.set_texcoord(VertexHandle(int(vidx)), v2f);
       }
       break;
 
     case Chunk::Type_Color:
 
-      assert( OMFormat::dimensions(chunk_header_) == 3);
+      assert( OMFormat::dimensions(_state.chunk_header) == 3);
 
-      fileOptions_ += Options::VertexColor;
+      _state.fileOptions += Options::VertexColor;
 
-      for (; vidx < header_.n_vertices_ && !_is.eof(); ++vidx) {
-        bytes_ += vector_restore(_is, v3uc, _swap);
-        if (fileOptions_.vertex_has_color() && _opt.vertex_has_color())
+      for (; vidx < _state.header.n_vertices_ && !_is.eof(); ++vidx) {
+        _state.bytes += vector_restore(_is, v3uc, _swap);
+        if (_state.fileOptions.vertex_has_color() && _opt.vertex_has_color())
           _bi.set_color(VertexHandle(int(vidx)), v3uc);
       }
       break;
 
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_vprop(property_name_), header_.n_vertices_, _swap);
+      _state.bytes += restore_binary_custom_data(_is, _bi.kernel()->_get_vprop(_state.property_name), _state.header.n_vertices_, _swap, _state);
+
+      vidx = _state.header.n_vertices_;
 
-      vidx = header_.n_vertices_;
+      break;
+
+    case Chunk::Type_Connectivity:
+
+      _state.bytes += restore_binary_connectivity(_is, _state.vertex_halfedges, _state.header.n_vertices_, _swap, _state);
+
+      if (_is.good())
+        vidx = _state.header.n_vertices_;
 
       break;
 
     default: // skip unknown chunks
     {
       omerr() << "Unknown chunk type ignored!\n";
-      size_t size_of = header_.n_vertices_ * OMFormat::vector_size(chunk_header_);
+      size_t size_of = _state.header.n_vertices_ * OMFormat::vector_size(_state.chunk_header);
       _is.ignore(size_of);
-      bytes_ += size_of;
+      _state.bytes += size_of;
     }
   }
 
   // all chunk data has been read..?!
-  return vidx == header_.n_vertices_;
+  return vidx == _state.header.n_vertices_;
 }
 
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_face_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap) const
+bool _OMReader_::read_binary_face_chunk(std::istream &_is, BaseImporter &_bi, Options &_opt, bool _swap, ReadState& _state) const
 {
   using OMFormat::Chunk;
 
-  assert( chunk_header_.entity_ == Chunk::Entity_Face);
+  assert( _state.chunk_header.entity_ == Chunk::Entity_Face);
 
   size_t fidx = 0;
   OpenMesh::Vec3f v3f;  // normal
   OpenMesh::Vec3uc v3uc; // rgb
 
-  switch (chunk_header_.type_) {
+  switch (_state.chunk_header.type_) {
     case Chunk::Type_Topology: {
       BaseImporter::VHandles vhandles;
       size_t nV = 0;
       size_t vidx = 0;
 
-      switch (header_.mesh_) {
+      switch (_state.header.mesh_) {
         case 'T':
           nV = 3;
           break;
@@ -392,155 +597,227 @@ bool _OMReader_::read_binary_face_chunk(std::istream &_is, BaseImporter &_bi, Op
           break;
       }
 
-      for (; fidx < header_.n_faces_; ++fidx) {
-        if (header_.mesh_ == 'P')
-          bytes_ += restore(_is, nV, Chunk::Integer_16, _swap);
+      // The faces already exist if the connectivity chunks have been read,
+      // lists of fixed length can be skipped as a whole
+      if (_state.connectivity_restored && _state.header.mesh_ != 'P') {
+        size_t size_of = _state.header.n_faces_ * nV * OMFormat::scalar_size(_state.chunk_header);
+        _is.ignore(size_of);
+        _state.bytes += size_of;
+        fidx = _state.header.n_faces_;
+      }
+
+      // all faces are collected and added at once
+      std::vector<unsigned int> face_sizes;
+
+      for (; fidx < _state.header.n_faces_ && !_is.eof(); ++fidx) {
+        if (_state.header.mesh_ == 'P')
+          _state.bytes += restore(_is, nV, Chunk::Integer_16, _swap);
 
-        vhandles.clear();
         for (size_t j = 0; j < nV; ++j) {
-          bytes_ += restore(_is, vidx, Chunk::Integer_Size(chunk_header_.bits_), _swap);
+          _state.bytes += restore(_is, vidx, Chunk::Integer_Size(_state.chunk_header.bits_), _swap);
 
           vhandles.push_back(VertexHandle(int(vidx)));
         }
+        face_sizes.push_back(static_cast<unsigned int>(nV));
+      }
 
-        _bi.add_face(vhandles);
+      if (!_state.connectivity_restored)
+        _bi.add_faces(vhandles, face_sizes);
+    }
+      break;
+
+    case Chunk::Type_Connectivity: {
+      std::vector<int> face_halfedges;
+      _state.bytes += restore_binary_connectivity(_is, face_halfedges, _state.header.n_faces_, _swap, _state);
+
+      if (!_is.good())
+        break;
+
+      // Without support by the importer the faces are built from the
+      // topology chunk that follows
+      if (_bi.n_edges() == 0 && _bi.n_faces() == 0 &&
+          _bi.set_connectivity(_state.vertex_halfedges, _state.halfedges, face_halfedges)) {
+        _state.connectivity_restored = true;
+        _state.fileOptions += Options::Connectivity;
       }
+
+      std::vector<int>().swap(_state.vertex_halfedges);
+      std::vector<int>().swap(_state.halfedges);
+
+      fidx = _state.header.n_faces_;
     }
       break;
 
     case Chunk::Type_Normal:
-      assert( OMFormat::dimensions(chunk_header_) == size_t(OpenMesh::Vec3f::dim()));
+      assert( OMFormat::dimensions(_state.chunk_header) == size_t(OpenMesh::Vec3f::dim()));
 
-      fileOptions_ += Options::FaceNormal;
-      for (; fidx < header_.n_faces_ && !_is.eof(); ++fidx) {
-        bytes_ += vector_restore(_is, v3f, _swap);
-        if( fileOptions_.face_has_normal() && _opt.face_has_normal())
+      _state.fileOptions += Options::FaceNormal;
+      for (; fidx < _state.header.n_faces_ && !_is.eof(); ++fidx) {
+        _state.bytes += vector_restore(_is, v3f, _swap);
+        if( _state.fileOptions.face_has_normal() && _opt.face_has_normal())
           _bi.set_normal(FaceHandle(int(fidx)), v3f);
       }
       break;
 
     case Chunk::Type_Color:
 
-      assert( OMFormat::dimensions(chunk_header_) == 3);
+      assert( OMFormat::dimensions(_state.chunk_header) == 3);
 
-      fileOptions_ += Options::FaceColor;
-      for (; fidx < header_.n_faces_ && !_is.eof(); ++fidx) {
-        bytes_ += vector_restore(_is, v3uc, _swap);
-        if( fileOptions_.face_has_color() && _opt.face_has_color())
+      _state.fileOptions += Options::FaceColor;
+      for (; fidx < _state.header.n_faces_ && !_is.eof(); ++fidx) {
+        _state.bytes += vector_restore(_is, v3uc, _swap);
+        if( _state.fileOptions.face_has_color() && _opt.face_has_color())
           _bi.set_color(FaceHandle(int(fidx)), v3uc);
       }
       break;
 
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_fprop(property_name_), header_.n_faces_, _swap);
+      _state.bytes += restore_binary_custom_data(_is, _bi.kernel()->_get_fprop(_state.property_name), _state.header.n_faces_, _swap, _state);
 
-      fidx = header_.n_faces_;
+      fidx = _state.header.n_faces_;
 
       break;
 
     default: // skip unknown chunks
     {
       omerr() << "Unknown chunk type ignore!\n";
-      size_t size_of = OMFormat::chunk_data_size(header_, chunk_header_);
+      size_t size_of = OMFormat::chunk_data_size(_state.header, _state.chunk_header);
       _is.ignore(size_of);
-      bytes_ += size_of;
+      _state.bytes += size_of;
     }
   }
-  return fidx == header_.n_faces_;
+  return fidx == _state.header.n_faces_;
 }
 
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_edge_chunk(std::istream &_is, BaseImporter &_bi, Options &/*_opt */, bool _swap) const
+bool _OMReader_::read_binary_edge_chunk(std::istream &_is, BaseImporter &_bi, Options &/*_opt */, bool _swap, ReadState& _state) const
 {
   using OMFormat::Chunk;
 
-  assert( chunk_header_.entity_ == Chunk::Entity_Edge);
+  assert( _state.chunk_header.entity_ == Chunk::Entity_Edge);
 
-  size_t b = bytes_;
+  size_t b = _state.bytes;
 
-  switch (chunk_header_.type_) {
+  switch (_state.chunk_header.type_) {
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_eprop(property_name_), header_.n_edges_, _swap);
+      _state.bytes += restore_binary_custom_data(_is, _bi.kernel()->_get_eprop(_state.property_name), _state.header.n_edges_, _swap, _state);
 
       break;
 
     default:
       // skip unknown type
-      size_t size_of = OMFormat::chunk_data_size(header_, chunk_header_);
+      size_t size_of = OMFormat::chunk_data_size(_state.header, _state.chunk_header);
       _is.ignore(size_of);
-      bytes_ += size_of;
+      _state.bytes += size_of;
   }
 
-  return b < bytes_;
+  return b < _state.bytes;
 }
 
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_halfedge_chunk(std::istream &_is, BaseImporter &_bi, Options &/* _opt */, bool _swap) const
+bool _OMReader_::read_binary_halfedge_chunk(std::istream &_is, BaseImporter &_bi, Options &/* _opt */, bool _swap, ReadState& _state) const
 {
   using OMFormat::Chunk;
 
-  assert( chunk_header_.entity_ == Chunk::Entity_Halfedge);
+  assert( _state.chunk_header.entity_ == Chunk::Entity_Halfedge);
 
-  size_t b = bytes_;
+  size_t b = _state.bytes;
 
-  switch (chunk_header_.type_) {
+  switch (_state.chunk_header.type_) {
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_hprop(property_name_), 2 * header_.n_edges_, _swap);
+      _state.bytes += restore_binary_custom_data(_is, _bi.kernel()->_get_hprop(_state.property_name), 2 * _state.header.n_edges_, _swap, _state);
+      break;
+
+    case Chunk::Type_Connectivity:
+
+      _state.bytes += restore_binary_connectivity(_is, _state.halfedges, 6 * size_t(_state.header.n_edges_), _swap, _state);
       break;
 
     default:
       // skip unknown chunk
       omerr() << "Unknown chunk type ignored!\n";
-      size_t size_of = OMFormat::chunk_data_size(header_, chunk_header_);
+      size_t size_of = OMFormat::chunk_data_size(_state.header, _state.chunk_header);
       _is.ignore(size_of);
-      bytes_ += size_of;
+      _state.bytes += size_of;
   }
 
-  return b < bytes_;
+  return b < _state.bytes;
 }
 
 
 //-----------------------------------------------------------------------------
 
-bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Options & /* _opt */, bool _swap) const
+bool _OMReader_::read_binary_mesh_chunk(std::istream &_is, BaseImporter &_bi, Options & /* _opt */, bool _swap, ReadState& _state) const
 {
   using OMFormat::Chunk;
 
-  assert( chunk_header_.entity_ == Chunk::Entity_Mesh);
+  assert( _state.chunk_header.entity_ == Chunk::Entity_Mesh);
 
-  size_t b = bytes_;
+  size_t b = _state.bytes;
 
-  switch (chunk_header_.type_) {
+  switch (_state.chunk_header.type_) {
     case Chunk::Type_Custom:
 
-      bytes_ += restore_binary_custom_data(_is, _bi.kernel()->_get_mprop(property_name_), 1, _swap);
+      _state.bytes += restore_binary_custom_data(_is, _bi.kernel()->_get_mprop(_state.property_name), 1, _swap, _state);
 
       break;
 
     default:
       // skip unknown chunk
-      size_t size_of = OMFormat::chunk_data_size(header_, chunk_header_);
+      size_t size_of = OMFormat::chunk_data_size(_state.header, _state.chunk_header);
       _is.ignore(size_of);
-      bytes_ += size_of;
+      _state.bytes += size_of;
+  }
+
+  return b < _state.bytes;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+size_t _OMReader_::restore_binary_connectivity(std::istream& _is, std::vector<int>& _data, size_t _n, bool _swap, ReadState& _state) const
+{
+  // Only 32 bit indices are written, skip anything else
+  if ( _state.chunk_header.bits_ != OMFormat::Chunk::Integer_32 || _state.chunk_header.float_ ) {
+    omerr() << "[OMReader] : Unsupported connectivity chunk ignored\n";
+    size_t size_of = OMFormat::chunk_data_size(_state.header, _state.chunk_header);
+    _is.ignore(size_of);
+    _data.clear();
+    return size_of;
   }
 
-  return b < bytes_;
+  _data.resize(_n);
+  if (_n == 0)
+    return 0;
+
+  // Files are little endian, so the arrays can be read as a whole
+  OMFormat::int32 value;
+  if (sizeof(int) == sizeof(OMFormat::int32) && !_swap)
+    _is.read(reinterpret_cast<char*>(&_data[0]), std::streamsize(_n * sizeof(OMFormat::int32)));
+  else
+    for (size_t i = 0; i < _n; ++i) {
+      restore(_is, value, _swap);
+      _data[i] = value;
+    }
+
+  return _n * sizeof(OMFormat::int32);
 }
 
 
 //-----------------------------------------------------------------------------
 
 
-size_t _OMReader_::restore_binary_custom_data(std::istream& _is, BaseProperty* _bp, size_t _n_elem, bool _swap) const
+size_t _OMReader_::restore_binary_custom_data(std::istream& _is, BaseProperty* _bp, size_t _n_elem, bool _swap, ReadState& _state) const
 {
-  assert( !_bp || (_bp->name() == property_name_));
+  assert( !_bp || (_bp->name() == _state.property_name));
 
   using OMFormat::Chunk;
 
@@ -555,18 +832,30 @@ size_t _OMReader_::restore_binary_custom_data(std::istream& _is, BaseProperty* _
 
     if (((n_bytes == BaseProperty::UnknownSize) || (n_bytes == block_size))
         && (_bp->element_size() == BaseProperty::UnknownSize || (_n_elem * _bp->element_size() == block_size))) {
+
+      const std::streamoff offset = _state.mapping ? std::streamoff(_is.tellg()) : std::streamoff(-1);
+
+      if (offset >= 0 && size_t(offset) + block_size <= _state.mapping->file().size()
+          && _bp->element_size() != BaseProperty::UnknownSize && _bp->n_elements() == _n_elem) {
+        // Fixed-size data in the mapped file, restore it on first access
+        _bp->set_loader(new OMPropertyLoader(_state.mapping, size_t(offset), block_size, _swap));
+        _is.seekg(block_size, std::ios::cur);
+        bytes += block_size;
+        _state.fileOptions += Options::DeferredProperties;
+      } else {
 #if defined(OM_DEBUG)
-      size_t b;
-      bytes += (b=_bp->restore( _is, _swap ));
+        size_t b;
+        bytes += (b=_bp->restore( _is, _swap ));
 #else
-      bytes += _bp->restore(_is, _swap);
+        bytes += _bp->restore(_is, _swap);
 #endif
 
 #if defined(OM_DEBUG)
-      assert( block_size == b );
+        assert( block_size == b );
 #endif
 
-      assert( block_size == _bp->size_of());
+        assert( block_size == _bp->size_of());
+      }
 
       block_size = 0;
     } else {
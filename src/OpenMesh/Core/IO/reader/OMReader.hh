@@ -71,6 +71,7 @@
 // STD C++
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 
 //== NAMESPACES ===============================================================
@@ -83,6 +84,9 @@ namespace IO {
 //== IMPLEMENTATION ===========================================================
 
 
+class OMSharedMapping;
+
+
 /**
     Implementation of the OM format reader. This class is singleton'ed by
     SingletonT to OMReader.
@@ -115,49 +119,93 @@ private:
 
   bool supports( const OMFormat::uint8 version ) const;
 
-  bool read_ascii(std::istream& _is, BaseImporter& _bi, Options& _opt) const;
-  bool read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt) const;
-
   typedef OMFormat::Header              Header;
   typedef OMFormat::Chunk::Header       ChunkHeader;
   typedef OMFormat::Chunk::PropertyName PropertyName;
 
-  // initialized/updated by read_binary*/read_ascii*
-  mutable size_t       bytes_;
-  mutable Options      fileOptions_;
-  mutable Header       header_;
-  mutable ChunkHeader  chunk_header_;
-  mutable PropertyName property_name_;
+  /** State of a single read call. It lives on the stack of read(), so
+      that the reader can be used by several threads at the same time. */
+  struct ReadState
+  {
+    ReadState() : bytes(0), connectivity_restored(false), mapping(0) {}
+
+    // initialized/updated by read_binary*/read_ascii*
+    size_t       bytes;
+    Options      fileOptions;
+    Header       header;
+    ChunkHeader  chunk_header;
+    PropertyName property_name;
+
+    // raw connectivity collected from the Type_Connectivity chunks
+    std::vector<int> vertex_halfedges;
+    std::vector<int> halfedges;
+    bool             connectivity_restored;
+
+    // mapping of the file read, if custom properties are deferred
+    OMSharedMapping* mapping;
+  };
+
+  bool read(std::istream& _is, BaseImporter& _bi, Options& _opt, ReadState& _state) const;
+
+  bool read_ascii(std::istream& _is, BaseImporter& _bi, Options& _opt) const;
+  bool read_binary(std::istream& _is, BaseImporter& _bi, Options& _opt, ReadState& _state) const;
+
+  /// Read the data of the current chunk, dispatched by its entity
+  bool read_binary_chunk(          std::istream      &_is,
+				   BaseImporter      &_bi,
+				   Options           &_opt,
+				   bool              _swap,
+				   ReadState         &_state) const;
+
+  /// Decompress the data of the current chunk and read it
+  bool read_binary_compressed_chunk( std::istream    &_is,
+				   BaseImporter      &_bi,
+				   Options           &_opt,
+				   bool              _swap,
+				   ReadState         &_state) const;
 
   bool read_binary_vertex_chunk(   std::istream      &_is,
 				   BaseImporter      &_bi,
 				   Options           &_opt,
-				   bool              _swap) const;
+				   bool              _swap,
+				   ReadState         &_state) const;
 
   bool read_binary_face_chunk(     std::istream      &_is,
 			           BaseImporter      &_bi,
 			           Options           &_opt,
-				   bool              _swap) const;
+				   bool              _swap,
+				   ReadState         &_state) const;
 
   bool read_binary_edge_chunk(     std::istream      &_is,
 			           BaseImporter      &_bi,
 			           Options           &_opt,
-				   bool              _swap) const;
+				   bool              _swap,
+				   ReadState         &_state) const;
 
   bool read_binary_halfedge_chunk( std::istream      &_is,
 				   BaseImporter      &_bi,
 				   Options           &_opt,
-				   bool              _swap) const;
+				   bool              _swap,
+				   ReadState         &_state) const;
 
   bool read_binary_mesh_chunk(     std::istream      &_is,
 				   BaseImporter      &_bi,
 				   Options           &_opt,
-				   bool              _swap) const;
+				   bool              _swap,
+				   ReadState         &_state) const;
+
+  /// Read the int32 array of a Type_Connectivity chunk
+  size_t restore_binary_connectivity( std::istream& _is,
+                                      std::vector<int>& _data,
+                                      size_t _n,
+                                      bool _swap,
+                                      ReadState& _state) const;
 
   size_t restore_binary_custom_data( std::istream& _is,
 				     BaseProperty* _bp,
 				     size_t _n_elem,
-				     bool _swap) const;
+				     bool _swap,
+				     ReadState& _state) const;
 
 };
 
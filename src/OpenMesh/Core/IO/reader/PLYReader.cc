@@ -60,6 +60,7 @@
 #include <OpenMesh/Core/IO/SR_store.hh>
 
 //STL
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -139,47 +140,54 @@ bool _PLYReader_::read(std::istream& _in, BaseImporter& _bi, Options& _opt) {
         return false;
     }
 
+    ReadState state;
+
+    if (!can_u_read(_in, state)) {
+        omerr() << "[PLYReader] : Unable to parse header\n";
+        return false;
+    }
+
     // filter relevant options for reading
     bool swap = _opt.check(Options::Swap);
 
-    userOptions_ = _opt;
+    state.userOptions = _opt;
 
     // build options to be returned
     _opt.clear();
 
-    if (options_.vertex_has_normal() && userOptions_.vertex_has_normal()) {
+    if (state.options.vertex_has_normal() && state.userOptions.vertex_has_normal()) {
         _opt += Options::VertexNormal;
     }
-    if (options_.vertex_has_texcoord() && userOptions_.vertex_has_texcoord()) {
+    if (state.options.vertex_has_texcoord() && state.userOptions.vertex_has_texcoord()) {
         _opt += Options::VertexTexCoord;
     }
-    if (options_.vertex_has_color() && userOptions_.vertex_has_color()) {
+    if (state.options.vertex_has_color() && state.userOptions.vertex_has_color()) {
         _opt += Options::VertexColor;
     }
-    if (options_.face_has_color() && userOptions_.face_has_color()) {
+    if (state.options.face_has_color() && state.userOptions.face_has_color()) {
         _opt += Options::FaceColor;
     }
-    if (options_.face_has_texcoord() && userOptions_.face_has_texcoord()) {
+    if (state.options.face_has_texcoord() && state.userOptions.face_has_texcoord()) {
         _opt += Options::FaceTexCoord;
     }
-    if (options_.mesh_has_texfile() && userOptions_.mesh_has_texfile()) {
-        _bi.set_texfile(commentsMap_["TextureFile"]);
+    if (state.options.mesh_has_texfile() && state.userOptions.mesh_has_texfile()) {
+        _bi.set_texfile(state.commentsMap["TextureFile"]);
     }
-    if (options_.is_binary()) {
+    if (state.options.is_binary()) {
         _opt += Options::Binary;
     }
-    if (options_.color_is_float()) {
+    if (state.options.color_is_float()) {
         _opt += Options::ColorFloat;
     }
-    if (options_.check(Options::Custom) && userOptions_.check(Options::Custom)) {
+    if (state.options.check(Options::Custom) && state.userOptions.check(Options::Custom)) {
         _opt += Options::Custom;
     }
 
     //    //force user-choice for the alpha value when reading binary
-    //    if ( options_.is_binary() && userOptions_.color_has_alpha() )
-    //      options_ += Options::ColorAlpha;
+    //    if ( state.options.is_binary() && state.userOptions.color_has_alpha() )
+    //      state.options += Options::ColorAlpha;
 
-    return (options_.is_binary() ? read_binary(_in, _bi, swap, _opt) : read_ascii(_in, _bi, _opt));
+    return (state.options.is_binary() ? read_binary(_in, _bi, swap, _opt, state) : read_ascii(_in, _bi, _opt, state));
 
 }
 
@@ -283,13 +291,7 @@ void _PLYReader_::readCustomProperty(std::istream& _in, BaseImporter& _bi, Handl
 
 //-----------------------------------------------------------------------------
 
-bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options& _opt) const {
-
-    // Reparse the header
-    if (!can_u_read(_in)) {
-        omerr() << "[PLYReader] : Unable to parse header\n";
-        return false;
-    }
+bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options& _opt, const ReadState& _state) const {
 
     unsigned int i, j, idx;
     unsigned int nV;
@@ -303,15 +305,15 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
     FaceHandle             fh;
     std::vector<Vec2f>     face_texcoords;
 
-    _bi.reserve(vertexCount_, 3* vertexCount_ , faceCount_);
+    _bi.reserve(_state.vertexCount, 3* _state.vertexCount , _state.faceCount);
 
-    if (vertexDimension_ != 3) {
+    if (_state.vertexDimension != 3) {
         omerr() << "[PLYReader] : Only vertex dimension 3 is supported." << std::endl;
         return false;
     }
 
     // read vertices:
-    for (i = 0; i < vertexCount_ && !_in.eof(); ++i) {
+    for (i = 0; i < _state.vertexCount && !_in.eof(); ++i) {
         vh = _bi.add_vertex();
 
         v[0] = 0.0;
@@ -330,8 +332,8 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
         c[2] = 0;
         c[3] = 255;
 
-        for (size_t propertyIndex = 0; propertyIndex < vertexProperties_.size(); ++propertyIndex) {
-            switch (vertexProperties_[propertyIndex].property) {
+        for (size_t propertyIndex = 0; propertyIndex < _state.vertexProperties.size(); ++propertyIndex) {
+            switch (_state.vertexProperties[propertyIndex].property) {
             case XCOORD:
                 _in >> v[0];
                 break;
@@ -357,32 +359,32 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
                 _in >> t[1];
                 break;
             case COLORRED:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
                     _in >> tmp;
                     c[0] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
                     _in >> c[0];
                 break;
             case COLORGREEN:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
                     _in >> tmp;
                     c[1] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
                     _in >> c[1];
                 break;
             case COLORBLUE:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
                     _in >> tmp;
                     c[2] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
                     _in >> c[2];
                 break;
             case COLORALPHA:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
                     _in >> tmp;
                     c[3] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
@@ -390,7 +392,7 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
                 break;
             case CUSTOM_PROP:
                 if (_opt.check(Options::Custom))
-                  readCustomProperty(_in, _bi, vh, vertexProperties_[propertyIndex].name, vertexProperties_[propertyIndex].value, vertexProperties_[propertyIndex].listIndexType);
+                  readCustomProperty(_in, _bi, vh, _state.vertexProperties[propertyIndex].name, _state.vertexProperties[propertyIndex].value, _state.vertexProperties[propertyIndex].listIndexType);
                 else
                   _in >> trash;
                 break;
@@ -410,9 +412,9 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
     }
 
     // faces
-    for (i = 0; i < faceCount_; ++i) {
-        for (size_t propertyIndex = 0; propertyIndex < faceProperties_.size(); ++propertyIndex) {
-            PropertyInfo prop = faceProperties_[propertyIndex];
+    for (i = 0; i < _state.faceCount; ++i) {
+        for (size_t propertyIndex = 0; propertyIndex < _state.faceProperties.size(); ++propertyIndex) {
+            PropertyInfo prop = _state.faceProperties[propertyIndex];
             switch (prop.property) {
                 case VERTEX_INDICES:
                     // nV = number of Vertices for current face
@@ -454,14 +456,283 @@ bool _PLYReader_::read_ascii(std::istream& _in, BaseImporter& _bi, const Options
 
 //-----------------------------------------------------------------------------
 
-bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap*/, const Options& _opt) const {
+/// Decode a value of type T from _data, swap bytes if _swap is true
+template <typename T>
+static inline T decode_scalar(const char* _data, bool _swap)
+{
+  T value;
+  memcpy(&value, _data, sizeof(T));
+  if (_swap)
+    reverse_byte_order(value);
+  return value;
+}
+
 
-    // Reparse the header
-    if (!can_u_read(_in)) {
-        omerr() << "[PLYReader] : Unable to parse header\n";
+/** Buffers a binary input stream and hands out pointers into the buffer,
+    so that many small values can be decoded without one istream::read()
+    per value. The stream is read ahead by up to one block. */
+class PLYBlockReader
+{
+public:
+
+  explicit PLYBlockReader(std::istream& _in, size_t _block_size = 1 << 20)
+  : in_(_in), buffer_(_block_size), begin_(0), end_(0)
+  {}
+
+  /** Returns a pointer to the next _n bytes of the stream or NULL if the
+      stream ends before. The pointer is valid until the next call. */
+  const char* require(size_t _n)
+  {
+    if (end_ - begin_ < _n && !refill(_n))
+      return NULL;
+
+    const char* data = &buffer_[begin_];
+    begin_ += _n;
+    return data;
+  }
+
+private:
+
+  bool refill(size_t _n)
+  {
+    const size_t remaining = end_ - begin_;
+    if (remaining > 0 && begin_ > 0)
+      memmove(&buffer_[0], &buffer_[begin_], remaining);
+    begin_ = 0;
+    end_   = remaining;
+
+    if (buffer_.size() < _n)
+      buffer_.resize(_n);
+
+    while (end_ < _n && in_.good())
+    {
+      in_.read(&buffer_[end_], std::streamsize(buffer_.size() - end_));
+      end_ += size_t(in_.gcount());
+    }
+
+    return end_ >= _n;
+  }
+
+  std::istream&     in_;
+  std::vector<char> buffer_;
+  size_t            begin_;
+  size_t            end_;
+};
+
+/// Decoding step of one scalar vertex property in the binary fast path
+struct PLYVertexField
+{
+  enum Type { Skip, Float, ColorFloat, ColorUInt8, ColorInt8, ColorInt32, ColorUInt32 };
+
+  Type   type;
+  size_t offset; ///< byte offset in the vertex record
+  int    target; ///< 0-2 point, 3-5 normal, 6-7 texcoord, 8-11 color
+};
+
+//-----------------------------------------------------------------------------
+
+bool _PLYReader_::read_binary_vertices_fast(std::istream& _in, BaseImporter& _bi, const Options& _opt, const ReadState& _state) const {
+
+    // Compute the fixed record layout of a vertex from the header
+    std::vector<PLYVertexField> fields;
+    size_t stride = 0;
+
+    for (size_t propertyIndex = 0; propertyIndex < _state.vertexProperties.size(); ++propertyIndex) {
+        const PropertyInfo& prop = _state.vertexProperties[propertyIndex];
+
+        // List properties make the record size variable
+        if (prop.listIndexType != Unsupported || prop.value == Unsupported)
+            return false;
+
+        PLYVertexField field;
+        field.type   = PLYVertexField::Skip;
+        field.offset = stride;
+        field.target = -1;
+
+        const bool isFloat = (prop.value == ValueTypeFLOAT32 || prop.value == ValueTypeFLOAT);
+
+        switch (prop.property) {
+            case XCOORD: field.target = 0; break;
+            case YCOORD: field.target = 1; break;
+            case ZCOORD: field.target = 2; break;
+            case XNORM:  field.target = 3; break;
+            case YNORM:  field.target = 4; break;
+            case ZNORM:  field.target = 5; break;
+            case TEXX:   field.target = 6; break;
+            case TEXY:   field.target = 7; break;
+            case COLORRED:   field.target = 8;  break;
+            case COLORGREEN: field.target = 9;  break;
+            case COLORBLUE:  field.target = 10; break;
+            case COLORALPHA: field.target = 11; break;
+            default: break;
+        }
+
+        if (field.target >= 0 && field.target < 8) {
+            // Everything except float is rejected by readValue(, _state), leave that to the generic path
+            if (!isFloat)
+                return false;
+            field.type = PLYVertexField::Float;
+        } else if (field.target >= 8) {
+            switch (prop.value) {
+                case ValueTypeFLOAT32: case ValueTypeFLOAT:  field.type = PLYVertexField::ColorFloat;  break;
+                case ValueTypeUINT8:   case ValueTypeUCHAR:  field.type = PLYVertexField::ColorUInt8;  break;
+                case ValueTypeINT8:    case ValueTypeCHAR:   field.type = PLYVertexField::ColorInt8;   break;
+                case ValueTypeINT32:   case ValueTypeINT:    field.type = PLYVertexField::ColorInt32;  break;
+                case ValueTypeUINT32:  case ValueTypeUINT:   field.type = PLYVertexField::ColorUInt32; break;
+                default: return false;
+            }
+        }
+
+        if (field.type != PLYVertexField::Skip)
+            fields.push_back(field);
+
+        stride += scalar_size(prop.value);
+    }
+
+    if (stride == 0)
         return false;
+
+    const bool swap = _state.options.check(Options::MSB);
+
+    // Decode blocks of whole vertex records. Only the vertex block itself is
+    // consumed, so the face section can still be read by the generic code.
+    const size_t blockVertices = std::max(size_t(1), size_t(1 << 20) / stride);
+    std::vector<char> block(blockVertices * stride);
+
+    OpenMesh::Vec3f v, n;
+    OpenMesh::Vec2f t;
+    OpenMesh::Vec4i c;
+    VertexHandle    vh;
+
+    const size_t nFields = fields.size();
+    size_t remaining = _state.vertexCount;
+
+    while (remaining > 0 && _in.good()) {
+        const size_t count = std::min(remaining, blockVertices);
+        _in.read(&block[0], std::streamsize(count * stride));
+
+        // A truncated file yields the completely read vertices only
+        const size_t nRead = size_t(_in.gcount()) / stride;
+        remaining = (nRead < count) ? 0 : remaining - count;
+
+        const char* record = &block[0];
+        for (size_t i = 0; i < nRead; ++i, record += stride) {
+            float values[8] = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f };
+            c[0] = 0;
+            c[1] = 0;
+            c[2] = 0;
+            c[3] = 255;
+
+            for (size_t f = 0; f < nFields; ++f) {
+                const PLYVertexField& field = fields[f];
+                const char*  data  = record + field.offset;
+
+                switch (field.type) {
+                    case PLYVertexField::Float:
+                        values[field.target] = decode_scalar<float32_t>(data, swap);
+                        break;
+                    case PLYVertexField::ColorFloat:
+                        c[field.target - 8] = static_cast<OpenMesh::Vec4i::value_type> (decode_scalar<float32_t>(data, swap) * 255.0f);
+                        break;
+                    case PLYVertexField::ColorUInt8:
+                        c[field.target - 8] = static_cast<unsigned char>(*data);
+                        break;
+                    case PLYVertexField::ColorInt8:
+                        c[field.target - 8] = static_cast<signed char>(*data);
+                        break;
+                    case PLYVertexField::ColorInt32:
+                        c[field.target - 8] = decode_scalar<int32_t>(data, swap);
+                        break;
+                    case PLYVertexField::ColorUInt32:
+                        c[field.target - 8] = static_cast<OpenMesh::Vec4i::value_type> (decode_scalar<uint32_t>(data, swap));
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            v[0] = values[0]; v[1] = values[1]; v[2] = values[2];
+            n[0] = values[3]; n[1] = values[4]; n[2] = values[5];
+            t[0] = values[6]; t[1] = values[7];
+
+            vh = _bi.add_vertex(v);
+            if (_opt.vertex_has_normal())
+              _bi.set_normal(vh, n);
+            if (_opt.vertex_has_texcoord())
+              _bi.set_texcoord(vh, t);
+            if (_opt.vertex_has_color())
+              _bi.set_color(vh, Vec4uc(c));
+        }
     }
 
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool _PLYReader_::read_binary_faces_fast(std::istream& _in, BaseImporter& _bi, const ReadState& _state) const {
+
+    // Only the plain vertex_indices list is handled here
+    if (_state.faceProperties.size() != 1 || _state.faceProperties[0].property != VERTEX_INDICES)
+        return false;
+
+    const ValueType indexType = _state.faceProperties[0].listIndexType;
+    const ValueType valueType = _state.faceProperties[0].value;
+
+    // Mirror the types accepted by readValue(unsigned int, _state) and readInteger(unsigned int, _state)
+    size_t countSize;
+    switch (indexType) {
+        case ValueTypeUINT8:  case ValueTypeUCHAR:  countSize = 1; break;
+        case ValueTypeUINT16: case ValueTypeUSHORT: countSize = 2; break;
+        case ValueTypeUINT32: case ValueTypeUINT:   countSize = 4; break;
+        default: return false;
+    }
+
+    switch (valueType) {
+        case ValueTypeINT32: case ValueTypeINT:
+        case ValueTypeUINT32: case ValueTypeUINT:
+            break;
+        default:
+            return false;
+    }
+
+    const bool swap = _state.options.check(Options::MSB);
+
+    PLYBlockReader reader(_in);
+    BaseImporter::VHandles    vhandles;
+    std::vector<unsigned int> face_sizes;
+
+    // all faces are collected and added at once
+    for (unsigned int i = 0; i < _state.faceCount; ++i) {
+        const char* data = reader.require(countSize);
+        if (!data)
+            break;
+
+        unsigned int nV;
+        switch (countSize) {
+            case 1:  nV = static_cast<unsigned char>(*data); break;
+            case 2:  nV = decode_scalar<uint16_t>(data, swap); break;
+            default: nV = decode_scalar<uint32_t>(data, swap); break;
+        }
+
+        data = reader.require(size_t(nV) * 4);
+        if (!data)
+            break;
+
+        for (unsigned int j = 0; j < nV; ++j, data += 4)
+            vhandles.push_back(VertexHandle(int(decode_scalar<uint32_t>(data, swap))));
+        face_sizes.push_back(nV);
+    }
+
+    _bi.add_faces(vhandles, face_sizes);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap*/, const Options& _opt, const ReadState& _state) const {
+
     unsigned int nV, nTC;
     OpenMesh::Vec3f        v, n;  // Vertex
     OpenMesh::Vec2f        t;  // TexCoords
@@ -473,10 +744,12 @@ bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap
     ValueType              indexType, valueType;
     std::vector<Vec2f>     face_texcoords;
 
-    _bi.reserve(vertexCount_, 3* vertexCount_ , faceCount_);
+    _bi.reserve(_state.vertexCount, 3* _state.vertexCount , _state.faceCount);
 
-    // read vertices:
-    for (unsigned int i = 0; i < vertexCount_ && !_in.eof(); ++i) {
+    // read vertices, common fixed size layouts are decoded in blocks
+    const bool verticesRead = read_binary_vertices_fast(_in, _bi, _opt, _state);
+
+    for (unsigned int i = 0; i < _state.vertexCount && !verticesRead && !_in.eof(); ++i) {
         v[0] = 0.0;
         v[1] = 0.0;
         v[2] = 0.0;
@@ -493,72 +766,72 @@ bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap
         c[2] = 0;
         c[3] = 255;
 
-        for (size_t propertyIndex = 0; propertyIndex < vertexProperties_.size(); ++propertyIndex) {
-            switch (vertexProperties_[propertyIndex].property) {
+        for (size_t propertyIndex = 0; propertyIndex < _state.vertexProperties.size(); ++propertyIndex) {
+            switch (_state.vertexProperties[propertyIndex].property) {
             case XCOORD:
-                readValue(vertexProperties_[propertyIndex].value, _in, v[0]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, v[0], _state);
                 break;
             case YCOORD:
-                readValue(vertexProperties_[propertyIndex].value, _in, v[1]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, v[1], _state);
                 break;
             case ZCOORD:
-                readValue(vertexProperties_[propertyIndex].value, _in, v[2]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, v[2], _state);
                 break;
             case XNORM:
-                readValue(vertexProperties_[propertyIndex].value, _in, n[0]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, n[0], _state);
                 break;
             case YNORM:
-                readValue(vertexProperties_[propertyIndex].value, _in, n[1]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, n[1], _state);
                 break;
             case ZNORM:
-                readValue(vertexProperties_[propertyIndex].value, _in, n[2]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, n[2], _state);
                 break;
             case TEXX:
-                readValue(vertexProperties_[propertyIndex].value, _in, t[0]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, t[0], _state);
                 break;
             case TEXY:
-                readValue(vertexProperties_[propertyIndex].value, _in, t[1]);
+                readValue(_state.vertexProperties[propertyIndex].value, _in, t[1], _state);
                 break;
             case COLORRED:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
-                    readValue(vertexProperties_[propertyIndex].value, _in, tmp);
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
+                    readValue(_state.vertexProperties[propertyIndex].value, _in, tmp, _state);
 
                     c[0] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
-                    readInteger(vertexProperties_[propertyIndex].value, _in, c[0]);
+                    readInteger(_state.vertexProperties[propertyIndex].value, _in, c[0], _state);
 
                 break;
             case COLORGREEN:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
-                    readValue(vertexProperties_[propertyIndex].value, _in, tmp);
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
+                    readValue(_state.vertexProperties[propertyIndex].value, _in, tmp, _state);
                     c[1] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
-                    readInteger(vertexProperties_[propertyIndex].value, _in, c[1]);
+                    readInteger(_state.vertexProperties[propertyIndex].value, _in, c[1], _state);
 
                 break;
             case COLORBLUE:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
-                    readValue(vertexProperties_[propertyIndex].value, _in, tmp);
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
+                    readValue(_state.vertexProperties[propertyIndex].value, _in, tmp, _state);
                     c[2] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
-                    readInteger(vertexProperties_[propertyIndex].value, _in, c[2]);
+                    readInteger(_state.vertexProperties[propertyIndex].value, _in, c[2], _state);
 
                 break;
             case COLORALPHA:
-                if (vertexProperties_[propertyIndex].value == ValueTypeFLOAT32 ||
-                    vertexProperties_[propertyIndex].value == ValueTypeFLOAT) {
-                    readValue(vertexProperties_[propertyIndex].value, _in, tmp);
+                if (_state.vertexProperties[propertyIndex].value == ValueTypeFLOAT32 ||
+                    _state.vertexProperties[propertyIndex].value == ValueTypeFLOAT) {
+                    readValue(_state.vertexProperties[propertyIndex].value, _in, tmp, _state);
                     c[3] = static_cast<OpenMesh::Vec4i::value_type> (tmp * 255.0f);
                 } else
-                    readInteger(vertexProperties_[propertyIndex].value, _in, c[3]);
+                    readInteger(_state.vertexProperties[propertyIndex].value, _in, c[3], _state);
 
                 break;
             default:
                 // Read unsupported property
-                consume_input(_in, scalar_size_[vertexProperties_[propertyIndex].value]);
+                consume_input(_in, scalar_size(_state.vertexProperties[propertyIndex].value));
                 break;
             }
 
@@ -573,29 +846,29 @@ bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap
           _bi.set_color(vh, Vec4uc(c));
     }
 
-    if(!faceProperties_.empty()) {
-        for (unsigned int i = 0; i < faceCount_; ++i) {
-            for (size_t propertyIndex = 0; propertyIndex < faceProperties_.size(); ++propertyIndex) {
-                PropertyInfo prop = faceProperties_[propertyIndex];
+    if(!_state.faceProperties.empty() && !read_binary_faces_fast(_in, _bi, _state)) {
+        for (unsigned int i = 0; i < _state.faceCount; ++i) {
+            for (size_t propertyIndex = 0; propertyIndex < _state.faceProperties.size(); ++propertyIndex) {
+                PropertyInfo prop = _state.faceProperties[propertyIndex];
                 indexType = prop.listIndexType;
                 valueType = prop.value;
                 switch (prop.property) {
                     case VERTEX_INDICES:
                         // Read number of vertices for the current face
-                        readValue(indexType, _in, nV);
+                        readValue(indexType, _in, nV, _state);
                         vhandles.clear();
                         for (unsigned int j = 0; j < nV; ++j) {
                             unsigned int idx;
-                            readInteger(valueType, _in, idx);
+                            readInteger(valueType, _in, idx, _state);
                             vhandles.push_back(VertexHandle(idx));
                         }
                         break;
                     case FACE_TEXCOORDS:
-                        readValue(indexType, _in, nTC);
+                        readValue(indexType, _in, nTC, _state);
                         face_texcoords.clear();
                         for (unsigned int j = 0; j < nTC / 2; ++j) {
-                            readValue(valueType, _in, t[0]);
-                            readValue(valueType, _in, t[1]);
+                            readValue(valueType, _in, t[0], _state);
+                            readValue(valueType, _in, t[1], _state);
                             face_texcoords.push_back(t);
                         }
                         break;
@@ -618,13 +891,13 @@ bool _PLYReader_::read_binary(std::istream& _in, BaseImporter& _bi, bool /*_swap
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readValue(ValueType _type, std::istream& _in, float& _value) const {
+void _PLYReader_::readValue(ValueType _type, std::istream& _in, float& _value, const ReadState& _state) const {
 
     switch (_type) {
     case ValueTypeFLOAT32:
     case ValueTypeFLOAT:
         float32_t tmp;
-        restore(_in, tmp, options_.check(Options::MSB));
+        restore(_in, tmp, _state.options.check(Options::MSB));
         _value = tmp;
         break;
     default:
@@ -638,7 +911,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, float& _value) c
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readValue(ValueType _type, std::istream& _in, double& _value) const {
+void _PLYReader_::readValue(ValueType _type, std::istream& _in, double& _value, const ReadState& _state) const {
 
     switch (_type) {
 
@@ -647,7 +920,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, double& _value)
         case ValueTypeDOUBLE:
 
             float64_t tmp;
-            restore(_in, tmp, options_.check(Options::MSB));
+            restore(_in, tmp, _state.options.check(Options::MSB));
             _value = tmp;
 
             break;
@@ -665,7 +938,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, double& _value)
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _value) const {
+void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _value, const ReadState& _state) const {
 
     uint32_t tmp_uint32_t;
     uint16_t tmp_uint16_t;
@@ -677,7 +950,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _v
 
         case ValueTypeUINT32:
 
-            restore(_in, tmp_uint32_t, options_.check(Options::MSB));
+            restore(_in, tmp_uint32_t, _state.options.check(Options::MSB));
             _value = tmp_uint32_t;
 
         break;
@@ -686,7 +959,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _v
 
         case ValueTypeUINT16:
 
-            restore(_in, tmp_uint16_t, options_.check(Options::MSB));
+            restore(_in, tmp_uint16_t, _state.options.check(Options::MSB));
             _value = tmp_uint16_t;
 
             break;
@@ -695,7 +968,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _v
 
         case ValueTypeUINT8:
 
-            restore(_in, tmp_uchar, options_.check(Options::MSB));
+            restore(_in, tmp_uchar, _state.options.check(Options::MSB));
             _value = tmp_uchar;
 
             break;
@@ -713,7 +986,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, unsigned int& _v
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value) const {
+void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value, const ReadState& _state) const {
 
     int32_t tmp_int32_t;
     int16_t tmp_int16_t;
@@ -725,7 +998,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value) con
 
         case ValueTypeINT32:
 
-            restore(_in, tmp_int32_t, options_.check(Options::MSB));
+            restore(_in, tmp_int32_t, _state.options.check(Options::MSB));
             _value = tmp_int32_t;
 
             break;
@@ -734,7 +1007,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value) con
 
         case ValueTypeINT16:
 
-            restore(_in, tmp_int16_t, options_.check(Options::MSB));
+            restore(_in, tmp_int16_t, _state.options.check(Options::MSB));
             _value = tmp_int16_t;
 
             break;
@@ -743,7 +1016,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value) con
 
         case ValueTypeINT8:
 
-            restore(_in, tmp_char, options_.check(Options::MSB));
+            restore(_in, tmp_char, _state.options.check(Options::MSB));
             _value = tmp_char;
 
             break;
@@ -761,7 +1034,7 @@ void _PLYReader_::readValue(ValueType _type, std::istream& _in, int& _value) con
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) const {
+void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value, const ReadState& _state) const {
 
     int32_t tmp_int32_t;
     uint32_t tmp_uint32_t;
@@ -774,7 +1047,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) c
 
         case ValueTypeINT32:
 
-            restore(_in, tmp_int32_t, options_.check(Options::MSB));
+            restore(_in, tmp_int32_t, _state.options.check(Options::MSB));
             _value = tmp_int32_t;
 
             break;
@@ -783,7 +1056,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) c
 
         case ValueTypeUINT32:
 
-            restore(_in, tmp_uint32_t, options_.check(Options::MSB));
+            restore(_in, tmp_uint32_t, _state.options.check(Options::MSB));
             _value = tmp_uint32_t;
 
             break;
@@ -792,7 +1065,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) c
 
         case ValueTypeINT8:
 
-            restore(_in, tmp_char, options_.check(Options::MSB));
+            restore(_in, tmp_char, _state.options.check(Options::MSB));
             _value = tmp_char;
 
             break;
@@ -801,7 +1074,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) c
 
         case ValueTypeUINT8:
 
-            restore(_in, tmp_uchar, options_.check(Options::MSB));
+            restore(_in, tmp_uchar, _state.options.check(Options::MSB));
             _value = tmp_uchar;
 
             break;
@@ -819,7 +1092,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, int& _value) c
 //-----------------------------------------------------------------------------
 
 
-void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int& _value) const {
+void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int& _value, const ReadState& _state) const {
 
     int32_t tmp_int32_t;
     uint32_t tmp_uint32_t;
@@ -832,7 +1105,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int&
 
         case ValueTypeUINT32:
 
-            restore(_in, tmp_uint32_t, options_.check(Options::MSB));
+            restore(_in, tmp_uint32_t, _state.options.check(Options::MSB));
             _value = tmp_uint32_t;
 
             break;
@@ -841,7 +1114,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int&
 
         case ValueTypeINT32:
 
-            restore(_in, tmp_int32_t, options_.check(Options::MSB));
+            restore(_in, tmp_int32_t, _state.options.check(Options::MSB));
             _value = tmp_int32_t;
 
             break;
@@ -850,7 +1123,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int&
 
         case ValueTypeUINT8:
 
-            restore(_in, tmp_uchar, options_.check(Options::MSB));
+            restore(_in, tmp_uchar, _state.options.check(Options::MSB));
             _value = tmp_uchar;
 
             break;
@@ -859,7 +1132,7 @@ void _PLYReader_::readInteger(ValueType _type, std::istream& _in, unsigned int&
 
         case ValueTypeINT8:
 
-            restore(_in, tmp_char, options_.check(Options::MSB));
+            restore(_in, tmp_char, _state.options.check(Options::MSB));
             _value = tmp_char;
 
             break;
@@ -885,7 +1158,8 @@ bool _PLYReader_::can_u_read(const std::string& _filename) const {
     if (BaseReader::can_u_read(_filename)) {
         std::ifstream ifs;
         openRead(_filename, Options(), ifs);
-        if (ifs.is_open() && can_u_read(ifs)) {
+        ReadState state;
+        if (ifs.is_open() && can_u_read(ifs, state)) {
             ifs.close();
             return true;
         }
@@ -990,17 +1264,17 @@ _PLYReader_::ValueType get_property_type(std::string _string1, std::string _stri
 
 //-----------------------------------------------------------------------------
 
-bool _PLYReader_::can_u_read(std::istream& _is) const {
+bool _PLYReader_::can_u_read(std::istream& _is, ReadState& _state) const {
 
     // Clear per file options
-    options_.cleanup();
+    _state.options.cleanup();
 
     // clear header comments map, will be recreated
-    commentsMap_.clear();
+    _state.commentsMap.clear();
 
     // clear property maps, will be recreated
-    vertexProperties_.clear();
-    faceProperties_.clear();
+    _state.vertexProperties.clear();
+    _state.faceProperties.clear();
 
     // read 1st line
     std::string line;
@@ -1011,9 +1285,9 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
     if (line != "PLY" && line != "ply")
         return false;
 
-    vertexCount_ = 0;
-    faceCount_ = 0;
-    vertexDimension_ = 0;
+    _state.vertexCount = 0;
+    _state.faceCount = 0;
+    _state.vertexDimension = 0;
 
     std::string keyword;
     std::string fileType;
@@ -1035,19 +1309,19 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
     }
 
     if (fileType == "ascii") {
-        options_ -= Options::Binary;
+        _state.options -= Options::Binary;
     } else if (fileType == "binary_little_endian") {
-        options_ += Options::Binary;
-        options_ += Options::LSB;
+        _state.options += Options::Binary;
+        _state.options += Options::LSB;
         //if (Endian::local() == Endian::MSB)
 
-        //  options_ += Options::Swap;
+        //  _state.options += Options::Swap;
     } else if (fileType == "binary_big_endian") {
-        options_ += Options::Binary;
-        options_ += Options::MSB;
+        _state.options += Options::Binary;
+        _state.options += Options::MSB;
         //if (Endian::local() == Endian::LSB)
 
-        //  options_ += Options::Swap;
+        //  _state.options += Options::Swap;
     } else {
         omerr() << "Unsupported PLY format: " << fileType << std::endl;
         return false;
@@ -1061,17 +1335,17 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
             std::getline(_is, line);
             std::stringstream lineStream(line);
             if ((lineStream >> commentKey) && (lineStream >> commentValue)) {
-              commentsMap_[commentKey] = commentValue;
+              _state.commentsMap[commentKey] = commentValue;
               if (commentKey == "TextureFile") {
-                options_ += Options::TexFile;
+                _state.options += Options::TexFile;
               }
             }
         } else if (keyword == "element") {
             _is >> elementName;
             if (elementName == "vertex") {
-                _is >> vertexCount_;
+                _is >> _state.vertexCount;
             } else if (elementName == "face") {
-                _is >> faceCount_;
+                _is >> _state.faceCount;
             } else {
                 omerr() << "PLY header unsupported element type: " << elementName << std::endl;
             }
@@ -1109,9 +1383,9 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
                 property.listIndexType = indexType;
 
                 // just 2 elements supported by now
-                if (elementName == "vertex" && !options_.is_binary())
+                if (elementName == "vertex" && !_state.options.is_binary())
                 {
-                  vertexProperties_.push_back(property);
+                  _state.vertexProperties.push_back(property);
                 }
                 else if (elementName == "face")
                 {
@@ -1119,23 +1393,23 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
                   if (propertyName == "vertex_index" || propertyName == "vertex_indices")
                   {
                     property.property = VERTEX_INDICES;
-                    if (!faceProperties_.empty())
+                    if (!_state.faceProperties.empty())
                     {
                       omerr() << "Custom face Properties defined, before 'vertex_indices' property was defined. They will be skipped" << std::endl;
-                      faceProperties_.clear();
+                      _state.faceProperties.clear();
                     }
-                    faceProperties_.push_back(property);
+                    _state.faceProperties.push_back(property);
                   } else if (propertyName == "texcoord") {
                     property.property = FACE_TEXCOORDS;
                     if (entryType != ValueTypeFLOAT) {
                         omerr() << "Unsupported Entry type for texcoord list: " << listEntryType << std::endl;
                         return false;
                     }
-                    options_ += Options::FaceTexCoord;
-                    faceProperties_.push_back(property);
+                    _state.options += Options::FaceTexCoord;
+                    _state.faceProperties.push_back(property);
                   } else {
-                    if (!options_.is_binary())
-                      faceProperties_.push_back(property);
+                    if (!_state.options.is_binary())
+                      _state.faceProperties.push_back(property);
                     else
                       omerr() << "Custom list properties per face not supported with binary files" << std::endl;
                   }
@@ -1160,72 +1434,72 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
               if (elementName == "vertex") {
                 if (propertyName == "x") {
                   entry = PropertyInfo(XCOORD, valueType);
-                  vertexDimension_++;
+                  _state.vertexDimension++;
                 } else if (propertyName == "y") {
                   entry = PropertyInfo(YCOORD, valueType);
-                  vertexDimension_++;
+                  _state.vertexDimension++;
                 } else if (propertyName == "z") {
                   entry = PropertyInfo(ZCOORD, valueType);
-                  vertexDimension_++;
+                  _state.vertexDimension++;
                 } else if (propertyName == "nx") {
                   entry = PropertyInfo(XNORM, valueType);
-                  options_ += Options::VertexNormal;
+                  _state.options += Options::VertexNormal;
                 } else if (propertyName == "ny") {
                   entry = PropertyInfo(YNORM, valueType);
-                  options_ += Options::VertexNormal;
+                  _state.options += Options::VertexNormal;
                 } else if (propertyName == "nz") {
                   entry = PropertyInfo(ZNORM, valueType);
-                  options_ += Options::VertexNormal;
+                  _state.options += Options::VertexNormal;
                 } else if (propertyName == "u" || propertyName == "s") {
                   entry = PropertyInfo(TEXX, valueType);
-                  options_ += Options::VertexTexCoord;
+                  _state.options += Options::VertexTexCoord;
                 } else if (propertyName == "v" || propertyName == "t") {
                   entry = PropertyInfo(TEXY, valueType);
-                  options_ += Options::VertexTexCoord;
+                  _state.options += Options::VertexTexCoord;
                 } else if (propertyName == "red") {
                   entry = PropertyInfo(COLORRED, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "green") {
                   entry = PropertyInfo(COLORGREEN, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "blue") {
                   entry = PropertyInfo(COLORBLUE, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "diffuse_red") {
                   entry = PropertyInfo(COLORRED, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "diffuse_green") {
                   entry = PropertyInfo(COLORGREEN, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "diffuse_blue") {
                   entry = PropertyInfo(COLORBLUE, valueType);
-                  options_ += Options::VertexColor;
+                  _state.options += Options::VertexColor;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 } else if (propertyName == "alpha") {
                   entry = PropertyInfo(COLORALPHA, valueType);
-                  options_ += Options::VertexColor;
-                  options_ += Options::ColorAlpha;
+                  _state.options += Options::VertexColor;
+                  _state.options += Options::ColorAlpha;
                   if (valueType == ValueTypeFLOAT || valueType == ValueTypeFLOAT32)
-                    options_ += Options::ColorFloat;
+                    _state.options += Options::ColorFloat;
                 }
               }
 
               //not a special property, load as custom
               if (entry.value == Unsupported){
-                Property prop = (!options_.is_binary()) ? CUSTOM_PROP : UNSUPPORTED; // loading vertex properties is not yet supported by the binary loader
+                Property prop = (!_state.options.is_binary()) ? CUSTOM_PROP : UNSUPPORTED; // loading vertex properties is not yet supported by the binary loader
                 if (prop != UNSUPPORTED)
-                  options_ += Options::Custom;
+                  _state.options += Options::Custom;
                 else
                   omerr() << "Custom Properties not supported in binary files. Skipping" << std::endl;
                 entry  = PropertyInfo(prop, valueType, propertyName);
@@ -1234,9 +1508,9 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
               if (entry.property != UNSUPPORTED)
               {
                 if (elementName == "vertex")
-                  vertexProperties_.push_back(entry);
+                  _state.vertexProperties.push_back(entry);
                 else if (elementName == "face")
-                  faceProperties_.push_back(entry);
+                  _state.faceProperties.push_back(entry);
                 else
                   omerr() << "Properties not supported in element " << elementName << std::endl;
               }
@@ -1257,7 +1531,7 @@ bool _PLYReader_::can_u_read(std::istream& _is) const {
 
     // As the binary data is directy after the end_header keyword
     // and the stream removes too many bytes, seek back to the right position
-    if (options_.is_binary()) {
+    if (_state.options.is_binary()) {
         _is.seekg(streamPos + 12);
     }
 
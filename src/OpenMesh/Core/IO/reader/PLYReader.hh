@@ -132,42 +132,6 @@ public:
 
 private:
 
-  bool can_u_read(std::istream& _is) const;
-
-  bool read_ascii(std::istream& _in, BaseImporter& _bi, const Options& _opt) const;
-  bool read_binary(std::istream& _in, BaseImporter& _bi, bool swap, const Options& _opt) const;
-
-  float readToFloatValue(ValueType _type , std::fstream& _in) const;
-  template<typename Handle>
-  void readCustomProperty(std::istream& _in, BaseImporter& _bi, Handle _h, const std::string& _propName, const ValueType _valueType, const ValueType _listIndexType) const;
-
-  void readValue(ValueType _type , std::istream& _in, float& _value) const;
-  void readValue(ValueType _type, std::istream& _in, double& _value) const;
-  void readValue(ValueType _type , std::istream& _in, unsigned int& _value) const;
-  void readValue(ValueType _type , std::istream& _in, int& _value) const;
-
-  void readInteger(ValueType _type, std::istream& _in, int& _value) const;
-  void readInteger(ValueType _type, std::istream& _in, unsigned int& _value) const;
-
-  /// Read unsupported properties in PLY file
-  void consume_input(std::istream& _in, int _count) const {
-	  _in.read(reinterpret_cast<char*>(&buff[0]), _count);
-  }
-
-  mutable unsigned char buff[8];
-
-  /// Available per file options for reading
-  mutable Options options_;
-
-  /// Options that the user wants to read
-  mutable Options userOptions_;
-
-  mutable unsigned int vertexCount_;
-  mutable unsigned int faceCount_;
-
-  mutable ValueType vertexType_;
-  mutable uint vertexDimension_;
-
   enum Property {
     XCOORD,YCOORD,ZCOORD,
     TEXX,TEXY,
@@ -177,12 +141,6 @@ private:
     UNSUPPORTED
   };
 
-  /// Stores sizes of property types
-  mutable std::map<ValueType, int> scalar_size_;
-
-  // Header comments
-  mutable std::map< std::string , std::string > commentsMap_;
-
   // Number of vertex properties
   struct PropertyInfo
   {
@@ -194,8 +152,73 @@ private:
     PropertyInfo(Property _p, ValueType _v):property(_p),value(_v),name(""),listIndexType(Unsupported){}
     PropertyInfo(Property _p, ValueType _v, const std::string& _n):property(_p),value(_v),name(_n),listIndexType(Unsupported){}
   };
-  mutable std::vector< PropertyInfo > vertexProperties_;
-  mutable std::vector< PropertyInfo > faceProperties_;
+
+  /** State of a single read call, parsed from the header. It lives on the
+      stack of read(), so that the reader can be used by several threads
+      at the same time. */
+  struct ReadState
+  {
+    ReadState() : vertexCount(0), faceCount(0), vertexType(Unsupported), vertexDimension(0) {}
+
+    /// Available per file options for reading
+    Options options;
+
+    /// Options that the user wants to read
+    Options userOptions;
+
+    unsigned int vertexCount;
+    unsigned int faceCount;
+
+    ValueType vertexType;
+    uint vertexDimension;
+
+    // Header comments
+    std::map< std::string , std::string > commentsMap;
+
+    std::vector< PropertyInfo > vertexProperties;
+    std::vector< PropertyInfo > faceProperties;
+  };
+
+  bool can_u_read(std::istream& _is, ReadState& _state) const;
+
+  bool read_ascii(std::istream& _in, BaseImporter& _bi, const Options& _opt, const ReadState& _state) const;
+  bool read_binary(std::istream& _in, BaseImporter& _bi, bool swap, const Options& _opt, const ReadState& _state) const;
+
+  /** Decode the vertex element in blocks if all vertex properties are
+      scalars of a type the fast path handles, returns false otherwise
+      without consuming any input. */
+  bool read_binary_vertices_fast(std::istream& _in, BaseImporter& _bi, const Options& _opt, const ReadState& _state) const;
+
+  /** Decode the face element through a buffer if it only contains the
+      vertex_indices list, returns false otherwise without consuming any
+      input. */
+  bool read_binary_faces_fast(std::istream& _in, BaseImporter& _bi, const ReadState& _state) const;
+
+  float readToFloatValue(ValueType _type , std::fstream& _in) const;
+  template<typename Handle>
+  void readCustomProperty(std::istream& _in, BaseImporter& _bi, Handle _h, const std::string& _propName, const ValueType _valueType, const ValueType _listIndexType) const;
+
+  void readValue(ValueType _type , std::istream& _in, float& _value, const ReadState& _state) const;
+  void readValue(ValueType _type, std::istream& _in, double& _value, const ReadState& _state) const;
+  void readValue(ValueType _type , std::istream& _in, unsigned int& _value, const ReadState& _state) const;
+  void readValue(ValueType _type , std::istream& _in, int& _value, const ReadState& _state) const;
+
+  void readInteger(ValueType _type, std::istream& _in, int& _value, const ReadState& _state) const;
+  void readInteger(ValueType _type, std::istream& _in, unsigned int& _value, const ReadState& _state) const;
+
+  /// Read unsupported properties in PLY file
+  void consume_input(std::istream& _in, int _count) const {
+	  _in.ignore(_count);
+  }
+
+  /// Size in byte of a property type, 0 if the type is unsupported
+  int scalar_size(ValueType _type) const {
+    std::map<ValueType, int>::const_iterator it = scalar_size_.find(_type);
+    return (it != scalar_size_.end()) ? it->second : 0;
+  }
+
+  /// Stores sizes of property types, constant after construction
+  std::map<ValueType, int> scalar_size_;
 
 };
 
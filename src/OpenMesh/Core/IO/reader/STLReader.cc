@@ -51,18 +51,21 @@
 
 
 // STL
-#include <map>
+#include <algorithm>
+#include <vector>
 
-#include <float.h>
+#include <string.h>
 #include <fstream>
 
 // OpenMesh
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
+#include <OpenMesh/Core/IO/MappedFile.hh>
 #include <OpenMesh/Core/IO/reader/STLReader.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/IO/importer/BaseImporter.hh>
+#include <OpenMesh/Core/Utils/VertexWelderT.hh>
 
 
 //=== NAMESPACES ==============================================================
@@ -85,7 +88,7 @@ _STLReader_&  STLReader() { return __STLReaderInstance; }
 
 _STLReader_::
 _STLReader_()
-  : eps_(FLT_MIN)
+  : eps_(0.0f)
 {
   IOManager().register_module(this);
 }
@@ -167,28 +170,60 @@ _STLReader_::read(std::istream& _is,
 
 #ifndef DOXY_IGNORE_THIS
 
-class CmpVec
+/** Weld the corners of a triangle with the vertices read so far and
+    pass new vertices and the face, if it is not degenerated, to the
+    importer. _handles maps the vertex numbers of _welder to the handles
+    of the importer. A triangle without a normal (ASCII files) clears the
+    FaceNormal option. Returns false if there are too many vertices. */
+static bool add_triangle(const Vec3f _corners[3], const Vec3f& _normal,
+                         bool _has_normal, VertexWelderT<Vec3f>& _welder,
+                         std::vector<VertexHandle>& _handles,
+                         BaseImporter& _bi, Options& _opt)
 {
-public:
+  BaseImporter::VHandles vhandles(3);
 
-  CmpVec(float _eps=FLT_MIN) : eps_(_eps) {}
-
-  bool operator()( const Vec3f& _v0, const Vec3f& _v1 ) const
+  for (int i = 0; i < 3; ++i)
   {
-    if (fabs(_v0[0] - _v1[0]) <= eps_)
-    {
-      if (fabs(_v0[1] - _v1[1]) <= eps_)
-      {
-	return (_v0[2] < _v1[2] - eps_);
-      }
-      else return (_v0[1] < _v1[1] - eps_);
-    }
-    else return (_v0[0] < _v1[0] - eps_);
+    const int v = _welder.add(_corners[i]);
+    if (v < 0)
+      return false;
+
+    if (size_t(v) == _handles.size())
+      _handles.push_back(_bi.add_vertex(_corners[i]));
+    vhandles[i] = _handles[v];
   }
 
-private:
-  float eps_;
-};
+  // Add face only if it is not degenerated
+  if ((vhandles[0] != vhandles[1]) &&
+      (vhandles[0] != vhandles[2]) &&
+      (vhandles[1] != vhandles[2])) {
+
+    FaceHandle fh = _bi.add_face(vhandles);
+
+    // set the normal if requested
+    // if a normal was requested but could not be found we unset the option
+    if (_has_normal) {
+      if (fh.is_valid() && _opt.face_has_normal())
+        _bi.set_normal(fh, _normal);
+    } else
+      _opt -= Options::FaceNormal;
+  }
+
+  return true;
+}
+
+
+/// Read a little endian float from _data, swap bytes if _swap is true
+inline float read_float_le(const char* _data, bool _swap)
+{
+  union { float f; unsigned char c[4]; } fc;
+  memcpy(fc.c, _data, 4);
+  if (_swap) {
+    std::swap(fc.c[0], fc.c[3]);
+    std::swap(fc.c[1], fc.c[2]);
+  }
+  return fc.f;
+}
 
 #endif
 
@@ -240,13 +275,12 @@ read_stla(std::istream& _in, BaseImporter& _bi, Options& _opt) const
 {
 
   unsigned int               i;
-  OpenMesh::Vec3f            v;
+  OpenMesh::Vec3f            v[3];
   OpenMesh::Vec3f            n;
-  BaseImporter::VHandles     vhandles;
 
-  CmpVec comp(eps_);
-  std::map<Vec3f, VertexHandle, CmpVec>            vMap(comp);
-  std::map<Vec3f, VertexHandle, CmpVec>::iterator  vMapIt;
+  // the corners are welded while reading
+  VertexWelderT<Vec3f>       welder(eps_);
+  std::vector<VertexHandle>  handles;
 
   std::string line;
 
@@ -286,8 +320,6 @@ read_stla(std::istream& _in, BaseImporter& _bi, Options& _opt) const
     // Detected a triangle
     if ( (line.find("outer") != std::string::npos) ||  (line.find("OUTER") != std::string::npos ) ) {
 
-      vhandles.clear();
-
       for (i=0; i<3; ++i) {
         // Get one vertex
         std::getline(_in, line);
@@ -298,40 +330,13 @@ read_stla(std::istream& _in, BaseImporter& _bi, Options& _opt) const
         std::string garbage;
         strstream >> garbage;
 
-        strstream >> v[0];
-        strstream >> v[1];
-        strstream >> v[2];
-
-        // has vector been referenced before?
-        if ((vMapIt=vMap.find(v)) == vMap.end())
-        {
-          // No : add vertex and remember idx/vector mapping
-          VertexHandle handle = _bi.add_vertex(v);
-          vhandles.push_back(handle);
-          vMap[v] = handle;
-        }
-        else
-          // Yes : get index from map
-          vhandles.push_back(vMapIt->second);
-
+        strstream >> v[i][0];
+        strstream >> v[i][1];
+        strstream >> v[i][2];
       }
 
-      // Add face only if it is not degenerated
-      if ((vhandles[0] != vhandles[1]) &&
-          (vhandles[0] != vhandles[2]) &&
-          (vhandles[1] != vhandles[2])) {
-
-
-        FaceHandle fh = _bi.add_face(vhandles);
-
-        // set the normal if requested
-        // if a normal was requested but could not be found we unset the option
-        if (facet_normal) {
-          if (fh.is_valid() && _opt.face_has_normal())
-            _bi.set_normal(fh, n);
-        } else
-          _opt -= Options::FaceNormal;
-      }
+      if (!add_triangle(v, n, facet_normal, welder, handles, _bi, _opt))
+        return false;
 
       facet_normal = false;
     }
@@ -346,6 +351,12 @@ bool
 _STLReader_::
 read_stlb(const std::string& _filename, BaseImporter& _bi, Options& _opt) const
 {
+  // Parse directly from the page cache if the file can be mapped
+  MappedFile file(_filename);
+
+  if (file.is_open())
+    return read_stlb(file.data(), file.size(), _bi, _opt);
+
   std::ifstream in;
   openRead(_filename, _opt, in);
 
@@ -374,12 +385,7 @@ read_stlb(std::istream& _in, BaseImporter& _bi, Options& _opt) const
   char                       dummy[100];
   bool                       swapFlag;
   unsigned int               i, nT;
-  OpenMesh::Vec3f            v, n;
-  BaseImporter::VHandles     vhandles;
-
-  std::map<Vec3f, VertexHandle, CmpVec>  vMap;
-  std::map<Vec3f, VertexHandle, CmpVec>::iterator vMapIt;
-
+  OpenMesh::Vec3f            v[3], n;
 
   // check size of types
   if ((sizeof(float) != 4) || (sizeof(int) != 4)) {
@@ -396,11 +402,35 @@ read_stlb(std::istream& _in, BaseImporter& _bi, Options& _opt) const
   _in.read(dummy, 80);
   nT = read_int(_in, swapFlag);
 
+  if (!_in) {
+    omerr() << "[STLReader] : file is too short\n";
+    return false;
+  }
+
+  // limit the number of triangles by the remaining size if it is known
+  const std::streampos start = _in.tellg();
+  if (start != std::streampos(-1) && _in.seekg(0, std::ios::end)) {
+    const std::streamoff remaining = _in.tellg() - start;
+    _in.seekg(start);
+
+    if (remaining >= 0 && std::streamoff(nT) > remaining / 50) {
+      omerr() << "[STLReader] : file is truncated, reading "
+              << remaining / 50 << " of " << nT << " triangles\n";
+      nT = (unsigned int)(remaining / 50);
+    }
+
+    // a closed triangle mesh has about nT/2 vertices and 3*nT/2 edges
+    _bi.reserve(nT/2, 3*size_t(nT)/2, nT);
+  }
+  _in.clear();
+
+  // the corners are welded while reading
+  VertexWelderT<Vec3f>      welder(eps_);
+  std::vector<VertexHandle> handles;
+
   // read triangles
   while (nT)
   {
-    vhandles.clear();
-
     // read triangle normal
     n[0] = read_float(_in, swapFlag);
     n[1] = read_float(_in, swapFlag);
@@ -409,35 +439,21 @@ read_stlb(std::istream& _in, BaseImporter& _bi, Options& _opt) const
     // triangle's vertices
     for (i=0; i<3; ++i)
     {
-      v[0] = read_float(_in, swapFlag);
-      v[1] = read_float(_in, swapFlag);
-      v[2] = read_float(_in, swapFlag);
-
-      // has vector been referenced before?
-      if ((vMapIt=vMap.find(v)) == vMap.end())
-      {
-        // No : add vertex and remember idx/vector mapping
-        VertexHandle handle = _bi.add_vertex(v);
-        vhandles.push_back(handle);
-        vMap[v] = handle;
-      }
-      else
-        // Yes : get index from map
-        vhandles.push_back(vMapIt->second);
+      v[i][0] = read_float(_in, swapFlag);
+      v[i][1] = read_float(_in, swapFlag);
+      v[i][2] = read_float(_in, swapFlag);
     }
 
+    _in.read(dummy, 2);
 
-    // Add face only if it is not degenerated
-    if ((vhandles[0] != vhandles[1]) &&
-	(vhandles[0] != vhandles[2]) &&
-	(vhandles[1] != vhandles[2])) {
-      FaceHandle fh = _bi.add_face(vhandles);
-
-      if (fh.is_valid() && _opt.face_has_normal())
-        _bi.set_normal(fh, n);
+    if (!_in) {
+      omerr() << "[STLReader] : file is truncated\n";
+      break;
     }
 
-    _in.read(dummy, 2);
+    if (!add_triangle(v, n, true, welder, handles, _bi, _opt))
+      return false;
+
     --nT;
   }
 
@@ -446,6 +462,80 @@ read_stlb(std::istream& _in, BaseImporter& _bi, Options& _opt) const
 
 //-----------------------------------------------------------------------------
 
+bool
+_STLReader_::
+read_stlb(const char* _data, size_t _size, BaseImporter& _bi, Options& _opt) const
+{
+  unsigned int               i, nT;
+
+  // check size of types
+  if ((sizeof(float) != 4) || (sizeof(int) != 4)) {
+    omerr() << "[STLReader] : wrong type size\n";
+    return false;
+  }
+
+  if (_size < 84) {
+    omerr() << "[STLReader] : file is too short\n";
+    return false;
+  }
+
+  // determine endian mode
+  union { unsigned int i; unsigned char c[4]; } endian_test;
+  endian_test.i = 1;
+  const bool swapFlag = (endian_test.c[3] == 1);
+
+  // read number of triangles
+  union { unsigned int i; unsigned char c[4]; } ic;
+  memcpy(ic.c, _data + 80, 4);
+  if (swapFlag) {
+    std::swap(ic.c[0], ic.c[3]);
+    std::swap(ic.c[1], ic.c[2]);
+  }
+  nT = ic.i;
+
+  if ((_size - 84) / 50 < nT) {
+    omerr() << "[STLReader] : file is truncated, reading "
+            << (_size - 84) / 50 << " of " << nT << " triangles\n";
+    nT = (unsigned int)((_size - 84) / 50);
+  }
+
+  // a closed triangle mesh has about nT/2 vertices and 3*nT/2 edges
+  _bi.reserve(nT/2, 3*size_t(nT)/2, nT);
+
+  // the corners are welded while reading
+  VertexWelderT<Vec3f>      welder(eps_);
+  std::vector<VertexHandle> handles;
+  Vec3f                     v[3], n;
+
+  // each triangle record: normal, 3 vertices, 2 byte attribute
+  const char* p = _data + 84;
+
+  for (size_t t = 0; t < nT; ++t, p += 50)
+  {
+    // read triangle normal
+    n[0] = read_float_le(p,     swapFlag);
+    n[1] = read_float_le(p + 4, swapFlag);
+    n[2] = read_float_le(p + 8, swapFlag);
+
+    // triangle's vertices
+    for (i=0; i<3; ++i)
+    {
+      const char* pv = p + 12 + 12*i;
+
+      v[i][0] = read_float_le(pv,     swapFlag);
+      v[i][1] = read_float_le(pv + 4, swapFlag);
+      v[i][2] = read_float_le(pv + 8, swapFlag);
+    }
+
+    if (!add_triangle(v, n, true, welder, handles, _bi, _opt))
+      return false;
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
 _STLReader_::STL_Type
 _STLReader_::
 check_stl_type(const std::string& _filename) const
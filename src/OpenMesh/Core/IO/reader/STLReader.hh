@@ -114,7 +114,8 @@ public:
             Options& _opt);
 
   /** Set the threshold to be used for considering two point to be equal.
-      Can be used to merge small gaps */
+      Can be used to merge small gaps. The default 0 merges only points
+      with equal coordinates. \see VertexWelderT */
   void set_epsilon(float _eps) { eps_=_eps; }
 
   /// Returns the threshold to be used for considering two point to be equal.
@@ -131,6 +132,7 @@ private:
   bool read_stla(std::istream& _in, BaseImporter& _bi, Options& _opt) const;
   bool read_stlb(const std::string& _filename, BaseImporter& _bi, Options& _opt) const;
   bool read_stlb(std::istream& _in, BaseImporter& _bi, Options& _opt) const;
+  bool read_stlb(const char* _data, size_t _size, BaseImporter& _bi, Options& _opt) const;
 
 
 private:
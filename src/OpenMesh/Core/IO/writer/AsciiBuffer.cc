@@ -0,0 +1,163 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+
+//=============================================================================
+//
+//  CLASS AsciiBuffer - IMPLEMENTATION
+//
+//=============================================================================
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/IO/writer/AsciiBuffer.hh>
+
+#include <algorithm>
+#include <clocale>
+#include <cstdio>
+#include <locale>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== IMPLEMENTATION ===========================================================
+
+
+AsciiBuffer::AsciiBuffer(const std::ostream& _os)
+{
+  const std::ios_base::fmtflags flags = _os.flags();
+  const bool upper = (flags & std::ios_base::uppercase) != 0;
+
+  // build the printf format a std::ostream uses for a double
+  char* f = format_;
+  *f++ = '%';
+  if (flags & std::ios_base::showpos)   *f++ = '+';
+  if (flags & std::ios_base::showpoint) *f++ = '#';
+  *f++ = '.';
+  *f++ = '*';
+  switch (flags & std::ios_base::floatfield) {
+    case std::ios_base::fixed:      *f++ = 'f';               break;
+    case std::ios_base::scientific: *f++ = upper ? 'E' : 'e'; break;
+    default:                        *f++ = upper ? 'G' : 'g'; break;
+  }
+  *f = 0;
+
+  // enough for any fixed double in the buffer of append_double
+  precision_ = int(std::min(_os.precision(), std::streamsize(100)));
+  if (precision_ < 0)
+    precision_ = 6;
+
+  decimal_point_   = std::use_facet< std::numpunct<char> >(_os.getloc()).decimal_point();
+  c_decimal_point_ = std::localeconv()->decimal_point[0];
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void AsciiBuffer::append_integer(long _v)
+{
+  if (_v < 0) {
+    buf_.push_back('-');
+    // negate in unsigned arithmetic, valid for the smallest long as well
+    append_unsigned(0ul - (unsigned long)(_v));
+  } else {
+    append_unsigned((unsigned long)(_v));
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void AsciiBuffer::append_unsigned(unsigned long _v)
+{
+  char digits[24];
+  char* p = digits + sizeof(digits);
+  do {
+    *--p = char('0' + _v % 10);
+    _v /= 10;
+  } while (_v);
+  buf_.append(p, digits + sizeof(digits));
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+void AsciiBuffer::append_double(double _v)
+{
+  // a fixed double needs at most 309 digits plus the precision
+  char tmp[512];
+  const int n = std::sprintf(tmp, format_, precision_, _v);
+  if (n <= 0)
+    return;
+
+  // sprintf uses the decimal point of the C locale, the stream its own
+  if (decimal_point_ != c_decimal_point_)
+    for (int i = 0; i < n; ++i)
+      if (tmp[i] == c_decimal_point_) {
+        tmp[i] = decimal_point_;
+        break;
+      }
+
+  buf_.append(tmp, size_t(n));
+}
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
@@ -0,0 +1,202 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+
+
+//=============================================================================
+//
+//  CLASS AsciiBuffer
+//
+//=============================================================================
+
+#ifndef OPENMESH_IO_ASCIIBUFFER_HH
+#define OPENMESH_IO_ASCIIBUFFER_HH
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Geometry/VectorT.hh>
+// -------------------- STL
+#include <algorithm>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+namespace IO {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Character buffer the ASCII writers format their lines into.
+
+    Numbers are formatted exactly like a std::ostream with the precision,
+    the float field and the decimal point of the stream given to the
+    constructor would do it, but without the overhead of the stream
+    (digit grouping is not supported). Several buffers can be filled in
+    parallel, see write_ascii_blocks().
+*/
+class OPENMESHDLLEXPORT AsciiBuffer
+{
+public:
+
+  /// Use the number format of _os
+  explicit AsciiBuffer(const std::ostream& _os);
+
+  AsciiBuffer& operator<<(const char* _s) { buf_.append(_s); return *this; }
+  AsciiBuffer& operator<<(const std::string& _s) { buf_.append(_s); return *this; }
+
+  AsciiBuffer& operator<<(char _c)          { buf_.push_back(_c); return *this; }
+  AsciiBuffer& operator<<(signed char _c)   { buf_.push_back(char(_c)); return *this; }
+  AsciiBuffer& operator<<(unsigned char _c) { buf_.push_back(char(_c)); return *this; }
+
+  AsciiBuffer& operator<<(short _v)          { append_integer(long(_v)); return *this; }
+  AsciiBuffer& operator<<(unsigned short _v) { append_unsigned((unsigned long)(_v)); return *this; }
+  AsciiBuffer& operator<<(int _v)            { append_integer(long(_v)); return *this; }
+  AsciiBuffer& operator<<(unsigned int _v)   { append_unsigned((unsigned long)(_v)); return *this; }
+  AsciiBuffer& operator<<(long _v)           { append_integer(_v); return *this; }
+  AsciiBuffer& operator<<(unsigned long _v)  { append_unsigned(_v); return *this; }
+
+  AsciiBuffer& operator<<(float _v)  { append_double(double(_v)); return *this; }
+  AsciiBuffer& operator<<(double _v) { append_double(_v); return *this; }
+
+  /// Space separated components, like the stream operator of VectorT
+  template <typename Scalar, int N>
+  AsciiBuffer& operator<<(const VectorT<Scalar,N>& _v)
+  {
+    for (int i = 0; i < N-1; ++i)
+      *this << _v[i] << ' ';
+    return *this << _v[N-1];
+  }
+
+  /// Number of characters in the buffer
+  size_t size() const { return buf_.size(); }
+
+  /// Remove all characters, the memory is kept
+  void clear() { buf_.clear(); }
+
+  /// Write the characters to _os
+  void write(std::ostream& _os) const
+  { _os.write(buf_.data(), std::streamsize(buf_.size())); }
+
+private:
+
+  void append_integer(long _v);
+  void append_unsigned(unsigned long _v);
+  void append_double(double _v);
+
+  std::string buf_;
+  char        format_[8];
+  int         precision_;
+  char        decimal_point_;
+  char        c_decimal_point_;
+};
+
+
+//== FUNCTIONS ================================================================
+
+
+/** Call _format(buffer, begin, end) for consecutive blocks [begin,end) of
+    the elements 0, ..., _n-1 and write the buffers to _out in the order of
+    the elements. The blocks are formatted in parallel, if OpenMP is
+    available, so _format must only read shared data. The output does not
+    depend on the number of threads.
+*/
+template <class Format>
+void write_ascii_blocks(std::ostream& _out, size_t _n, const Format& _format)
+{
+  const size_t block_size = 4096;
+  const size_t n_blocks   = (_n + block_size - 1) / block_size;
+
+#ifdef _OPENMP
+  const size_t n_buffers = (n_blocks > 1) ? size_t(omp_get_max_threads()) : 1;
+#else
+  const size_t n_buffers = 1;
+#endif
+
+  std::vector<AsciiBuffer> buffers(n_buffers, AsciiBuffer(_out));
+
+  for (size_t first = 0; first < n_blocks; first += n_buffers)
+  {
+    const int n_round = int(std::min(n_buffers, n_blocks - first));
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static, 1) if(n_round > 1)
+#endif
+    for (int b = 0; b < n_round; ++b)
+    {
+      AsciiBuffer& buffer = buffers[b];
+      buffer.clear();
+
+      const size_t begin = (first + size_t(b)) * block_size;
+      _format(buffer, begin, std::min(begin + block_size, _n));
+    }
+
+    for (int b = 0; b < n_round; ++b)
+      buffers[b].write(_out);
+  }
+}
+
+
+//=============================================================================
+} // namespace IO
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_IO_ASCIIBUFFER_HH defined
+//=============================================================================
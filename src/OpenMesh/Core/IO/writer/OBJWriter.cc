@@ -58,6 +58,7 @@
 #include <OpenMesh/Core/System/config.h>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
 #include <OpenMesh/Core/IO/writer/OBJWriter.hh>
+#include <OpenMesh/Core/IO/writer/AsciiBuffer.hh>
 #include <OpenMesh/Core/IO/IOManager.hh>
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/color_cast.hh>
@@ -77,6 +78,90 @@ _OBJWriter_  __OBJWriterinstance;
 _OBJWriter_& OBJWriter() { return __OBJWriterinstance; }
 
 
+//=== HELPERS =================================================================
+
+
+/// Formats the v, vn and vt lines of a block of vertices
+class OBJVertexFormat
+{
+public:
+
+  OBJVertexFormat(const BaseExporter& _be, const Options& _opt)
+  : be_(_be), normals_(_opt.check(Options::VertexNormal)),
+    texcoords_(_opt.check(Options::VertexTexCoord))
+  {}
+
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
+  {
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      const VertexHandle vh = VertexHandle(int(i));
+      const Vec3f v = be_.point(vh);
+      _buf << "v " << v[0] << ' ' << v[1] << ' ' << v[2] << '\n';
+
+      if (normals_) {
+        const Vec3f n = be_.normal(vh);
+        _buf << "vn " << n[0] << ' ' << n[1] << ' ' << n[2] << '\n';
+      }
+
+      if (texcoords_) {
+        const Vec2f t = be_.texcoord(vh);
+        _buf << "vt " << t[0] << ' ' << t[1] << '\n';
+      }
+    }
+  }
+
+private:
+
+  const BaseExporter& be_;
+  bool normals_, texcoords_;
+};
+
+
+/// Formats the f lines of a block of faces without materials and face texcoords
+class OBJFaceFormat
+{
+public:
+
+  OBJFaceFormat(const BaseExporter& _be, const Options& _opt)
+  : be_(_be), normals_(_opt.vertex_has_normal()),
+    texcoords_(_opt.vertex_has_texcoord())
+  {}
+
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
+  {
+    std::vector<VertexHandle> vhandles;
+
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      be_.get_vhandles(FaceHandle(int(i)), vhandles);
+
+      _buf << 'f';
+      for (size_t j = 0; j < vhandles.size(); ++j)
+      {
+        // indices starting at 1 not 0
+        const unsigned int idx = vhandles[j].idx() + 1;
+        _buf << ' ' << idx;
+
+        if (texcoords_ || normals_) {
+          _buf << '/';
+          if (texcoords_)
+            _buf << idx;
+          if (normals_)
+            _buf << '/' << idx;
+        }
+      }
+      _buf << '\n';
+    }
+  }
+
+private:
+
+  const BaseExporter& be_;
+  bool normals_, texcoords_;
+};
+
+
 //=== IMPLEMENTATION ==========================================================
 
 
@@ -102,6 +187,7 @@ write(const std::string& _filename, BaseExporter& _be, Options _opt, std::stream
 
   out.precision(_precision);
 
+  std::string path, objName;
   {
 #if defined(WIN32)
     std::string::size_type dot = _filename.find_last_of("\\/");
@@ -110,21 +196,21 @@ write(const std::string& _filename, BaseExporter& _be, Options _opt, std::stream
 #endif
 
     if (dot == std::string::npos){
-      path_ = "./";
-      objName_ = _filename;
+      path = "./";
+      objName = _filename;
     }else{
-      path_ = _filename.substr(0,dot+1);
-      objName_ = _filename.substr(dot+1);
+      path = _filename.substr(0,dot+1);
+      objName = _filename.substr(dot+1);
     }
 
     //remove the file extension
-    dot = objName_.find_last_of(".");
+    dot = objName.find_last_of(".");
 
     if(dot != std::string::npos)
-      objName_ = objName_.substr(0,dot);
+      objName = objName.substr(0,dot);
   }
 
-  bool result = write(out, _be, _opt, _precision);
+  bool result = write(out, _be, _opt, _precision, path, objName);
 
   out.close();
   return result;
@@ -132,41 +218,48 @@ write(const std::string& _filename, BaseExporter& _be, Options _opt, std::stream
 
 //-----------------------------------------------------------------------------
 
-size_t _OBJWriter_::getMaterial(OpenMesh::Vec3f _color) const
+size_t _OBJWriter_::getMaterial(Materials& _materials, OpenMesh::Vec3f _color) const
 {
-  for (size_t i=0; i < material_.size(); i++)
-    if(material_[i] == _color)
+  std::vector< OpenMesh::Vec3f >& material = _materials.material_;
+
+  for (size_t i=0; i < material.size(); i++)
+    if(material[i] == _color)
       return i;
 
   //not found add new material
-  material_.push_back( _color );
-  return material_.size()-1;
+  material.push_back( _color );
+  return material.size()-1;
 }
 
 //-----------------------------------------------------------------------------
 
-size_t _OBJWriter_::getMaterial(OpenMesh::Vec4f _color) const
+size_t _OBJWriter_::getMaterial(Materials& _materials, OpenMesh::Vec4f _color) const
 {
-  for (size_t i=0; i < materialA_.size(); i++)
-    if(materialA_[i] == _color)
+  std::vector< OpenMesh::Vec4f >& materialA = _materials.materialA_;
+
+  for (size_t i=0; i < materialA.size(); i++)
+    if(materialA[i] == _color)
       return i;
 
   //not found add new material
-  materialA_.push_back( _color );
-  return materialA_.size()-1;
+  materialA.push_back( _color );
+  return materialA.size()-1;
 }
 
 //-----------------------------------------------------------------------------
 
 bool
 _OBJWriter_::
-writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt) const
+writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt, Materials& _materials) const
 {
   OpenMesh::Vec3f c;
   OpenMesh::Vec4f cA;
 
-  material_.clear();
-  materialA_.clear();
+  std::vector< OpenMesh::Vec3f >& material  = _materials.material_;
+  std::vector< OpenMesh::Vec4f >& materialA = _materials.materialA_;
+
+  material.clear();
+  materialA.clear();
   if ( _opt.face_has_color() ) {
     //iterate over faces
     for (size_t i=0, nF=_be.n_faces(); i<nF; ++i)
@@ -174,28 +267,28 @@ writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt) const
       //color with alpha
       if ( _opt.color_has_alpha() ){
         cA  = color_cast<OpenMesh::Vec4f> (_be.colorA( FaceHandle(int(i)) ));
-        getMaterial(cA);
+        getMaterial(_materials, cA);
       }else{
       //and without alpha
         c  = color_cast<OpenMesh::Vec3f> (_be.color( FaceHandle(int(i)) ));
-        getMaterial(c);
+        getMaterial(_materials, c);
       }
     }
 
     //write the materials
     if ( _opt.color_has_alpha() ) {
-      for (size_t i=0; i < materialA_.size(); i++){
+      for (size_t i=0; i < materialA.size(); i++){
         _out << "newmtl " << "mat" << i << '\n';
         _out << "Ka 0.5000 0.5000 0.5000" << '\n';
-        _out << "Kd " << materialA_[i][0] << materialA_[i][1] << materialA_[i][2] << '\n';
-        _out << "Tr " << materialA_[i][3] << '\n';
+        _out << "Kd " << materialA[i][0] << materialA[i][1] << materialA[i][2] << '\n';
+        _out << "Tr " << materialA[i][3] << '\n';
         _out << "illum 1" << '\n';
       }
     } else {
-      for (size_t i=0; i < material_.size(); i++){
+      for (size_t i=0; i < material.size(); i++){
         _out << "newmtl " << "mat" << i << '\n';
         _out << "Ka 0.5000 0.5000 0.5000" << '\n';
-        _out << "Kd " << material_[i][0] << material_[i][1] << material_[i][2] << '\n';
+        _out << "Kd " << material[i][0] << material[i][1] << material[i][2] << '\n';
         _out << "illum 1" << '\n';
       }
     }
@@ -216,13 +309,21 @@ writeMaterial(std::ostream& _out, BaseExporter& _be, Options _opt) const
 bool
 _OBJWriter_::
 write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _precision) const
+{
+  return write(_out, _be, _opt, _precision, std::string(), std::string());
+}
+
+//-----------------------------------------------------------------------------
+
+
+bool
+_OBJWriter_::
+write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _precision,
+      const std::string& _path, const std::string& _objName) const
 {
   unsigned int idx;
-  size_t i, j, k, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
+  size_t i, j, k, nF;
   std::vector<Vec2f> texcoords;
-  VertexHandle vh;
   std::vector<VertexHandle> vhandles;
   bool useMaterial = false;
   std::string mtlFileName;
@@ -231,6 +332,7 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
   VertexTexcoordMap vtm;
   std::vector<int> faceTexcoordIdx;
   int nextTexcoordIdx;
+  Materials materials;
 
   omlog() << "[OBJWriter] : write file\n";
 
@@ -251,8 +353,8 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
   if ( _opt.face_has_color() || _opt.mesh_has_texfile() ) {
     useMaterial = true;
 
-    mtlFileName = objName_ + ".mtl";
-    std::string mtlFilePath = path_ + mtlFileName;
+    mtlFileName = _objName + ".mtl";
+    std::string mtlFilePath = _path + mtlFileName;
 
     std::ofstream mtlStream;
     openWrite(mtlFilePath, _opt, mtlStream);
@@ -262,7 +364,7 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
       omerr() << "[OBJWriter] : cannot write material file " << mtlFilePath << std::endl;
       return false;
     } else {
-      writeMaterial(mtlStream, _be, _opt);
+      writeMaterial(mtlStream, _be, _opt, materials);
       mtlStream.close();
     }
   }
@@ -276,21 +378,7 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
     _out << "mtllib " << mtlFileName << '\n';
 
   // vertex data (point, normals, texcoords)
-  for (i=0, nV=_be.n_vertices(); i<nV; ++i)
-  {
-    vh = VertexHandle(int(i));
-    v  = _be.point(vh);
-    n  = _be.normal(vh);
-    t  = _be.texcoord(vh);
-
-    _out << "v " << v[0] <<" "<< v[1] <<" "<< v[2] << '\n';
-
-    if (_opt.check(Options::VertexNormal))
-      _out << "vn " << n[0] <<" "<< n[1] <<" "<< n[2] << '\n';
-
-    if (_opt.check(Options::VertexTexCoord))
-      _out << "vt " << t[0] <<" "<< t[1] << '\n';
-  }
+  write_ascii_blocks(_out, _be.n_vertices(), OBJVertexFormat(_be, _opt));
 
   size_t lastMat = std::numeric_limits<std::size_t>::max();
 
@@ -305,6 +393,12 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
                       && !_opt.face_has_texcoord()
                       && !_opt.vertex_has_normal();
 
+  // faces without materials and face texcoords do not depend on each other
+  if ( !_opt.face_has_color() && !_opt.face_has_texcoord() ) {
+    write_ascii_blocks(_out, _be.n_faces(), OBJFaceFormat(_be, _opt));
+    return true;
+  }
+
   // faces (indices starting at 1 not 0)
   for (i=0, nF=_be.n_faces(); i<nF; ++i)
   {
@@ -315,11 +409,11 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
       //color with alpha
       if ( _opt.color_has_alpha() ){
         cA  = color_cast<OpenMesh::Vec4f> (_be.colorA( FaceHandle(int(i)) ));
-        material = getMaterial(cA);
+        material = getMaterial(materials, cA);
       } else{
       //and without alpha
         c  = color_cast<OpenMesh::Vec3f> (_be.color( FaceHandle(int(i)) ));
-        material = getMaterial(c);
+        material = getMaterial(materials, c);
       }
 
       // if we are ina a new material block, specify in the file which material to use
@@ -393,9 +487,6 @@ write(std::ostream& _out, BaseExporter& _be, Options _opt, std::streamsize _prec
     _out << '\n';
   }
 
-  material_.clear();
-  materialA_.clear();
-
   return true;
 }
 
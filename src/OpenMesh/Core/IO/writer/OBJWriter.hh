@@ -104,17 +104,23 @@ public:
 
 private:
 
-  mutable std::string path_;
-  mutable std::string objName_;
+  /// Material colors collected during a single write call
+  struct Materials
+  {
+    std::vector< OpenMesh::Vec3f > material_;
+    std::vector< OpenMesh::Vec4f > materialA_;
+  };
 
-  mutable std::vector< OpenMesh::Vec3f > material_;
-  mutable std::vector< OpenMesh::Vec4f > materialA_;
+  /// Write the mesh and its material file \c _path + \c _objName + ".mtl".
+  /// All state of a write is local to this call.
+  bool write(std::ostream&, BaseExporter&, Options, std::streamsize _precision,
+             const std::string& _path, const std::string& _objName) const;
 
-  size_t getMaterial(OpenMesh::Vec3f _color) const;
+  size_t getMaterial(Materials& _materials, OpenMesh::Vec3f _color) const;
 
-  size_t getMaterial(OpenMesh::Vec4f _color) const;
+  size_t getMaterial(Materials& _materials, OpenMesh::Vec4f _color) const;
 
-  bool writeMaterial(std::ostream& _out, BaseExporter&, Options) const;
+  bool writeMaterial(std::ostream& _out, BaseExporter&, Options, Materials& _materials) const;
 
   struct VertexTexcoord
   {
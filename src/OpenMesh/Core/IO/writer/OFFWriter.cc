@@ -56,6 +56,7 @@
 #include <OpenMesh/Core/IO/IOManager.hh>
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
 #include <OpenMesh/Core/IO/writer/OFFWriter.hh>
+#include <OpenMesh/Core/IO/writer/AsciiBuffer.hh>
 
 #include <OpenMesh/Core/IO/SR_store.hh>
 
@@ -74,6 +75,112 @@ _OFFWriter_  __OFFWriterInstance;
 _OFFWriter_& OFFWriter() { return __OFFWriterInstance; }
 
 
+//=== HELPERS =================================================================
+
+
+/// Append the vertex or face color of an OFF line
+template <class Handle>
+static inline void append_off_color(AsciiBuffer& _buf, const BaseExporter& _be, Handle _h, const Options& _opt)
+{
+  if ( _opt.color_is_float() ) {
+    if ( _opt.color_has_alpha() )
+      _buf << ' ' << _be.colorAf(_h);
+    else
+      _buf << ' ' << _be.colorf(_h);
+  } else {
+    if ( _opt.color_has_alpha() )
+      _buf << ' ' << OpenMesh::Vec4i(_be.colorA(_h));
+    else
+      _buf << ' ' << OpenMesh::Vec3i(_be.color(_h));
+  }
+}
+
+
+/// Formats the lines of a block of vertices of an ASCII OFF file
+class OFFVertexFormat
+{
+public:
+
+  OFFVertexFormat(const BaseExporter& _be, const Options& _opt) : be_(_be), opt_(_opt) {}
+
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
+  {
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      const VertexHandle vh = VertexHandle(int(i));
+      const Vec3f v = be_.point(vh);
+
+      //Vertex
+      _buf << v[0] << ' ' << v[1] << ' ' << v[2];
+
+      // VertexNormal
+      if ( opt_.vertex_has_normal() ) {
+        const Vec3f n = be_.normal(vh);
+        _buf << ' ' << n[0] << ' ' << n[1] << ' ' << n[2];
+      }
+
+      // VertexColor
+      if ( opt_.vertex_has_color() )
+        append_off_color(_buf, be_, vh, opt_);
+
+      // TexCoord
+      if ( opt_.vertex_has_texcoord() ) {
+        const Vec2f t = be_.texcoord(vh);
+        _buf << ' ' << t[0] << ' ' << t[1];
+      }
+
+      _buf << '\n';
+    }
+  }
+
+private:
+
+  const BaseExporter& be_;
+  const Options       opt_;
+};
+
+
+/// Formats the lines of a block of faces of an ASCII OFF file
+class OFFFaceFormat
+{
+public:
+
+  OFFFaceFormat(const BaseExporter& _be, const Options& _opt) : be_(_be), opt_(_opt) {}
+
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
+  {
+    std::vector<VertexHandle> vhandles;
+    const bool triangles = be_.is_triangle_mesh();
+
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      const FaceHandle fh = FaceHandle(int(i));
+      const unsigned int nV = be_.get_vhandles(fh, vhandles);
+
+      // indices starting at 0
+      if (triangles) {
+        _buf << 3 << ' ' << vhandles[0].idx() << ' ' << vhandles[1].idx() << ' ' << vhandles[2].idx();
+      } else {
+        _buf << nV << ' ';
+        for (size_t j = 0; j < vhandles.size(); ++j)
+          _buf << vhandles[j].idx() << ' ';
+      }
+
+      //face color
+      if ( opt_.face_has_color() )
+        append_off_color(_buf, be_, fh, opt_);
+
+      _buf << '\n';
+    }
+  }
+
+private:
+
+  const BaseExporter& be_;
+  const Options       opt_;
+};
+
+
 //=== IMPLEMENTATION ==========================================================
 
 
@@ -182,18 +289,6 @@ bool
 _OFFWriter_::
 write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
 {
-
-  unsigned int i, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
-  OpenMesh::Vec3i c;
-  OpenMesh::Vec4i cA;
-  OpenMesh::Vec3f cf;
-  OpenMesh::Vec4f cAf;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
-
-
   // #vertices, #faces
   _out << _be.n_vertices() << " ";
   _out << _be.n_faces() << " ";
@@ -202,133 +297,11 @@ write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
   if (_opt.color_is_float())
     _out << std::fixed;
 
-
   // vertex data (point, normals, colors, texcoords)
-  for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
-  {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
-    //Vertex
-    _out << v[0] << " " << v[1] << " " << v[2];
-
-    // VertexNormal
-    if ( _opt.vertex_has_normal() ) {
-      n  = _be.normal(vh);
-      _out << " " << n[0] << " " << n[1] << " " << n[2];
-    }
-
-    // VertexColor
-    if ( _opt.vertex_has_color() ) {
-      if ( _opt.color_is_float() ) {
-        //with alpha
-        if ( _opt.color_has_alpha() ){
-          cAf  = _be.colorAf(vh);
-          _out << " " << cAf;
-        }else{
-          //without alpha
-          cf  = _be.colorf(vh);
-          _out << " " << cf;
-        }
-      } else {
-        //with alpha
-        if ( _opt.color_has_alpha() ){
-          cA  = _be.colorA(vh);
-          _out << " " << cA;
-        }else{
-          //without alpha
-          c  = _be.color(vh);
-          _out << " " << c;
-        }
-      }
-    }
-
-    // TexCoord
-    if (_opt.vertex_has_texcoord() ) {
-      t  = _be.texcoord(vh);
-      _out << " " << t[0] << " " << t[1];
-    }
-
-    _out << '\n';
-
-  }
-
-  // faces (indices starting at 0)
-  if (_be.is_triangle_mesh())
-  {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      _be.get_vhandles(FaceHandle(i), vhandles);
-      _out << 3 << " ";
-      _out << vhandles[0].idx()  << " ";
-      _out << vhandles[1].idx()  << " ";
-      _out << vhandles[2].idx();
-
-      //face color
-      if ( _opt.face_has_color() ){
-        if ( _opt.color_is_float() ) {
-          //with alpha
-          if ( _opt.color_has_alpha() ){
-            cAf  = _be.colorAf( FaceHandle(i) );
-            _out << " " << cAf;
-          }else{
-            //without alpha
-            cf  = _be.colorf( FaceHandle(i) );
-            _out << " " << cf;
-          }
-        } else {
-          //with alpha
-          if ( _opt.color_has_alpha() ){
-            cA  = _be.colorA( FaceHandle(i) );
-            _out << " " << cA;
-          }else{
-            //without alpha
-            c  = _be.color( FaceHandle(i) );
-            _out << " " << c;
-          }
-        }
-      }
-      _out << '\n';
-    }
-  }
-  else
-  {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
-      _out << nV << " ";
-      for (size_t j=0; j<vhandles.size(); ++j)
-	       _out << vhandles[j].idx() << " ";
-
-      //face color
-      if ( _opt.face_has_color() ){
-        if ( _opt.color_is_float() ) {
-          //with alpha
-          if ( _opt.color_has_alpha() ){
-            cAf  = _be.colorAf( FaceHandle(i) );
-            _out << " " << cAf;
-          }else{
-            //without alpha
-            cf  = _be.colorf( FaceHandle(i) );
-            _out << " " << cf;
-          }
-        } else {
-          //with alpha
-          if ( _opt.color_has_alpha() ){
-            cA  = _be.colorA( FaceHandle(i) );
-            _out << " " << cA;
-          }else{
-            //without alpha
-            c  = _be.color( FaceHandle(i) );
-            _out << " " << c;
-          }
-        }
-      }
-
-      _out << '\n';
-    }
-  }
+  write_ascii_blocks(_out, _be.n_vertices(), OFFVertexFormat(_be, _opt));
 
+  // faces
+  write_ascii_blocks(_out, _be.n_faces(), OFFFaceFormat(_be, _opt));
 
   return true;
 }
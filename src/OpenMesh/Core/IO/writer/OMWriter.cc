@@ -61,10 +61,12 @@
 
 #include <fstream>
 #include <ostream>
+#include <sstream>
 #include <vector>
 
 // -------------------- OpenMesh
 #include <OpenMesh/Core/IO/OMFormat.hh>
+#include <OpenMesh/Core/IO/OMCodec.hh>
 #include <OpenMesh/Core/System/omstream.hh>
 #include <OpenMesh/Core/Utils/Endian.hh>
 #include <OpenMesh/Core/IO/exporter/BaseExporter.hh>
@@ -177,6 +179,118 @@ template <typename T> struct Enabler
 #endif
 
 
+/** Writes one chunk after the other. Without compression the header and
+    the data go directly to the stream. With compression the data is
+    collected and written after the header with the codec given to begin(),
+    unless the codec does not make it smaller.
+*/
+class OMChunkWriter
+{
+public:
+
+  typedef OMFormat::Chunk::Header       ChunkHeader;
+  typedef OMFormat::Chunk::CodecHeader  CodecHeader;
+  typedef OMFormat::Chunk::PropertyName PropertyName;
+
+  OMChunkWriter(std::ostream& _os, bool _compress, bool _swap)
+    : os_(_os), compress_(_compress), swap_(_swap), named_(false), collected_(0)
+  {}
+
+  /// Are the bytes of the values swapped?
+  bool swap() const { return swap_; }
+
+  /// Start a chunk, returns the number of bytes written
+  size_t begin(const ChunkHeader& _chunk_header,
+               OMFormat::Chunk::Codec _codec,
+               unsigned int _width = 1, unsigned int _stride = 1,
+               const PropertyName* _name = 0)
+  {
+    chunk_header_ = _chunk_header;
+    chunk_header_.compressed_ = 0;
+
+    named_ = (_name != 0);
+    if (named_)
+      name_ = *_name;
+
+    codec_header_.codec_  = OMFormat::uint8(_codec);
+    codec_header_.width_  = OMFormat::uint8(_width);
+    codec_header_.stride_ = OMFormat::uint8(_stride);
+
+    if (compress_)
+    {
+      buffer_.str(std::string());
+      return 0;
+    }
+    return store_header();
+  }
+
+  /// Stream for the data of the current chunk
+  std::ostream& data() { return compress_ ? buffer_ : os_; }
+
+  /// Finish the chunk, returns the number of bytes written
+  size_t end()
+  {
+    if (!compress_)
+      return 0;
+
+    const std::string raw = buffer_.str();
+    buffer_.str(std::string());
+    collected_ += raw.size();
+
+    std::string packed;
+    chunk_header_.compressed_ =
+      raw.size() <= 0xffffffff &&
+      OMFormat::compress(OMFormat::Chunk::Codec(codec_header_.codec_),
+                         codec_header_.width_, codec_header_.stride_,
+                         raw.data(), raw.size(), packed) &&
+      packed.size() + sizeof(CodecHeader) < raw.size();
+
+    size_t bytes = store_header();
+
+    if (chunk_header_.compressed_)
+    {
+      codec_header_.raw_size_    = OMFormat::uint32(raw.size());
+      codec_header_.packed_size_ = OMFormat::uint32(packed.size());
+      bytes += store(os_, codec_header_, swap_);
+      os_.write(packed.data(), std::streamsize(packed.size()));
+      bytes += packed.size();
+    }
+    else
+    {
+      os_.write(raw.data(), std::streamsize(raw.size()));
+      bytes += raw.size();
+    }
+    return bytes;
+  }
+
+  /// Number of data bytes collected for compression, they are counted
+  /// by the caller although end() wrote the compressed data instead
+  size_t collected_bytes() const { return collected_; }
+
+private:
+
+  size_t store_header()
+  {
+    size_t bytes = store(os_, chunk_header_, swap_);
+    if (named_)
+      bytes += store(os_, name_, swap_);
+    return bytes;
+  }
+
+  std::ostream&      os_;
+  bool               compress_;
+  bool               swap_;
+
+  ChunkHeader        chunk_header_;
+  CodecHeader        codec_header_;
+  bool               named_;
+  PropertyName       name_;
+
+  std::ostringstream buffer_;
+  size_t             collected_;
+};
+
+
 bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
                                Options _opt) const
 {
@@ -210,6 +324,9 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
   // ---------------------------------------- write chunks
 
   OMFormat::Chunk::Header chunk_header;
+  chunk_header.compressed_ = 0;
+
+  OMChunkWriter chunk(_os, _opt.check(Options::Compressed), swap);
 
 
   // -------------------- write vertex data
@@ -218,7 +335,6 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
   if (_be.n_vertices())
   {
     v = _be.point(VertexHandle(0));
-    chunk_header.reserved_ = 0;
     chunk_header.name_     = false;
     chunk_header.entity_   = OMFormat::Chunk::Entity_Vertex;
     chunk_header.type_     = OMFormat::Chunk::Type_Pos;
@@ -227,9 +343,13 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.dim_      = OMFormat::dim(v);
     chunk_header.bits_     = OMFormat::bits(v[0]);
 
-    bytes += store( _os, chunk_header, swap );
+    // float coordinates are delta coded as integers against the
+    // same coordinate of the previous vertex
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint,
+                          unsigned(OMFormat::scalar_size(chunk_header)), OMFormat::dimensions(chunk_header) );
     for (i=0, nV=header.n_vertices_; i<nV; ++i)
-      bytes += vector_store( _os, _be.point(VertexHandle(i)), swap );
+      bytes += vector_store( chunk.data(), _be.point(VertexHandle(i)), swap );
+    bytes += chunk.end();
   }
 
 
@@ -246,9 +366,11 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.dim_      = OMFormat::dim(n);
     chunk_header.bits_     = OMFormat::bits(n[0]);
 
-    bytes += store( _os, chunk_header, swap );
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint,
+                          unsigned(OMFormat::scalar_size(chunk_header)), OMFormat::dimensions(chunk_header) );
     for (i=0, nV=header.n_vertices_; i<nV; ++i)
-      bytes += vector_store( _os, _be.normal(VertexHandle(i)), swap );
+      bytes += vector_store( chunk.data(), _be.normal(VertexHandle(i)), swap );
+    bytes += chunk.end();
   }
 
   // ---------- write vertex color
@@ -264,9 +386,10 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.dim_      = OMFormat::dim( c );
     chunk_header.bits_     = OMFormat::bits( c[0] );
 
-    bytes += store( _os, chunk_header, swap );
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_LZ );
     for (i=0, nV=header.n_vertices_; i<nV; ++i)
-      bytes += vector_store( _os, _be.color(VertexHandle(i)), swap );
+      bytes += vector_store( chunk.data(), _be.color(VertexHandle(i)), swap );
+    bytes += chunk.end();
   }
 
   // ---------- write vertex texture coords
@@ -283,13 +406,52 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.bits_ = OMFormat::bits(t[0]);
 
     // std::clog << chunk_header << std::endl;
-    bytes += store(_os, chunk_header, swap);
+    bytes += chunk.begin(chunk_header, OMFormat::Chunk::Codec_DeltaVarint,
+                         unsigned(OMFormat::scalar_size(chunk_header)), OMFormat::dimensions(chunk_header));
 
     for (i = 0, nV = header.n_vertices_; i < nV; ++i)
-      bytes += vector_store(_os, _be.texcoord(VertexHandle(i)), swap);
+      bytes += vector_store(chunk.data(), _be.texcoord(VertexHandle(i)), swap);
+    bytes += chunk.end();
 
   }
 
+  // -------------------- write raw connectivity
+
+  // The vertex, halfedge and face arrays of the kernel are written before
+  // the face topology, so that a reader can restore them directly and
+  // skip the face list. The face list is still needed by importers that
+  // can not take the arrays and if the arrays are rejected as corrupt.
+  // Readers older than the chunks can not skip them and fail on the file.
+  std::vector<int> vertex_halfedges, halfedges, face_halfedges;
+  if (_opt.check(Options::Connectivity) &&
+      _be.get_connectivity(vertex_halfedges, halfedges, face_halfedges))
+  {
+    chunk_header.name_     = false;
+    chunk_header.type_     = OMFormat::Chunk::Type_Connectivity;
+    chunk_header.signed_   = 1;
+    chunk_header.float_    = 0;
+    chunk_header.bits_     = OMFormat::Chunk::Integer_32;
+
+    chunk_header.entity_   = OMFormat::Chunk::Entity_Vertex;
+    chunk_header.dim_      = OMFormat::Chunk::Dim_1D;
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint, 4, 1 );
+    bytes += store_binary_connectivity( chunk.data(), vertex_halfedges, swap );
+    bytes += chunk.end();
+
+    // to vertex, next halfedge and face of each halfedge
+    chunk_header.entity_   = OMFormat::Chunk::Entity_Halfedge;
+    chunk_header.dim_      = OMFormat::Chunk::Dim_3D;
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint, 4, 3 );
+    bytes += store_binary_connectivity( chunk.data(), halfedges, swap );
+    bytes += chunk.end();
+
+    chunk_header.entity_   = OMFormat::Chunk::Entity_Face;
+    chunk_header.dim_      = OMFormat::Chunk::Dim_1D;
+    bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint, 4, 1 );
+    bytes += store_binary_connectivity( chunk.data(), face_halfedges, swap );
+    bytes += chunk.end();
+  }
+
   // -------------------- write face data
 
   // ---------- write topology
@@ -302,22 +464,28 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
     chunk_header.dim_      = OMFormat::Chunk::Dim_1D; // ignored
     chunk_header.bits_     = OMFormat::needed_bits(_be.n_vertices());
 
-    bytes += store( _os, chunk_header, swap );
+    // Vertex indices of a face are close to each other. Polygonal
+    // meshes mix in the 16 bit valences, so they are compressed as bytes.
+    if ( header.mesh_ == 'P' )
+      bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_LZ );
+    else
+      bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint, 1u << chunk_header.bits_, 1 );
 
     for (i=0, nF=header.n_faces_; i<nF; ++i)
     {
       nV = _be.get_vhandles(FaceHandle(i), vhandles);
       if ( header.mesh_ == 'P' )
-        bytes += store( _os, vhandles.size(), OMFormat::Chunk::Integer_16, swap );
+        bytes += store( chunk.data(), vhandles.size(), OMFormat::Chunk::Integer_16, swap );
 
       for (size_t j=0; j < vhandles.size(); ++j)
       {
         using namespace OMFormat;
         using namespace GenProg;
 
-        bytes += store( _os, vhandles[j].idx(), Chunk::Integer_Size(chunk_header.bits_), swap );
+        bytes += store( chunk.data(), vhandles[j].idx(), Chunk::Integer_Size(chunk_header.bits_), swap );
       }
     }
+    bytes += chunk.end();
   }
 
   // ---------- write face normals
@@ -341,12 +509,15 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
       chunk_header.dim_      = OMFormat::dim(n);
       chunk_header.bits_     = OMFormat::bits(n[0]);
 
-      bytes += store( _os, chunk_header, swap );
+      bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_DeltaVarint,
+                            unsigned(OMFormat::scalar_size(chunk_header)), OMFormat::dimensions(chunk_header) );
 #if !NEW_STYLE
       for (i=0, nF=header.n_faces_; i<nF; ++i)
-        bytes += vector_store( _os, _be.normal(FaceHandle(i)), swap );
+        bytes += vector_store( chunk.data(), _be.normal(FaceHandle(i)), swap );
+      bytes += chunk.end();
 #else
-      bytes += bp->store(_os, swap );
+      bytes += bp->store(chunk.data(), swap );
+      bytes += chunk.end();
     }
     else
       return false;
@@ -376,12 +547,14 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
       chunk_header.dim_      = OMFormat::dim( c );
       chunk_header.bits_     = OMFormat::bits( c[0] );
 
-      bytes += store( _os, chunk_header, swap );
+      bytes += chunk.begin( chunk_header, OMFormat::Chunk::Codec_LZ );
 #if !NEW_STYLE
       for (i=0, nF=header.n_faces_; i<nF; ++i)
-        bytes += vector_store( _os, _be.color(FaceHandle(i)), swap );
+        bytes += vector_store( chunk.data(), _be.color(FaceHandle(i)), swap );
+      bytes += chunk.end();
 #else
-      bytes += bp->store(_os, swap);
+      bytes += bp->store(chunk.data(), swap);
+      bytes += chunk.end();
     }
     else
       return false;
@@ -398,53 +571,71 @@ bool _OMWriter_::write_binary(std::ostream& _os, BaseExporter& _be,
   {
     if ( !*prop ) continue;
     if ( (*prop)->name()[1]==':') continue;
-    bytes += store_binary_custom_chunk(_os, **prop,
-				       OMFormat::Chunk::Entity_Vertex, swap );
+    bytes += store_binary_custom_chunk(chunk, **prop,
+				       OMFormat::Chunk::Entity_Vertex );
   }
   for (prop  = _be.kernel()->fprops_begin();
        prop != _be.kernel()->fprops_end(); ++prop)
   {
     if ( !*prop ) continue;
     if ( (*prop)->name()[1]==':') continue;
-    bytes += store_binary_custom_chunk(_os, **prop,
-				       OMFormat::Chunk::Entity_Face, swap );
+    bytes += store_binary_custom_chunk(chunk, **prop,
+				       OMFormat::Chunk::Entity_Face );
   }
   for (prop  = _be.kernel()->eprops_begin();
        prop != _be.kernel()->eprops_end(); ++prop)
   {
     if ( !*prop ) continue;
     if ( (*prop)->name()[1]==':') continue;
-    bytes += store_binary_custom_chunk(_os, **prop,
-				       OMFormat::Chunk::Entity_Edge, swap );
+    bytes += store_binary_custom_chunk(chunk, **prop,
+				       OMFormat::Chunk::Entity_Edge );
   }
   for (prop  = _be.kernel()->hprops_begin();
        prop != _be.kernel()->hprops_end(); ++prop)
   {
     if ( !*prop ) continue;
     if ( (*prop)->name()[1]==':') continue;
-    bytes += store_binary_custom_chunk(_os, **prop,
-				       OMFormat::Chunk::Entity_Halfedge, swap );
+    bytes += store_binary_custom_chunk(chunk, **prop,
+				       OMFormat::Chunk::Entity_Halfedge );
   }
   for (prop  = _be.kernel()->mprops_begin();
        prop != _be.kernel()->mprops_end(); ++prop)
   {
     if ( !*prop ) continue;
     if ( (*prop)->name()[1]==':') continue;
-    bytes += store_binary_custom_chunk(_os, **prop,
-				       OMFormat::Chunk::Entity_Mesh, swap );
+    bytes += store_binary_custom_chunk(chunk, **prop,
+				       OMFormat::Chunk::Entity_Mesh );
   }
 
-  std::clog << "#bytes written: " << bytes << std::endl;
+  std::clog << "#bytes written: " << bytes - chunk.collected_bytes() << std::endl;
 
   return true;
 }
 
 // ----------------------------------------------------------------------------
 
-size_t _OMWriter_::store_binary_custom_chunk(std::ostream& _os,
+size_t _OMWriter_::store_binary_connectivity(std::ostream& _os,
+                                             const std::vector<int>& _data,
+                                             bool _swap) const
+{
+  if (_data.empty())
+    return 0;
+
+  // The file is little endian, so the array can be written as a whole
+  if (sizeof(int) == sizeof(OMFormat::int32) && !_swap)
+    _os.write(reinterpret_cast<const char*>(&_data[0]), std::streamsize(_data.size() * sizeof(OMFormat::int32)));
+  else
+    for (size_t i = 0; i < _data.size(); ++i)
+      store(_os, OMFormat::int32(_data[i]), _swap);
+
+  return _data.size() * sizeof(OMFormat::int32);
+}
+
+// ----------------------------------------------------------------------------
+
+size_t _OMWriter_::store_binary_custom_chunk(OMChunkWriter& _chunk,
 					     const BaseProperty& _bp,
-					     OMFormat::Chunk::Entity _entity,
-					     bool _swap) const
+					     OMFormat::Chunk::Entity _entity) const
 {
   //omlog() << "Custom Property " << OMFormat::as_string(_entity) << " property ["
   //	<< _bp.name() << "]" << std::endl;
@@ -475,23 +666,22 @@ size_t _OMWriter_::store_binary_custom_chunk(std::ostream& _os,
 
   // write custom chunk
 
-  // 1. chunk header
-  bytes += store( _os, chdr, _swap );
-
-  // 2. property name
-  bytes += store( _os, OMFormat::Chunk::PropertyName(_bp.name()), _swap );
+  // 1. chunk header and 2. property name
+  const OMFormat::Chunk::PropertyName name(_bp.name());
+  bytes += _chunk.begin( chdr, OMFormat::Chunk::Codec_LZ, 1, 1, &name );
 
   // 3. block size
-  bytes += store( _os, _bp.size_of(), OMFormat::Chunk::Integer_32, _swap );
+  bytes += store( _chunk.data(), _bp.size_of(), OMFormat::Chunk::Integer_32, _chunk.swap() );
   //omlog() << "  n_bytes = " << _bp.size_of() << std::endl;
 
   // 4. data
   {
     size_t b;
-    bytes += ( b=_bp.store( _os, _swap ) );
+    bytes += ( b=_bp.store( _chunk.data(), _chunk.swap() ) );
     //omlog() << "  b       = " << b << std::endl;
     assert( b == _bp.size_of() );
   }
+  bytes += _chunk.end();
   return bytes;
 }
 
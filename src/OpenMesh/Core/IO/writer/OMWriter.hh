@@ -64,6 +64,7 @@
 // STD C++
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 // OpenMesh
 #include <OpenMesh/Core/IO/BinaryHelper.hh>
@@ -84,6 +85,7 @@ namespace IO {
 
 
 class BaseExporter;
+class OMChunkWriter;
 
 
 //=== IMPLEMENTATION ==========================================================
@@ -126,8 +128,11 @@ protected:
   bool write_binary(std::ostream&, BaseExporter&, Options) const;
 
 
-  size_t store_binary_custom_chunk( std::ostream&, const BaseProperty&,
-				    OMFormat::Chunk::Entity, bool) const;
+  size_t store_binary_custom_chunk( OMChunkWriter&, const BaseProperty&,
+				    OMFormat::Chunk::Entity) const;
+
+  /// Write the int32 array of a Type_Connectivity chunk
+  size_t store_binary_connectivity( std::ostream&, const std::vector<int>&, bool) const;
 };
 
 
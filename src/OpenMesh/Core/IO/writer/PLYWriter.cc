@@ -60,7 +60,10 @@
 
 #include <OpenMesh/Core/IO/SR_store.hh>
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
+#include <sstream>
 
 //=== NAMESPACES ==============================================================
 
@@ -117,8 +120,6 @@ write(const std::string& _filename, BaseExporter& _be, Options _opt, std::stream
     omerr() << "[PLYWriter] : Warning: Face normals are not supported and thus not exported! " << std::endl;
   }
 
-  options_ = _opt;
-
   // open file
   std::ofstream out;
   openWrite(_filename, _opt, out);
@@ -160,8 +161,6 @@ write(std::ostream& _os, BaseExporter& _be, Options _opt, std::streamsize _preci
   if ( _opt.check(Options::FaceNormal) || _opt.check(Options::FaceColor) ) // not supported yet
     return false;
 
-  options_ = _opt;
-
 
   if (!_os.good())
   {
@@ -264,7 +263,7 @@ std::vector<_PLYWriter_::CustomProperty> _PLYWriter_::writeCustomTypeHeader(std:
 //-----------------------------------------------------------------------------
 
 
-void _PLYWriter_::write_customProp_ascii(std::ostream& _out, const CustomProperty& _prop, size_t _index) const
+void _PLYWriter_::write_customProp_ascii(AsciiBuffer& _out, const CustomProperty& _prop, size_t _index) const
 {
   if (_prop.type == ValueTypeCHAR)
     _out << " " << castProperty<signed char>(_prop.property)->data()[_index];
@@ -295,7 +294,7 @@ void _PLYWriter_::write_header(std::ostream& _out, BaseExporter& _be, Options& _
 
   if (_opt.is_binary()) {
     _out << "format ";
-    if ( options_.check(Options::MSB) )
+    if ( _opt.check(Options::MSB) )
       _out << "binary_big_endian ";
     else
       _out << "binary_little_endian ";
@@ -378,123 +377,150 @@ void _PLYWriter_::write_header(std::ostream& _out, BaseExporter& _be, Options& _
 }
 
 
-//-----------------------------------------------------------------------------
-
-
-bool
-_PLYWriter_::
-write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
+/// Formats the lines of a block of vertices of an ASCII PLY file
+class _PLYWriter_::AsciiVertexFormat
 {
-  
-  unsigned int i, nV, nF;
-  Vec3f v, n;
-  OpenMesh::Vec3ui c;
-  OpenMesh::Vec4ui cA;
-  OpenMesh::Vec3f cf;
-  OpenMesh::Vec4f cAf;
-  OpenMesh::Vec2f t;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
-  std::vector<Vec2f> texcoords;
-
-  std::vector<CustomProperty> vProps;
-  std::vector<CustomProperty> fProps;
+public:
 
-  write_header(_out, _be, _opt, vProps, fProps);
+  AsciiVertexFormat(const _PLYWriter_& _writer, const BaseExporter& _be, const Options& _opt,
+                    const std::vector<CustomProperty>& _props)
+  : writer_(_writer), be_(_be), opt_(_opt), props_(_props)
+  {}
 
-  if (_opt.color_is_float())
-    _out << std::fixed;
-
-  // vertex data (point, normals, colors, texcoords)
-  for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
   {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      const VertexHandle vh = VertexHandle(int(i));
+      const Vec3f v = be_.point(vh);
 
-    //Vertex
-    _out << v[0] << " " << v[1] << " " << v[2];
+      //Vertex
+      _buf << v[0] << ' ' << v[1] << ' ' << v[2];
 
-    // Vertex Normals
-    if ( _opt.vertex_has_normal() ){
-      n = _be.normal(vh);
-      _out << " " << n[0] << " " << n[1] << " " << n[2];
-    }
+      // Vertex Normals
+      if ( opt_.vertex_has_normal() ){
+        const Vec3f n = be_.normal(vh);
+        _buf << ' ' << n[0] << ' ' << n[1] << ' ' << n[2];
+      }
 
-    // Vertex TexCoords
-    if ( _opt.vertex_has_texcoord() ) {
-    	t = _be.texcoord(vh);
-    	_out << " " << t[0] << " " << t[1];
-    }
+      // Vertex TexCoords
+      if ( opt_.vertex_has_texcoord() ) {
+        const Vec2f t = be_.texcoord(vh);
+        _buf << ' ' << t[0] << ' ' << t[1];
+      }
 
-    // VertexColor
-    if ( _opt.vertex_has_color() ) {
-      //with alpha
-      if ( _opt.color_has_alpha() ){
-        if (_opt.color_is_float()) {
-          cAf = _be.colorAf(vh);
-          _out << " " << cAf;
-        } else {
-          cA  = _be.colorAi(vh);
-          _out << " " << cA;
-        }
-      }else{
-        //without alpha
-        if (_opt.color_is_float()) {
-          cf = _be.colorf(vh);
-          _out << " " << cf;
-        } else {
-          c  = _be.colori(vh);
-          _out << " " << c;
+      // VertexColor
+      if ( opt_.vertex_has_color() ) {
+        //with alpha
+        if ( opt_.color_has_alpha() ){
+          if (opt_.color_is_float())
+            _buf << ' ' << be_.colorAf(vh);
+          else
+            _buf << ' ' << be_.colorAi(vh);
+        }else{
+          //without alpha
+          if (opt_.color_is_float())
+            _buf << ' ' << be_.colorf(vh);
+          else
+            _buf << ' ' << be_.colori(vh);
         }
       }
+
+      // write custom properties for vertices
+      for (size_t j = 0; j < props_.size(); ++j)
+        writer_.write_customProp_ascii(_buf, props_[j], i);
+
+      _buf << '\n';
     }
+  }
 
+private:
 
-    // write custom properties for vertices
-    for (std::vector<CustomProperty>::iterator iter = vProps.begin(); iter < vProps.end(); ++iter)
-      write_customProp_ascii(_out,*iter,i);
+  const _PLYWriter_&                 writer_;
+  const BaseExporter&                be_;
+  const Options                      opt_;
+  const std::vector<CustomProperty>& props_;
+};
 
-    _out << "\n";
-  }
 
-  // faces (indices starting at 0)
-  for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
+/// Formats the lines of a block of faces of an ASCII PLY file
+class _PLYWriter_::AsciiFaceFormat
+{
+public:
+
+  AsciiFaceFormat(const _PLYWriter_& _writer, const BaseExporter& _be, const Options& _opt,
+                  const std::vector<CustomProperty>& _props)
+  : writer_(_writer), be_(_be), opt_(_opt), props_(_props)
+  {}
+
+  void operator()(AsciiBuffer& _buf, size_t _begin, size_t _end) const
   {
-    // write vertex indices per face
-    nV = _be.get_vhandles(FaceHandle(i), vhandles);
-    _out << nV;
-    for (size_t j=0; j<vhandles.size(); ++j)
-      _out << " " << vhandles[j].idx();
+    std::vector<VertexHandle> vhandles;
+    std::vector<Vec2f> texcoords;
 
-    // Face TexCoords
-    if ( _opt.face_has_texcoord() ) {
-      _be.texcoords(FaceHandle(i), texcoords);
-      for (size_t j=0; j<3; ++j)
-      {
-        _out << " " << texcoords[j][0] << " " << texcoords[j][1];
+    for (size_t i = _begin; i < _end; ++i)
+    {
+      const FaceHandle fh = FaceHandle(int(i));
+
+      // write vertex indices per face
+      const unsigned int nV = be_.get_vhandles(fh, vhandles);
+      _buf << nV;
+      for (size_t j=0; j<vhandles.size(); ++j)
+        _buf << ' ' << vhandles[j].idx();
+
+      // Face TexCoords
+      if ( opt_.face_has_texcoord() ) {
+        be_.texcoords(fh, texcoords);
+        for (size_t j=0; j<3; ++j)
+          _buf << ' ' << texcoords[j][0] << ' ' << texcoords[j][1];
       }
-    }
 
-    //face color
-    if ( _opt.face_has_color() ){
-      //with alpha
-      if ( _opt.color_has_alpha() ){
-        cA  = _be.colorA( FaceHandle(i) );
-        _out << " " << cA[0] << " " << cA[1] << " " << cA[2] << " " << cA[3];
-      }else{
-        //without alpha
-        c  = _be.color( FaceHandle(i) );
-        _out << " " << c[0] << " " << c[1] << " " << c[2];
+      //face color
+      if ( opt_.face_has_color() ){
+        //with alpha
+        if ( opt_.color_has_alpha() )
+          _buf << ' ' << Vec4ui(be_.colorA(fh));
+        else
+          _buf << ' ' << Vec3ui(be_.color(fh));
       }
-    }
 
-    // write custom props
-    for (std::vector<CustomProperty>::iterator iter = fProps.begin(); iter < fProps.end(); ++iter)
-      write_customProp_ascii(_out,*iter,i);
+      // write custom props
+      for (size_t j = 0; j < props_.size(); ++j)
+        writer_.write_customProp_ascii(_buf, props_[j], i);
 
-    _out << "\n";
+      _buf << '\n';
+    }
   }
 
+private:
+
+  const _PLYWriter_&                 writer_;
+  const BaseExporter&                be_;
+  const Options                      opt_;
+  const std::vector<CustomProperty>& props_;
+};
+
+
+//-----------------------------------------------------------------------------
+
+
+bool
+_PLYWriter_::
+write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
+{
+  std::vector<CustomProperty> vProps;
+  std::vector<CustomProperty> fProps;
+
+  write_header(_out, _be, _opt, vProps, fProps);
+
+  if (_opt.color_is_float())
+    _out << std::fixed;
+
+  // vertex data (point, normals, colors, texcoords)
+  write_ascii_blocks(_out, _be.n_vertices(), AsciiVertexFormat(*this, _be, _opt, vProps));
+
+  // faces (indices starting at 0)
+  write_ascii_blocks(_out, _be.n_faces(), AsciiFaceFormat(*this, _be, _opt, fProps));
 
   return true;
 }
@@ -502,7 +528,7 @@ write_ascii(std::ostream& _out, BaseExporter& _be, Options _opt) const
 
 //-----------------------------------------------------------------------------
 
-void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, int value) const {
+void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, int value, const Options& _opt) const {
 
   uint32_t tmp32;
   uint8_t tmp8;
@@ -511,12 +537,12 @@ void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, int value) con
     case ValueTypeINT:
     case ValueTypeINT32:
       tmp32 = value;
-      store(_out, tmp32, options_.check(Options::MSB) );
+      store(_out, tmp32, _opt.check(Options::MSB) );
       break;
 //     case ValueTypeUINT8:
 default :
       tmp8 = value;
-      store(_out, tmp8, options_.check(Options::MSB) );
+      store(_out, tmp8, _opt.check(Options::MSB) );
       break;
 //     default :
 //       std::cerr << "unsupported conversion type to int: " << _type << std::endl;
@@ -524,7 +550,7 @@ default :
   }
 }
 
-void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, unsigned int value) const {
+void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, unsigned int value, const Options& _opt) const {
 
   uint32_t tmp32;
   uint8_t tmp8;
@@ -533,12 +559,12 @@ void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, unsigned int v
     case ValueTypeINT:
     case ValueTypeINT32:
       tmp32 = value;
-      store(_out, tmp32, options_.check(Options::MSB) );
+      store(_out, tmp32, _opt.check(Options::MSB) );
       break;
 //     case ValueTypeUINT8:
 default :
       tmp8 = value;
-      store(_out, tmp8, options_.check(Options::MSB) );
+      store(_out, tmp8, _opt.check(Options::MSB) );
       break;
 //     default :
 //       std::cerr << "unsupported conversion type to int: " << _type << std::endl;
@@ -546,7 +572,7 @@ default :
   }
 }
 
-void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, float value) const {
+void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, float value, const Options& _opt) const {
 
   float32_t tmp;
 
@@ -554,7 +580,7 @@ void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, float value) c
     case ValueTypeFLOAT32:
     case ValueTypeFLOAT:
       tmp = value;
-      store( _out , tmp, options_.check(Options::MSB) );
+      store( _out , tmp, _opt.check(Options::MSB) );
       break;
     default :
       std::cerr << "unsupported conversion type to float: " << _type << std::endl;
@@ -562,227 +588,290 @@ void _PLYWriter_::writeValue(ValueType _type, std::ostream& _out, float value) c
   }
 }
 
-bool
-_PLYWriter_::
-write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
+namespace {
+
+/// Size of a color in binary files
+size_t binary_color_size(const Options& _opt)
 {
-  
-  unsigned int i, j, nV, nF;
-  Vec3f v, n;
-  Vec2f t;
-  OpenMesh::Vec4uc c;
-  OpenMesh::Vec4f cf;
-  VertexHandle vh;
-  std::vector<VertexHandle> vhandles;
-  std::vector<Vec2f> texcoords;
+  const size_t n = _opt.color_has_alpha() ? 4 : 3;
+  return n * (_opt.color_is_float() ? sizeof(float32_t) : sizeof(uint8_t));
+}
 
-  // vProps and fProps will be empty, until custom properties are supported by the binary writer
-  std::vector<CustomProperty> vProps;
-  std::vector<CustomProperty> fProps;
+/// Size of a vertex record in binary files
+size_t binary_vertex_size(const Options& _opt)
+{
+  size_t size = 3*sizeof(float32_t);
+  if ( _opt.vertex_has_normal() )
+    size += 3*sizeof(float32_t);
+  if ( _opt.vertex_has_texcoord() )
+    size += 2*sizeof(float32_t);
+  if ( _opt.vertex_has_color() )
+    size += binary_color_size(_opt);
+  return size;
+}
 
-  write_header(_out, _be, _opt, vProps, fProps);
+/// Size of the record of a face with _valence vertices in binary files
+size_t binary_face_size(const Options& _opt, size_t _valence)
+{
+  size_t size = sizeof(uint8_t) + _valence*sizeof(uint32_t);
+  if ( _opt.face_has_texcoord() )
+    size += sizeof(uint8_t) + 2*_valence*sizeof(float32_t);
+  if ( _opt.face_has_color() )
+    size += binary_color_size(_opt);
+  return size;
+}
 
-  // vertex data (point, normals, texcoords)
-  for (i=0, nV=int(_be.n_vertices()); i<nV; ++i)
-  {
-    vh = VertexHandle(i);
-    v  = _be.point(vh);
-
-    //vertex
-    writeValue(ValueTypeFLOAT, _out, v[0]);
-    writeValue(ValueTypeFLOAT, _out, v[1]);
-    writeValue(ValueTypeFLOAT, _out, v[2]);
-
-    // Vertex Normal
-    if ( _opt.vertex_has_normal() ){
-      n = _be.normal(vh);
-      writeValue(ValueTypeFLOAT, _out, n[0]);
-      writeValue(ValueTypeFLOAT, _out, n[1]);
-      writeValue(ValueTypeFLOAT, _out, n[2]);
-    }
+/// Copy _val to _dst in the byte order of the file and advance _dst
+template <typename T>
+inline void put_binary(char*& _dst, T _val, bool _swap)
+{
+  if (_swap)
+    reverse_byte_order(_val);
+  memcpy(_dst, &_val, sizeof(T));
+  _dst += sizeof(T);
+}
 
-    // Vertex TexCoords
-    if ( _opt.vertex_has_texcoord() ) {
-    	t = _be.texcoord(vh);
-    	writeValue(ValueTypeFLOAT, _out, t[0]);
-    	writeValue(ValueTypeFLOAT, _out, t[1]);
-    }
+void put_binary_color(char*& _dst, const Vec4uc& _c, const Vec4f& _cf,
+                      const Options& _opt, bool _swap)
+{
+  const int n = _opt.color_has_alpha() ? 4 : 3;
+  for (int k = 0; k < n; ++k)
+    if ( _opt.color_is_float() )
+      put_binary(_dst, float32_t(_cf[k]), _swap);
+    else
+      put_binary(_dst, uint8_t(_c[k]), _swap);
+}
 
-    // vertex color
-    if ( _opt.vertex_has_color() ) {
-        if ( _opt.color_is_float() ) {
-          cf  = _be.colorAf(vh);
-          writeValue(ValueTypeFLOAT, _out, cf[0]);
-          writeValue(ValueTypeFLOAT, _out, cf[1]);
-          writeValue(ValueTypeFLOAT, _out, cf[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeFLOAT, _out, cf[3]);
-        } else {
-          c  = _be.colorA(vh);
-          writeValue(ValueTypeUCHAR, _out, (int)c[0]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[1]);
-          writeValue(ValueTypeUCHAR, _out, (int)c[2]);
-
-          if ( _opt.color_has_alpha() )
-            writeValue(ValueTypeUCHAR, _out, (int)c[3]);
-        }
+/// Number of elements per block of the binary writer
+const size_t binary_block_size = 4096;
+
+/// Fill the records of the vertices [_begin,_end) starting at _dst
+void put_binary_vertices(const BaseExporter& _be, const Options& _opt,
+                         size_t _begin, size_t _end, char* _dst)
+{
+  const size_t n    = _end - _begin;
+  const bool   swap = _opt.check(Options::MSB);
+
+  std::vector<Vec3f>  points(n), normals;
+  std::vector<Vec2f>  texcoords;
+  std::vector<Vec4uc> colors;
+  std::vector<Vec4f>  colorsf;
+
+  _be.points(_begin, n, &points[0]);
+
+  if ( _opt.vertex_has_normal() ) {
+    normals.resize(n);
+    _be.vertex_normals(_begin, n, &normals[0]);
+  }
+
+  if ( _opt.vertex_has_texcoord() ) {
+    texcoords.resize(n);
+    _be.vertex_texcoords(_begin, n, &texcoords[0]);
+  }
+
+  if ( _opt.vertex_has_color() ) {
+    if ( _opt.color_is_float() ) {
+      colorsf.resize(n);
+      _be.vertex_colorsAf(_begin, n, &colorsf[0]);
+    } else {
+      colors.resize(n);
+      _be.vertex_colorsA(_begin, n, &colors[0]);
     }
   }
 
-  // faces (indices starting at 0)
-  if (_be.is_triangle_mesh())
+  for (size_t i = 0; i < n; ++i)
   {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      //face
-      _be.get_vhandles(FaceHandle(i), vhandles);
-      writeValue(ValueTypeUINT8, _out, 3);
-      writeValue(ValueTypeINT32, _out, vhandles[0].idx());
-      writeValue(ValueTypeINT32, _out, vhandles[1].idx());
-      writeValue(ValueTypeINT32, _out, vhandles[2].idx());
+    for (int k = 0; k < 3; ++k)
+      put_binary(_dst, float32_t(points[i][k]), swap);
 
-      // Face TexCoords
-      if ( _opt.face_has_texcoord() ) {
-          _be.texcoords(FaceHandle(i), texcoords);
-          writeValue(ValueTypeUINT8, _out, 6);
-          for (j=0; j<3; ++j)
-          {
-            writeValue(ValueTypeFLOAT, _out, texcoords[j][0]);
-            writeValue(ValueTypeFLOAT, _out, texcoords[j][1]);
-          }
-      }
+    if ( _opt.vertex_has_normal() )
+      for (int k = 0; k < 3; ++k)
+        put_binary(_dst, float32_t(normals[i][k]), swap);
 
-      //face color
-      if ( _opt.face_has_color() ){
-          if ( _opt.color_is_float() ) {
-            cf  = _be.colorAf(FaceHandle(i));
-            writeValue(ValueTypeFLOAT, _out, cf[0]);
-            writeValue(ValueTypeFLOAT, _out, cf[1]);
-            writeValue(ValueTypeFLOAT, _out, cf[2]);
-
-            if ( _opt.color_has_alpha() )
-              writeValue(ValueTypeFLOAT, _out, cf[3]);
-          } else {
-            c  = _be.colorA(FaceHandle(i));
-            writeValue(ValueTypeUCHAR, _out, (int)c[0]);
-            writeValue(ValueTypeUCHAR, _out, (int)c[1]);
-            writeValue(ValueTypeUCHAR, _out, (int)c[2]);
-
-            if ( _opt.color_has_alpha() )
-              writeValue(ValueTypeUCHAR, _out, (int)c[3]);
-          }
-      }
+    if ( _opt.vertex_has_texcoord() )
+      for (int k = 0; k < 2; ++k)
+        put_binary(_dst, float32_t(texcoords[i][k]), swap);
+
+    if ( _opt.vertex_has_color() )
+      put_binary_color(_dst, colors.empty() ? Vec4uc() : colors[i],
+                       colorsf.empty() ? Vec4f() : colorsf[i], _opt, swap);
+  }
+}
+
+/// Fill the records of the faces [_begin,_end) with the given valences starting at _dst
+void put_binary_faces(const BaseExporter& _be, const Options& _opt,
+                      size_t _begin, size_t _end, const unsigned int* _valences,
+                      char* _dst)
+{
+  const size_t n    = _end - _begin;
+  const bool   swap = _opt.check(Options::MSB);
+
+  size_t n_indices = 0;
+  for (size_t i = 0; i < n; ++i)
+    n_indices += _valences[i];
+
+  std::vector<int>    indices(n_indices + 1);
+  std::vector<Vec2f>  texcoords;
+  std::vector<Vec4uc> colors;
+  std::vector<Vec4f>  colorsf;
+
+  _be.face_vertex_indices(_begin, n, &indices[0]);
+
+  if ( _opt.face_has_color() ) {
+    if ( _opt.color_is_float() ) {
+      colorsf.resize(n);
+      _be.face_colorsAf(_begin, n, &colorsf[0]);
+    } else {
+      colors.resize(n);
+      _be.face_colorsA(_begin, n, &colors[0]);
     }
   }
-  else
+
+  const int* index = &indices[0];
+
+  for (size_t i = 0; i < n; ++i)
   {
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      //face
-      nV = _be.get_vhandles(FaceHandle(i), vhandles);
-      writeValue(ValueTypeUINT8, _out, nV);
-      for (size_t j=0; j<vhandles.size(); ++j)
-        writeValue(ValueTypeINT32, _out, vhandles[j].idx() );
-
-       //face color
-       if ( _opt.face_has_color() ){
-           if ( _opt.color_is_float() ) {
-             cf  = _be.colorAf(FaceHandle(i));
-             writeValue(ValueTypeFLOAT, _out, cf[0]);
-             writeValue(ValueTypeFLOAT, _out, cf[1]);
-             writeValue(ValueTypeFLOAT, _out, cf[2]);
-
-             if ( _opt.color_has_alpha() )
-               writeValue(ValueTypeFLOAT, _out, cf[3]);
-           } else {
-             c  = _be.colorA(FaceHandle(i));
-             writeValue(ValueTypeUCHAR, _out, (int)c[0]);
-             writeValue(ValueTypeUCHAR, _out, (int)c[1]);
-             writeValue(ValueTypeUCHAR, _out, (int)c[2]);
-
-             if ( _opt.color_has_alpha() )
-               writeValue(ValueTypeUCHAR, _out, (int)c[3]);
-           }
-       }
+    put_binary(_dst, uint8_t(_valences[i]), swap);
+    for (unsigned int j = 0; j < _valences[i]; ++j)
+      put_binary(_dst, uint32_t(*index++), swap);
+
+    if ( _opt.face_has_texcoord() ) {
+      _be.texcoords(FaceHandle(int(_begin + i)), texcoords);
+      texcoords.resize(_valences[i]);
+      put_binary(_dst, uint8_t(2*_valences[i]), swap);
+      for (unsigned int j = 0; j < _valences[i]; ++j) {
+        put_binary(_dst, float32_t(texcoords[j][0]), swap);
+        put_binary(_dst, float32_t(texcoords[j][1]), swap);
+      }
     }
-  }
 
-  return true;
+    if ( _opt.face_has_color() )
+      put_binary_color(_dst, colors.empty() ? Vec4uc() : colors[i],
+                       colorsf.empty() ? Vec4f() : colorsf[i], _opt, swap);
+  }
 }
 
-// ----------------------------------------------------------------------------
+} // namespace
 
 
-size_t
+//-----------------------------------------------------------------------------
+
+
+void
 _PLYWriter_::
-binary_size(BaseExporter& _be, Options _opt) const
+binary_layout(BaseExporter& _be, const Options& _opt,
+              std::vector<unsigned int>& _valences,
+              std::vector<size_t>& _face_offsets) const
 {
-  // TODO: header size calculation is unadapted copy-pasta from OFFWriter, the
-  // result is not correct
-  size_t header(0);
-  size_t data(0);
-  size_t _3floats(3*sizeof(float));
-  size_t _3ui(3*sizeof(unsigned int));
-  size_t _4ui(4*sizeof(unsigned int));
+  const size_t n_faces  = _be.n_faces();
+  const size_t n_blocks = (n_faces + binary_block_size - 1) / binary_block_size;
 
-  if ( !_opt.is_binary() )
-    return 0;
-  else
+  _valences.resize(n_faces);
+  if (_be.is_triangle_mesh())
+    std::fill(_valences.begin(), _valences.end(), 3u);
+  else if (n_faces > 0)
+    _be.face_valences(0, n_faces, &_valences[0]);
+
+  _face_offsets.resize(n_blocks + 1);
+  _face_offsets[0] = 0;
+
+  for (size_t b = 0; b < n_blocks; ++b)
   {
+    const size_t begin = b * binary_block_size;
+    const size_t end   = std::min(begin + binary_block_size, n_faces);
 
-    size_t _3longs(3*sizeof(long));
+    size_t size = 0;
+    for (size_t i = begin; i < end; ++i)
+      size += binary_face_size(_opt, _valences[i]);
 
-    header += 11;                             // 'OFF BINARY\n'
-    header += _3longs;                        // #V #F #E
-    data   += _be.n_vertices() * _3floats;    // vertex data
+    _face_offsets[b+1] = _face_offsets[b] + size;
   }
+}
 
-  if ( _opt.vertex_has_normal() && _be.has_vertex_normals() )
-  {
-    header += 1; // N
-    data   += _be.n_vertices() * _3floats;
-  }
 
-  if ( _opt.vertex_has_color() && _be.has_vertex_colors() )
-  {
-    header += 1; // C
-    data   += _be.n_vertices() * _3floats;
-  }
+//-----------------------------------------------------------------------------
+
+
+bool
+_PLYWriter_::
+write_binary(std::ostream& _out, BaseExporter& _be, Options _opt) const
+{
+  // vProps and fProps will be empty, until custom properties are supported by the binary writer
+  std::vector<CustomProperty> vProps;
+  std::vector<CustomProperty> fProps;
+
+  std::ostringstream header;
+  write_header(header, _be, _opt, vProps, fProps);
+  const std::string header_str = header.str();
+
+  // exact size of the vertex and face records
+  std::vector<unsigned int> valences;
+  std::vector<size_t>       face_offsets;
+  binary_layout(_be, _opt, valences, face_offsets);
+
+  const size_t n_vertices  = _be.n_vertices();
+  const size_t n_faces     = _be.n_faces();
+  const size_t vertex_size = binary_vertex_size(_opt);
 
-  if ( _opt.vertex_has_texcoord() && _be.has_vertex_texcoords() )
+  std::vector<char> buffer(header_str.size() + n_vertices*vertex_size + face_offsets.back());
+  memcpy(&buffer[0], header_str.data(), header_str.size());
+
+  char* vertex_data = &buffer[0] + header_str.size();
+  char* face_data   = vertex_data + n_vertices*vertex_size;
+
+  // fill the buffer in blocks of elements, in parallel if possible
+  const int n_vertex_blocks = int((n_vertices + binary_block_size - 1) / binary_block_size);
+  const int n_face_blocks   = int(face_offsets.size() - 1);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) if(n_vertex_blocks > 1)
+#endif
+  for (int b = 0; b < n_vertex_blocks; ++b)
   {
-    size_t _2floats(2*sizeof(float));
-    header += 2; // ST
-    data   += _be.n_vertices() * _2floats;
+    const size_t begin = size_t(b) * binary_block_size;
+    put_binary_vertices(_be, _opt, begin, std::min(begin + binary_block_size, n_vertices),
+                        vertex_data + begin*vertex_size);
   }
 
-  // topology
-  if (_be.is_triangle_mesh())
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(dynamic) if(n_face_blocks > 1)
+#endif
+  for (int b = 0; b < n_face_blocks; ++b)
   {
-    data += _be.n_faces() * _4ui;
+    const size_t begin = size_t(b) * binary_block_size;
+    put_binary_faces(_be, _opt, begin, std::min(begin + binary_block_size, n_faces),
+                     &valences[begin], face_data + face_offsets[b]);
   }
-  else
-  {
-    unsigned int i, nF;
-    std::vector<VertexHandle> vhandles;
 
-    for (i=0, nF=int(_be.n_faces()); i<nF; ++i)
-    {
-      data += _be.get_vhandles(FaceHandle(i), vhandles) * sizeof(unsigned int);
+  _out.write(&buffer[0], std::streamsize(buffer.size()));
 
-    }
-  }
+  return !_out.fail();
+}
 
-  // face colors
-  if ( _opt.face_has_color() && _be.has_face_colors() ){
-    if ( _opt.color_has_alpha() )
-      data += _be.n_faces() * _4ui;
-    else
-      data += _be.n_faces() * _3ui;
-  }
+// ----------------------------------------------------------------------------
+
+
+size_t
+_PLYWriter_::
+binary_size(BaseExporter& _be, Options _opt) const
+{
+  if ( !_opt.is_binary() )
+    return 0;
+
+  // the same options as write() uses
+  _opt.unset(Options::FaceNormal);
+
+  std::vector<CustomProperty> vProps;
+  std::vector<CustomProperty> fProps;
+
+  std::ostringstream header;
+  write_header(header, _be, _opt, vProps, fProps);
+
+  std::vector<unsigned int> valences;
+  std::vector<size_t>       face_offsets;
+  binary_layout(_be, _opt, valences, face_offsets);
 
-  return header+data;
+  return size_t(header.tellp()) + _be.n_vertices()*binary_vertex_size(_opt) + face_offsets.back();
 }
 
 
@@ -70,6 +70,7 @@
 #include <OpenMesh/Core/Utils/SingletonT.hh>
 #include <OpenMesh/Core/IO/exporter/BaseExporter.hh>
 #include <OpenMesh/Core/IO/writer/BaseWriter.hh>
+#include <OpenMesh/Core/IO/writer/AsciiBuffer.hh>
 
 
 //== NAMESPACES ===============================================================
@@ -119,7 +120,6 @@ public:
   };
 
 private:
-  mutable Options options_;
 
   struct CustomProperty
   {
@@ -132,15 +132,25 @@ private:
 
   /// write custom persistant properties into the header for the current element, returns all properties, which were written sorted
   std::vector<CustomProperty> writeCustomTypeHeader(std::ostream& _out, BaseKernel::const_prop_iterator _begin, BaseKernel::const_prop_iterator _end) const;
-  void write_customProp_ascii(std::ostream& _our, const CustomProperty& _prop, size_t _index) const;
+  void write_customProp_ascii(AsciiBuffer& _out, const CustomProperty& _prop, size_t _index) const;
+
+  // format the ASCII lines of blocks of vertices and faces, see write_ascii_blocks()
+  class AsciiVertexFormat;
+  class AsciiFaceFormat;
+  friend class AsciiVertexFormat;
+  friend class AsciiFaceFormat;
 
 protected:
-  void writeValue(ValueType _type, std::ostream& _out, int value) const;
-  void writeValue(ValueType _type, std::ostream& _out, unsigned int value) const;
-  void writeValue(ValueType _type, std::ostream& _out, float value) const;
+  void writeValue(ValueType _type, std::ostream& _out, int value, const Options& _opt) const;
+  void writeValue(ValueType _type, std::ostream& _out, unsigned int value, const Options& _opt) const;
+  void writeValue(ValueType _type, std::ostream& _out, float value, const Options& _opt) const;
 
   bool write_ascii(std::ostream& _out, BaseExporter&, Options) const;
   bool write_binary(std::ostream& _out, BaseExporter&, Options) const;
+  /// valences of all faces and offsets of the blocks of face records in binary files
+  void binary_layout(BaseExporter& _be, const Options& _opt,
+                     std::vector<unsigned int>& _valences,
+                     std::vector<size_t>& _face_offsets) const;
   /// write header into the stream _out. Returns custom properties (vertex and face) which are written into the header
   void write_header(std::ostream& _out, BaseExporter& _be, Options& _opt, std::vector<CustomProperty>& _ovProps, std::vector<CustomProperty>& _ofProps) const;
 };
@@ -100,9 +100,15 @@ struct ArrayItems
   };
 #endif
 
-  //TODO: should be selected with config.h define
+  // OM_NO_PREV_HALFEDGE (see config.h) drops the previous halfedge handle,
+  // which is then found by walking the next handles.
+#ifdef OM_NO_PREV_HALFEDGE
+  typedef Halfedge_without_prev             Halfedge;
+  typedef GenProg::Bool2Type<false>         HasPrevHalfedge;
+#else
   typedef Halfedge_with_prev                Halfedge;
   typedef GenProg::Bool2Type<true>          HasPrevHalfedge;
+#endif
 
   //-------------------------------------------------------- internal edge type
 #ifndef DOXY_IGNORE_THIS
@@ -169,12 +169,425 @@ unsigned int ArrayKernel::delete_isolated_vertices()
   return n_isolated;
 }
 
+void ArrayKernel::get_connectivity(std::vector<int>& _vertex_halfedges,
+                                   std::vector<int>& _halfedges,
+                                   std::vector<int>& _face_halfedges) const
+{
+  const int nV = int(n_vertices());
+  const int nH = int(n_halfedges());
+  const int nF = int(n_faces());
+
+  _vertex_halfedges.resize(nV);
+  for (int i=0; i<nV; ++i)
+    _vertex_halfedges[i] = halfedge_handle(VertexHandle(i)).idx();
+
+  _halfedges.resize(3*size_t(nH));
+  for (int i=0; i<nH; ++i)
+  {
+    const HalfedgeHandle hh(i);
+    _halfedges[3*i]   = to_vertex_handle(hh).idx();
+    _halfedges[3*i+1] = next_halfedge_handle(hh).idx();
+    _halfedges[3*i+2] = face_handle(hh).idx();
+  }
+
+  _face_halfedges.resize(nF);
+  for (int i=0; i<nF; ++i)
+    _face_halfedges[i] = halfedge_handle(FaceHandle(i)).idx();
+}
+
+bool ArrayKernel::set_connectivity(const std::vector<int>& _vertex_halfedges,
+                                   const std::vector<int>& _halfedges,
+                                   const std::vector<int>& _face_halfedges)
+{
+  const int nV = int(n_vertices());
+  const int nH = int(_halfedges.size() / 3);
+  const int nF = int(_face_halfedges.size());
+
+  if (n_edges() != 0 || n_faces() != 0 ||
+      _vertex_halfedges.size() != size_t(nV) ||
+      _halfedges.size() != 3*size_t(nH) || nH % 2 != 0)
+    return false;
+
+  // check the index ranges before touching the mesh
+  for (int i=0; i<nV; ++i)
+    if (_vertex_halfedges[i] < -1 || _vertex_halfedges[i] >= nH)
+      return false;
+  for (int i=0; i<nH; ++i)
+  {
+    if (_halfedges[3*i]   < 0  || _halfedges[3*i]   >= nV ||
+        _halfedges[3*i+1] < 0  || _halfedges[3*i+1] >= nH ||
+        _halfedges[3*i+2] < -1 || _halfedges[3*i+2] >= nF)
+      return false;
+  }
+  for (int i=0; i<nF; ++i)
+    if (_face_halfedges[i] < 0 || _face_halfedges[i] >= nH)
+      return false;
+
+  // check the topology, so that circulators and garbage collection work
+  // on the result. The opposite halfedge of h is h^1.
+  std::vector<int> n_prev(nH, 0);
+  std::vector<int> n_face_halfedges(nF, 0);
+  for (int i=0; i<nH; ++i)
+  {
+    const int next = _halfedges[3*i+1];
+    const int face = _halfedges[3*i+2];
+
+    // no loops, next starts where i ends and lies in the same face
+    if (_halfedges[3*i] == _halfedges[3*(i^1)] ||
+        _halfedges[3*(next^1)] != _halfedges[3*i] ||
+        _halfedges[3*next+2] != face)
+      return false;
+
+    // every halfedge is the next of exactly one halfedge
+    if (++n_prev[next] > 1)
+      return false;
+
+    if (face != -1)
+      ++n_face_halfedges[face];
+  }
+
+  // each face is one closed cycle of next halfedges
+  for (int i=0; i<nF; ++i)
+  {
+    const int start = _face_halfedges[i];
+    if (_halfedges[3*start+2] != i)
+      return false;
+
+    int n = 0, h = start;
+    do {
+      h = _halfedges[3*h+1];
+      ++n;
+    } while (h != start && n <= nH);
+
+    if (n != n_face_halfedges[i])
+      return false;
+  }
+
+  // the halfedge of a vertex points out of it, isolated vertices have none
+  std::vector<bool> connected(nV, false);
+  for (int i=0; i<nH; ++i)
+    connected[_halfedges[3*i]] = true;
+  for (int i=0; i<nV; ++i)
+  {
+    const int h = _vertex_halfedges[i];
+    if (h == -1 ? connected[i] : _halfedges[3*(h^1)] != i)
+      return false;
+  }
+
+  resize(nV, nH/2, nF);
+
+  for (int i=0; i<nV; ++i)
+    set_halfedge_handle(VertexHandle(i), HalfedgeHandle(_vertex_halfedges[i]));
+
+  for (int i=0; i<nH; ++i)
+  {
+    const HalfedgeHandle hh(i);
+    const HalfedgeHandle next(_halfedges[3*i+1]);
+    set_vertex_handle(hh, VertexHandle(_halfedges[3*i]));
+    set_face_handle(hh, FaceHandle(_halfedges[3*i+2]));
+    set_next_halfedge_handle(hh, next);
+  }
+
+  for (int i=0; i<nF; ++i)
+    set_halfedge_handle(FaceHandle(i), HalfedgeHandle(_face_halfedges[i]));
+
+  return true;
+}
+
 void ArrayKernel::garbage_collection(bool _v, bool _e, bool _f)
 {
-  std::vector<VertexHandle*> empty_vh;
-  std::vector<HalfedgeHandle*> empty_hh;
-  std::vector<FaceHandle*> empty_fh;
-  garbage_collection( empty_vh,empty_hh,empty_fh,_v, _e, _f);
+  garbage_collection(NULL, NULL, NULL, false, _v, _e, _f);
+}
+
+namespace {
+
+/** Fill _map with the new index of each of the _n elements of type Handle
+    (-1 for deleted ones) and return the number of remaining elements.
+    Without _preserve_order the last remaining elements are moved into
+    the gaps, which is what garbage_collection() has always done. */
+template <class Handle>
+int compaction_map(const ArrayKernel& _kernel, int _n, bool _preserve_order,
+                   std::vector<int>& _map)
+{
+  _map.resize(_n);
+
+  if (_preserve_order)
+  {
+    int n_kept = 0;
+    for (int i=0; i<_n; ++i)
+      _map[i] = _kernel.status(Handle(i)).deleted() ? -1 : n_kept++;
+    return n_kept;
+  }
+
+  int n_kept = 0;
+  for (int i=0; i<_n; ++i)
+  {
+    if (_kernel.status(Handle(i)).deleted())
+      _map[i] = -1;
+    else
+    {
+      _map[i] = i;
+      ++n_kept;
+    }
+  }
+
+  int i0=0, i1=_n-1;
+  while (1)
+  {
+    // find 1st deleted and last un-deleted
+    while (_map[i0] != -1 && i0 < i1)  ++i0;
+    while (_map[i1] == -1 && i0 < i1)  --i1;
+    if (i0 >= i1) break;
+
+    _map[i1] = i0;
+    ++i0; --i1;
+  }
+
+  return n_kept;
+}
+
+/// Move the items of _container to their new positions given by _map
+template <class Container>
+void compact_items(Container& _container, const std::vector<int>& _map, int _n)
+{
+  for (size_t i=0; i<_map.size(); ++i)
+    if (_map[i] != -1 && size_t(_map[i]) != i)
+      _container[_map[i]] = _container[i];
+  _container.resize(_n);
+}
+
+template <class Handle>
+void export_map(const std::vector<int>& _map, int _n, std::vector<Handle>* _handle_map)
+{
+  if (!_handle_map)
+    return;
+
+  _handle_map->resize(_n);
+  if (_map.empty())
+    for (int i=0; i<_n; ++i) (*_handle_map)[i] = Handle(i);
+  else
+    for (int i=0; i<_n; ++i) (*_handle_map)[i] = Handle(_map[i]);
+}
+
+/// Is _map empty or a permutation of 0.._n-1?
+bool is_permutation(const std::vector<int>& _map, int _n)
+{
+  if (_map.empty())
+    return true;
+  if (_map.size() != size_t(_n))
+    return false;
+
+  std::vector<bool> hit(_n, false);
+  for (int i=0; i<_n; ++i)
+  {
+    if (_map[i] < 0 || _map[i] >= _n || hit[_map[i]])
+      return false;
+    hit[_map[i]] = true;
+  }
+  return true;
+}
+
+/// Move the items of _container to their new positions given by _map
+template <class Container>
+void permute_items(Container& _container, const std::vector<int>& _map)
+{
+  Container permuted(_container.size());
+  for (size_t i=0; i<_map.size(); ++i)
+    permuted[_map[i]] = _container[i];
+  _container.swap(permuted);
+}
+
+}
+
+void ArrayKernel::garbage_collection(std::vector<VertexHandle>*   _vh_map,
+                                     std::vector<HalfedgeHandle>* _hh_map,
+                                     std::vector<FaceHandle>*     _fh_map,
+                                     bool _preserve_order,
+                                     bool _v, bool _e, bool _f)
+{
+#ifdef DEBUG
+  #ifndef OM_GARBAGE_NO_STATUS_WARNING
+    if ( !this->has_vertex_status() )
+      omerr() << "garbage_collection: No vertex status available. You can request it: mesh.request_vertex_status() or define OM_GARBAGE_NO_STATUS_WARNING to silence this warning." << std::endl;
+    if ( !this->has_edge_status() )
+      omerr() << "garbage_collection: No edge status available. You can request it: mesh.request_edge_status() or define OM_GARBAGE_NO_STATUS_WARNING to silence this warning." << std::endl;
+    if ( !this->has_face_status() )
+      omerr() << "garbage_collection: No face status available. You can request it: mesh.request_face_status() or define OM_GARBAGE_NO_STATUS_WARNING to silence this warning." << std::endl;
+  #endif
+#endif
+
+  const int nV = int(n_vertices());
+  const int nE = int(n_edges());
+  const int nH = int(n_halfedges());
+  const int nF = int(n_faces());
+
+  // old index -> new index, -1 for removed elements, empty for identity
+  std::vector<int> v_map, e_map, h_map, f_map;
+
+  // remove deleted vertices
+  if (_v && nV > 0 && this->has_vertex_status() )
+  {
+    const int n = compaction_map<VertexHandle>(*this, nV, _preserve_order, v_map);
+    compact_items(vertices_, v_map, n);
+    vprops_compact(v_map, n);
+  }
+
+  // remove deleted edges
+  if (_e && nE > 0 && this->has_edge_status() )
+  {
+    const int n = compaction_map<EdgeHandle>(*this, nE, _preserve_order, e_map);
+
+    h_map.resize(nH);
+    for (int i=0; i<nE; ++i)
+    {
+      h_map[2*i]   = (e_map[i] == -1) ? -1 : 2*e_map[i];
+      h_map[2*i+1] = (e_map[i] == -1) ? -1 : 2*e_map[i]+1;
+    }
+
+    compact_items(edges_, e_map, n);
+    eprops_compact(e_map, n);
+    hprops_compact(h_map, 2*n);
+  }
+
+  // remove deleted faces
+  if (_f && nF > 0 && this->has_face_status() )
+  {
+    const int n = compaction_map<FaceHandle>(*this, nF, _preserve_order, f_map);
+    compact_items(faces_, f_map, n);
+    fprops_compact(f_map, n);
+  }
+
+  // update handles of vertices
+  if (!h_map.empty())
+  {
+    KernelVertexIter v_it(vertices_begin()), v_end(vertices_end());
+    VertexHandle     vh;
+
+    for (; v_it!=v_end; ++v_it)
+    {
+      vh = handle(*v_it);
+      if (!is_isolated(vh))
+        set_halfedge_handle(vh, HalfedgeHandle(h_map[halfedge_handle(vh).idx()]));
+    }
+  }
+
+  // update handles of halfedges
+  if (!v_map.empty() || !h_map.empty() || !f_map.empty())
+  {
+    const int n_halfedges_new = int(n_halfedges());
+    HalfedgeHandle hh;
+
+    for (int i=0; i<n_halfedges_new; ++i)
+    {
+      hh = HalfedgeHandle(i);
+      if (!v_map.empty())
+        set_vertex_handle(hh, VertexHandle(v_map[to_vertex_handle(hh).idx()]));
+      if (!h_map.empty())
+        set_next_halfedge_handle(hh, HalfedgeHandle(h_map[next_halfedge_handle(hh).idx()]));
+      if (!f_map.empty() && !is_boundary(hh))
+        set_face_handle(hh, FaceHandle(f_map[face_handle(hh).idx()]));
+    }
+  }
+
+  // update handles of faces
+  if (!h_map.empty())
+  {
+    KernelFaceIter  f_it(faces_begin()), f_end(faces_end());
+    FaceHandle      fh;
+
+    for (; f_it!=f_end; ++f_it)
+    {
+      fh = handle(*f_it);
+      set_halfedge_handle(fh, HalfedgeHandle(h_map[halfedge_handle(fh).idx()]));
+    }
+  }
+
+  export_map(v_map, nV, _vh_map);
+  export_map(h_map, nH, _hh_map);
+  export_map(f_map, nF, _fh_map);
+}
+
+bool ArrayKernel::permute(const std::vector<int>& _v_new_index,
+                          const std::vector<int>& _e_new_index,
+                          const std::vector<int>& _f_new_index)
+{
+  const int nV = int(n_vertices());
+  const int nE = int(n_edges());
+  const int nF = int(n_faces());
+
+  if (!is_permutation(_v_new_index, nV) ||
+      !is_permutation(_e_new_index, nE) ||
+      !is_permutation(_f_new_index, nF))
+    return false;
+
+  const std::vector<int>& v_map = _v_new_index;
+  const std::vector<int>& f_map = _f_new_index;
+  std::vector<int> h_map;
+
+  if (!v_map.empty())
+  {
+    permute_items(vertices_, v_map);
+    vprops_permute(v_map);
+  }
+
+  if (!_e_new_index.empty())
+  {
+    h_map.resize(2*nE);
+    for (int i=0; i<nE; ++i)
+    {
+      h_map[2*i]   = 2*_e_new_index[i];
+      h_map[2*i+1] = 2*_e_new_index[i]+1;
+    }
+
+    permute_items(edges_, _e_new_index);
+    eprops_permute(_e_new_index);
+    hprops_permute(h_map);
+  }
+
+  if (!f_map.empty())
+  {
+    permute_items(faces_, f_map);
+    fprops_permute(f_map);
+  }
+
+  // update handles of vertices
+  if (!h_map.empty())
+  {
+    for (int i=0; i<nV; ++i)
+    {
+      const VertexHandle vh(i);
+      if (!is_isolated(vh))
+        set_halfedge_handle(vh, HalfedgeHandle(h_map[halfedge_handle(vh).idx()]));
+    }
+  }
+
+  // update handles of halfedges
+  if (!v_map.empty() || !h_map.empty() || !f_map.empty())
+  {
+    const int nH = int(n_halfedges());
+    for (int i=0; i<nH; ++i)
+    {
+      const HalfedgeHandle hh(i);
+      if (!v_map.empty())
+        set_vertex_handle(hh, VertexHandle(v_map[to_vertex_handle(hh).idx()]));
+      if (!h_map.empty())
+        set_next_halfedge_handle(hh, HalfedgeHandle(h_map[next_halfedge_handle(hh).idx()]));
+      if (!f_map.empty() && !is_boundary(hh))
+        set_face_handle(hh, FaceHandle(f_map[face_handle(hh).idx()]));
+    }
+  }
+
+  // update handles of faces
+  if (!h_map.empty())
+  {
+    for (int i=0; i<nF; ++i)
+    {
+      const FaceHandle fh(i);
+      set_halfedge_handle(fh, HalfedgeHandle(h_map[halfedge_handle(fh).idx()]));
+    }
+  }
+
+  return true;
 }
 
 void ArrayKernel::clean()
@@ -231,7 +644,9 @@ void ArrayKernel::reserve(size_t _n_vertices, size_t _n_edges, size_t _n_faces )
 // Status Sets API
 void ArrayKernel::init_bit_masks(BitMaskContainer& _bmc)
 {
-  for (unsigned int i = Attributes::UNUSED; i != 0; i <<= 1)
+  // only the bits that fit into the status (none with OM_COMPACT_STATUS)
+  const unsigned int max_bit = (unsigned int)(StatusInfo::value_type(~0u));
+  for (unsigned int i = Attributes::UNUSED; i != 0 && i <= max_bit; i <<= 1)
   {
     _bmc.push_back(i);
   }
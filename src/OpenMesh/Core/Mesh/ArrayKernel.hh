@@ -251,6 +251,35 @@ public:
   void resize( size_t _n_vertices, size_t _n_edges, size_t _n_faces );
   void reserve(size_t _n_vertices, size_t _n_edges, size_t _n_faces );
 
+  // --- raw connectivity ---
+
+  /** \brief Export the raw half-edge connectivity
+   *
+   * _vertex_halfedges[v] is the outgoing halfedge of vertex v, _face_halfedges[f]
+   * one halfedge of face f, and halfedge h is stored as the triple
+   * _halfedges[3*h] = to vertex, _halfedges[3*h+1] = next halfedge,
+   * _halfedges[3*h+2] = face. Invalid handles are stored as -1.
+   */
+  void get_connectivity(std::vector<int>& _vertex_halfedges,
+                        std::vector<int>& _halfedges,
+                        std::vector<int>& _face_halfedges) const;
+
+  /** \brief Restore the raw half-edge connectivity written by get_connectivity()
+   *
+   * The mesh has to contain the vertices already, but no edges or faces. The
+   * edges and faces are created directly from the arrays, the previous
+   * halfedges are derived from the next halfedges. This is much faster than
+   * adding the faces one by one. The arrays are checked for index ranges and
+   * for a consistent topology: the next halfedges form closed cycles, each
+   * face is one of them, and each vertex halfedge points out of its vertex.
+   * Faces are not checked for being manifold.
+   *
+   * @return false and leave the mesh untouched if the arrays do not fit
+   */
+  bool set_connectivity(const std::vector<int>& _vertex_halfedges,
+                        const std::vector<int>& _halfedges,
+                        const std::vector<int>& _face_halfedges);
+
   // --- deletion ---
   /** \brief garbage collection
    *
@@ -269,6 +298,32 @@ public:
    */
   void garbage_collection(bool _v=true, bool _e=true, bool _f=true);
 
+  /** \brief garbage collection returning the handle remapping
+   *
+   * Same as garbage_collection(bool, bool, bool), but reports where each
+   * element went. After the call (*_vh_map)[i] is the new handle of the
+   * vertex that had index i before, or an invalid handle if that vertex has
+   * been removed. Any of the maps may be NULL.
+   *
+   * Unless _preserve_order is set, the remaining elements at the end of each
+   * array are moved into the gaps (the classic behaviour). With _preserve_order
+   * the relative order of the remaining elements is kept, at the cost of
+   * moving more of them.
+   *
+   * @param _vh_map Old to new vertex handles (output, may be NULL)
+   * @param _hh_map Old to new halfedge handles (output, may be NULL)
+   * @param _fh_map Old to new face handles (output, may be NULL)
+   * @param _preserve_order Keep the relative order of the remaining elements?
+   * @param _v Remove deleted vertices?
+   * @param _e Remove deleted edges?
+   * @param _f Remove deleted faces?
+   */
+  void garbage_collection(std::vector<VertexHandle>*   _vh_map,
+                          std::vector<HalfedgeHandle>* _hh_map,
+                          std::vector<FaceHandle>*     _fh_map,
+                          bool _preserve_order = false,
+                          bool _v=true, bool _e=true, bool _f=true);
+
   /** \brief garbage collection with handle tracking
    *
    * Usually if you delete primitives in OpenMesh, they are only flagged as deleted.
@@ -294,6 +349,22 @@ public:
                           std_API_Container_FHandlePointer& fh_to_update,
                           bool _v=true, bool _e=true, bool _f=true);
 
+  /** \brief Reorder the mesh elements
+   *
+   * Moves vertex i to position _v_new_index[i], edge i to _e_new_index[i]
+   * and face i to _f_new_index[i]. All properties are permuted along with
+   * their elements, the halfedges 2i and 2i+1 follow their edge i to
+   * 2*_e_new_index[i] and 2*_e_new_index[i]+1. An empty vector keeps the
+   * order of that element type. Like garbage collection this invalidates
+   * all handles held outside the mesh.
+   *
+   * @return false and leave the mesh untouched if one of the vectors is not
+   *         a permutation of the element indices
+   */
+  bool permute(const std::vector<int>& _v_new_index,
+               const std::vector<int>& _e_new_index,
+               const std::vector<int>& _f_new_index);
+
   /** \brief Clear the whole mesh
    *
    *  This will remove all properties and elements from the mesh
@@ -383,9 +454,11 @@ public:
     set_prev_halfedge_handle(_heh, _pheh, HasPrevHalfedge());
   }
 
+#ifndef OM_NO_PREV_HALFEDGE
   void set_prev_halfedge_handle(HalfedgeHandle _heh, HalfedgeHandle _pheh,
                                 GenProg::TrueType)
   { halfedge(_heh).prev_halfedge_handle_ = _pheh; }
+#endif
 
   void set_prev_halfedge_handle(HalfedgeHandle /* _heh */, HalfedgeHandle /* _pheh */,
                                 GenProg::FalseType)
@@ -394,8 +467,10 @@ public:
   HalfedgeHandle prev_halfedge_handle(HalfedgeHandle _heh) const
   { return prev_halfedge_handle(_heh, HasPrevHalfedge() ); }
 
+#ifndef OM_NO_PREV_HALFEDGE
   HalfedgeHandle prev_halfedge_handle(HalfedgeHandle _heh, GenProg::TrueType) const
   { return halfedge(_heh).prev_halfedge_handle_; }
+#endif
 
   HalfedgeHandle prev_halfedge_handle(HalfedgeHandle _heh, GenProg::FalseType) const
   {
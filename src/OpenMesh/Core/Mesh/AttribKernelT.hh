@@ -55,6 +55,7 @@
 #include <OpenMesh/Core/Mesh/Attributes.hh>
 #include <OpenMesh/Core/Utils/GenProg.hh>
 #include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <OpenMesh/Core/Utils/SoAPropertyT.hh>
 #include <vector>
 #include <algorithm>
 
@@ -71,6 +72,13 @@ namespace OpenMesh {
  the functions/types defined here provide a subset of the kernel
  interface as described in Concepts::KernelT.
 
+ If the vertex attributes of the traits contain Attributes::SoA, points
+ and vertex normals are stored in a SoAPropertyT, i.e. as separate
+ aligned arrays for the x, y and z coordinates. point_coordinates() and
+ vertex_normal_coordinates() give direct access to these arrays. point()
+ and normal(VertexHandle) then return copies instead of references, so
+ points have to be changed with set_point().
+
  \see Concepts::KernelT
 */
 template <class MeshItems, class Connectivity>
@@ -112,6 +120,22 @@ public:
     MAttribs = MeshItems::MAttribs
   };
 
+  /// Property classes used for the points and vertex normals
+  typedef typename GenProg::IF< bool(MeshItems::VAttribs & Attributes::SoA),
+                                SoAPropertyT<Point>,
+                                PropertyT<Point> >::Result           PointsProperty;
+  typedef typename GenProg::IF< bool(MeshItems::VAttribs & Attributes::SoA),
+                                SoAPropertyT<Normal>,
+                                PropertyT<Normal> >::Result          VertexNormalsProperty;
+
+  /// Return types of point() and normal(VertexHandle): references, or copies for Attributes::SoA
+  typedef typename GenProg::IF< bool(MeshItems::VAttribs & Attributes::SoA),
+                                const Point, Point& >::Result        PointReference;
+  typedef typename GenProg::IF< bool(MeshItems::VAttribs & Attributes::SoA),
+                                const Point, const Point& >::Result  ConstPointReference;
+  typedef typename GenProg::IF< bool(MeshItems::VAttribs & Attributes::SoA),
+                                const Normal, const Normal& >::Result ConstVertexNormalReference;
+
   typedef VPropHandleT<VertexData>              DataVPropHandle;
   typedef HPropHandleT<HalfedgeData>            DataHPropHandle;
   typedef EPropHandleT<EdgeData>                DataEPropHandle;
@@ -138,7 +162,7 @@ public:
     refcount_ftextureIndex_(0),
     refcount_mtexfile_(0)
   {
-    this->add_property( points_, "v:points" );
+    add_vertex_property_storage<PointsProperty>( points_, "v:points" );
 
     if (VAttribs & Attributes::Normal)
       request_vertex_normals();
@@ -232,29 +256,52 @@ public:
 
   //-------------------------------------------------------------------- points
 
+  /// Array of all points. Not available for Attributes::SoA.
   const Point* points() const
-  { return this->property(points_).data(); }
+  { return points_property().data(); }
 
-  const Point& point(VertexHandle _vh) const
-  { return this->property(points_, _vh); }
+  ConstPointReference point(VertexHandle _vh) const
+  { return points_property()[_vh.idx()]; }
 
-  Point& point(VertexHandle _vh)
-  { return this->property(points_, _vh); }
+  PointReference point(VertexHandle _vh)
+  { return points_property()[_vh.idx()]; }
 
   void set_point(VertexHandle _vh, const Point& _p)
-  { this->property(points_, _vh) = _p; }
+  { points_property()[_vh.idx()] = _p; }
+
+  /** Aligned array of the \c _i-th coordinate of all points, holding
+      n_vertices() values. Only available for Attributes::SoA. The pointer
+      is invalidated when vertices are added or garbage collected.
+  */
+  const Scalar* point_coordinates(int _i) const
+  { return points_property().component(_i); }
+
+  /// Mutable version of point_coordinates(). Only available for Attributes::SoA.
+  Scalar* point_coordinates(int _i)
+  { return points_property().component(_i); }
 
 
   //------------------------------------------------------------ vertex normals
 
+  /// Array of all vertex normals. Not available for Attributes::SoA.
   const Normal* vertex_normals() const
-  { return this->property(vertex_normals_).data(); }
+  { return vertex_normals_property().data(); }
 
-  const Normal& normal(VertexHandle _vh) const
-  { return this->property(vertex_normals_, _vh); }
+  ConstVertexNormalReference normal(VertexHandle _vh) const
+  { return vertex_normals_property()[_vh.idx()]; }
 
   void set_normal(VertexHandle _vh, const Normal& _n)
-  { this->property(vertex_normals_, _vh) = _n; }
+  { vertex_normals_property()[_vh.idx()] = _n; }
+
+  /** Aligned array of the \c _i-th coordinate of all vertex normals.
+      Only available for Attributes::SoA, see point_coordinates().
+  */
+  const Scalar* vertex_normal_coordinates(int _i) const
+  { return vertex_normals_property().component(_i); }
+
+  /// Mutable version of vertex_normal_coordinates(). Only available for Attributes::SoA.
+  Scalar* vertex_normal_coordinates(int _i)
+  { return vertex_normals_property().component(_i); }
 
 
   //------------------------------------------------------------- vertex colors
@@ -426,7 +473,7 @@ public:
   void request_vertex_normals()
   {
     if (!refcount_vnormals_++)
-      this->add_property( vertex_normals_, "v:normals" );
+      add_vertex_property_storage<VertexNormalsProperty>( vertex_normals_, "v:normals" );
   }
 
   void request_vertex_colors()
@@ -638,6 +685,7 @@ public:
 
 public:
   //standard vertex properties
+  /// \note With Attributes::SoA, the points and vertex normals are no PropertyT, use point() and normal() instead
   PointsPropertyHandle                      points_pph() const
   { return points_; }
 
@@ -717,6 +765,28 @@ public:
   const HalfedgeData&                       data(HalfedgeHandle _heh) const
   { return this->property(data_hpph_, _heh); }
 
+private:
+
+  /// Adds a standard vertex property stored in a property object of class P
+  template <class P, class T>
+  void add_vertex_property_storage(VPropHandleT<T>& _ph, const std::string& _name)
+  {
+    _ph = VPropHandleT<T>( int(this->_add_vprop( new P(_name) )) );
+    this->_vprop( _ph.idx() ).resize( this->n_vertices() );
+  }
+
+  PointsProperty& points_property()
+  { return static_cast<PointsProperty&>( this->_vprop( points_.idx() ) ); }
+
+  const PointsProperty& points_property() const
+  { return static_cast<const PointsProperty&>( this->_vprop( points_.idx() ) ); }
+
+  VertexNormalsProperty& vertex_normals_property()
+  { return static_cast<VertexNormalsProperty&>( this->_vprop( vertex_normals_.idx() ) ); }
+
+  const VertexNormalsProperty& vertex_normals_property() const
+  { return static_cast<const VertexNormalsProperty&>( this->_vprop( vertex_normals_.idx() ) ); }
+
 private:
   //standard vertex properties
   PointsPropertyHandle                      points_;
@@ -92,7 +92,8 @@ enum AttributeBits
   TexCoord2D    = 32,  ///< Add 2D texture coordinates (vertices, halfedges)
   TexCoord3D    = 64,  ///< Add 3D texture coordinates (vertices, halfedges)
   TextureIndex  = 128, ///< Add texture index (faces)
-  TexFile       = 256  ///< Add texture file (mesh)
+  TexFile       = 256, ///< Add texture file (mesh)
+  SoA           = 512  ///< Store points and normals as aligned structure of arrays, see SoAPropertyT (vertices)
 };
 
 
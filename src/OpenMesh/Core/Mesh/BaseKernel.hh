@@ -285,6 +285,8 @@ public: //--------------------------------------------------- access properties
    *
    *  This method returns a reference to property. The property handle
    *  must be valid! The result is unpredictable if the handle is invalid!
+   *  Data whose loading has been deferred is restored here, see
+   *  BaseProperty::set_loader().
    *
    *  \param  _ph     A \em valid (!) property handle.
    *  \return The wanted property if the handle is valid.
@@ -292,47 +294,67 @@ public: //--------------------------------------------------- access properties
 
   template <class T>
   PropertyT<T>& property(VPropHandleT<T> _ph) {
-    return vprops_.property(_ph);
+    PropertyT<T>& p = vprops_.property(_ph);
+    p.load();
+    return p;
   }
   template <class T>
   const PropertyT<T>& property(VPropHandleT<T> _ph) const {
-    return vprops_.property(_ph);
+    const PropertyT<T>& p = vprops_.property(_ph);
+    p.load();
+    return p;
   }
 
   template <class T>
   PropertyT<T>& property(HPropHandleT<T> _ph) {
-    return hprops_.property(_ph);
+    PropertyT<T>& p = hprops_.property(_ph);
+    p.load();
+    return p;
   }
   template <class T>
   const PropertyT<T>& property(HPropHandleT<T> _ph) const {
-    return hprops_.property(_ph);
+    const PropertyT<T>& p = hprops_.property(_ph);
+    p.load();
+    return p;
   }
 
   template <class T>
   PropertyT<T>& property(EPropHandleT<T> _ph) {
-    return eprops_.property(_ph);
+    PropertyT<T>& p = eprops_.property(_ph);
+    p.load();
+    return p;
   }
   template <class T>
   const PropertyT<T>& property(EPropHandleT<T> _ph) const {
-    return eprops_.property(_ph);
+    const PropertyT<T>& p = eprops_.property(_ph);
+    p.load();
+    return p;
   }
 
   template <class T>
   PropertyT<T>& property(FPropHandleT<T> _ph) {
-    return fprops_.property(_ph);
+    PropertyT<T>& p = fprops_.property(_ph);
+    p.load();
+    return p;
   }
   template <class T>
   const PropertyT<T>& property(FPropHandleT<T> _ph) const {
-    return fprops_.property(_ph);
+    const PropertyT<T>& p = fprops_.property(_ph);
+    p.load();
+    return p;
   }
 
   template <class T>
   PropertyT<T>& mproperty(MPropHandleT<T> _ph) {
-    return mprops_.property(_ph);
+    PropertyT<T>& p = mprops_.property(_ph);
+    p.load();
+    return p;
   }
   template <class T>
   const PropertyT<T>& mproperty(MPropHandleT<T> _ph) const {
-    return mprops_.property(_ph);
+    const PropertyT<T>& p = mprops_.property(_ph);
+    p.load();
+    return p;
   }
 
   //@}
@@ -342,71 +364,92 @@ public: //-------------------------------------------- access property elements
   /// \name Access a property element using a handle to a mesh item
   //@{
 
-  /** Return value of property for an item
+  /** Return value of property for an item. Data whose loading has been
+   *  deferred is restored on the first access, see BaseProperty::set_loader().
    */
 
   template <class T>
   typename VPropHandleT<T>::reference
   property(VPropHandleT<T> _ph, VertexHandle _vh) {
-    return vprops_.property(_ph)[_vh.idx()];
+    PropertyT<T>& p = vprops_.property(_ph);
+    p.load();
+    return p[_vh.idx()];
   }
 
   template <class T>
   typename VPropHandleT<T>::const_reference
   property(VPropHandleT<T> _ph, VertexHandle _vh) const {
-    return vprops_.property(_ph)[_vh.idx()];
+    const PropertyT<T>& p = vprops_.property(_ph);
+    p.load();
+    return p[_vh.idx()];
   }
 
 
   template <class T>
   typename HPropHandleT<T>::reference
   property(HPropHandleT<T> _ph, HalfedgeHandle _hh) {
-    return hprops_.property(_ph)[_hh.idx()];
+    PropertyT<T>& p = hprops_.property(_ph);
+    p.load();
+    return p[_hh.idx()];
   }
 
   template <class T>
   typename HPropHandleT<T>::const_reference
   property(HPropHandleT<T> _ph, HalfedgeHandle _hh) const {
-    return hprops_.property(_ph)[_hh.idx()];
+    const PropertyT<T>& p = hprops_.property(_ph);
+    p.load();
+    return p[_hh.idx()];
   }
 
 
   template <class T>
   typename EPropHandleT<T>::reference
   property(EPropHandleT<T> _ph, EdgeHandle _eh) {
-    return eprops_.property(_ph)[_eh.idx()];
+    PropertyT<T>& p = eprops_.property(_ph);
+    p.load();
+    return p[_eh.idx()];
   }
 
   template <class T>
   typename EPropHandleT<T>::const_reference
   property(EPropHandleT<T> _ph, EdgeHandle _eh) const {
-    return eprops_.property(_ph)[_eh.idx()];
+    const PropertyT<T>& p = eprops_.property(_ph);
+    p.load();
+    return p[_eh.idx()];
   }
 
 
   template <class T>
   typename FPropHandleT<T>::reference
   property(FPropHandleT<T> _ph, FaceHandle _fh) {
-    return fprops_.property(_ph)[_fh.idx()];
+    PropertyT<T>& p = fprops_.property(_ph);
+    p.load();
+    return p[_fh.idx()];
   }
 
   template <class T>
   typename FPropHandleT<T>::const_reference
   property(FPropHandleT<T> _ph, FaceHandle _fh) const {
-    return fprops_.property(_ph)[_fh.idx()];
+    const PropertyT<T>& p = fprops_.property(_ph);
+    p.load();
+    return p[_fh.idx()];
   }
 
 
   template <class T>
   typename MPropHandleT<T>::reference
   property(MPropHandleT<T> _ph) {
-    return mprops_.property(_ph)[0];
+    PropertyT<T>& p = mprops_.property(_ph);
+    p.load();
+    return p[0];
   }
 
   template <class T>
   typename MPropHandleT<T>::const_reference
   property(MPropHandleT<T> _ph) const {
-    return mprops_.property(_ph)[0];
+    const PropertyT<T>& p = mprops_.property(_ph);
+    p.load();
+    return p[0];
   }
 
   //@}
@@ -423,7 +466,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(VPropHandleT<T>& _ph, VertexHandle _vh_from, VertexHandle _vh_to) {
     if(_vh_from.is_valid() && _vh_to.is_valid())
-      vprops_.property(_ph)[_vh_to.idx()] = vprops_.property(_ph)[_vh_from.idx()];
+      property(_ph, _vh_to) = property(_ph, _vh_from);
   }
 
   /** Copies a single property from one mesh element to another (of the same type)
@@ -435,7 +478,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(HPropHandleT<T> _ph, HalfedgeHandle _hh_from, HalfedgeHandle _hh_to) {
     if(_hh_from.is_valid() && _hh_to.is_valid())
-      hprops_.property(_ph)[_hh_to.idx()] = hprops_.property(_ph)[_hh_from.idx()];
+      property(_ph, _hh_to) = property(_ph, _hh_from);
   }
 
   /** Copies a single property from one mesh element to another (of the same type)
@@ -447,7 +490,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(EPropHandleT<T> _ph, EdgeHandle _eh_from, EdgeHandle _eh_to) {
     if(_eh_from.is_valid() && _eh_to.is_valid())
-      eprops_.property(_ph)[_eh_to.idx()] = eprops_.property(_ph)[_eh_from.idx()];
+      property(_ph, _eh_to) = property(_ph, _eh_from);
   }
 
   /** Copies a single property from one mesh element to another (of the same type)
@@ -459,7 +502,7 @@ public: //------------------------------------------------ copy property
   template <class T>
   void copy_property(FPropHandleT<T> _ph, FaceHandle _fh_from, FaceHandle _fh_to) {
     if(_fh_from.is_valid() && _fh_to.is_valid())
-      fprops_.property(_ph)[_fh_to.idx()] = fprops_.property(_ph)[_fh_from.idx()];
+      property(_ph, _fh_to) = property(_ph, _fh_from);
   }
 
 
@@ -654,6 +697,12 @@ protected: //------------------------------------------- synchronize properties
   void vprops_swap(unsigned int _i0, unsigned int _i1) const {
     vprops_.swap(_i0, _i1);
   }
+  void vprops_compact(const std::vector<int>& _new_index, size_t _n) const {
+    vprops_.compact(_new_index, _n);
+  }
+  void vprops_permute(const std::vector<int>& _new_index) const {
+    vprops_.permute(_new_index);
+  }
 
   void hprops_reserve(size_t _n) const { hprops_.reserve(_n); }
   void hprops_resize(size_t _n) const { hprops_.resize(_n); }
@@ -663,6 +712,12 @@ protected: //------------------------------------------- synchronize properties
   void hprops_swap(unsigned int _i0, unsigned int _i1) const {
     hprops_.swap(_i0, _i1);
   }
+  void hprops_compact(const std::vector<int>& _new_index, size_t _n) const {
+    hprops_.compact(_new_index, _n);
+  }
+  void hprops_permute(const std::vector<int>& _new_index) const {
+    hprops_.permute(_new_index);
+  }
 
   void eprops_reserve(size_t _n) const { eprops_.reserve(_n); }
   void eprops_resize(size_t _n) const { eprops_.resize(_n); }
@@ -672,6 +727,12 @@ protected: //------------------------------------------- synchronize properties
   void eprops_swap(unsigned int _i0, unsigned int _i1) const {
     eprops_.swap(_i0, _i1);
   }
+  void eprops_compact(const std::vector<int>& _new_index, size_t _n) const {
+    eprops_.compact(_new_index, _n);
+  }
+  void eprops_permute(const std::vector<int>& _new_index) const {
+    eprops_.permute(_new_index);
+  }
 
   void fprops_reserve(size_t _n) const { fprops_.reserve(_n); }
   void fprops_resize(size_t _n) const { fprops_.resize(_n); }
@@ -681,6 +742,12 @@ protected: //------------------------------------------- synchronize properties
   void fprops_swap(unsigned int _i0, unsigned int _i1) const {
     fprops_.swap(_i0, _i1);
   }
+  void fprops_compact(const std::vector<int>& _new_index, size_t _n) const {
+    fprops_.compact(_new_index, _n);
+  }
+  void fprops_permute(const std::vector<int>& _new_index) const {
+    fprops_.permute(_new_index);
+  }
 
   void mprops_resize(size_t _n) const { mprops_.resize(_n); }
   void mprops_clear() {
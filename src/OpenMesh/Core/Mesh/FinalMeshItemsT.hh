@@ -57,6 +57,7 @@
 #include <OpenMesh/Core/Utils/GenProg.hh>
 #include <OpenMesh/Core/Utils/vector_traits.hh>
 #include <OpenMesh/Core/Mesh/Handles.hh>
+#include <OpenMesh/Core/Mesh/Attributes.hh>
 
 
 //== NAMESPACES ===============================================================
@@ -150,6 +151,9 @@ template<typename LhsTraits, typename RhsTraits> struct ItemsEquality {
     TypeEquality<typename LhsTraits::TexCoord3D, typename RhsTraits::TexCoord3D> te7;
     TypeEquality<typename LhsTraits::TextureIndex, typename RhsTraits::TextureIndex> te8;
     TypeEquality<typename LhsTraits::TexFile, typename RhsTraits::TexFile> te9;
+    // points are stored differently with Attributes::SoA
+    TypeEquality<GenProg::Bool2Type<bool(LhsTraits::VAttribs & Attributes::SoA)>,
+                 GenProg::Bool2Type<bool(RhsTraits::VAttribs & Attributes::SoA)> > te10;
 };
 
 } /* namespace TM */
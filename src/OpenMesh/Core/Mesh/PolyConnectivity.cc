@@ -49,6 +49,7 @@
 //== IMPLEMENTATION ==========================================================
 #include <OpenMesh/Core/Mesh/PolyConnectivity.hh>
 #include <set>
+#include <algorithm>
 
 namespace OpenMesh {
 
@@ -326,6 +327,347 @@ FaceHandle PolyConnectivity::add_face(const std::vector<VertexHandle>& _vhandles
 { return add_face(&_vhandles.front(), _vhandles.size()); }
 
 
+//-----------------------------------------------------------------------------
+
+#ifndef DOXY_IGNORE_THIS
+
+namespace {
+
+/// Open addressing hash table mapping an undirected vertex pair to an edge index
+class EdgeTable
+{
+public:
+
+  explicit EdgeTable(size_t _expected_size)
+  {
+    size_t capacity = 16;
+    while (capacity < 2 * _expected_size)
+      capacity *= 2;
+
+    entries_.resize(capacity);
+    mask_ = capacity - 1;
+  }
+
+  /// Returns the edge index stored for (_v0,_v1) or inserts _idx
+  int find_or_insert(int _v0, int _v1, int _idx)
+  {
+    const unsigned int a = (unsigned int)std::min(_v0, _v1);
+    const unsigned int b = (unsigned int)std::max(_v0, _v1);
+
+    size_t i = hash(a, b) & mask_;
+    while (entries_[i].idx >= 0)
+    {
+      if (entries_[i].a == a && entries_[i].b == b)
+        return entries_[i].idx;
+      i = (i + 1) & mask_;
+    }
+
+    entries_[i].a   = a;
+    entries_[i].b   = b;
+    entries_[i].idx = _idx;
+    return _idx;
+  }
+
+private:
+
+  struct Entry
+  {
+    Entry() : a(0), b(0), idx(-1) {}
+    unsigned int a, b;
+    int          idx;
+  };
+
+  static size_t hash(unsigned int _a, unsigned int _b)
+  {
+    unsigned int h = _a * 0x9e3779b1u ^ (_b + 0x7f4a7c15u + (_a << 6) + (_a >> 2));
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+  }
+
+  std::vector<Entry> entries_;
+  size_t             mask_;
+};
+
+}
+
+#endif
+
+//-----------------------------------------------------------------------------
+
+size_t PolyConnectivity::add_faces(const VertexHandle* _vhandles, const unsigned int* _face_sizes,
+                                   size_t _n_faces, FaceHandle* _fhandles)
+{
+  const int nV = int(n_vertices());
+  size_t    f, i, ii, n_corners(0);
+
+  // The one pass construction is only possible if all vertices are valid
+  // and isolated and no face uses a vertex twice
+  bool bulk = true;
+  {
+    std::vector<int> stamp(nV, -1);
+    const VertexHandle* vhs = _vhandles;
+
+    for (f = 0; f < _n_faces && bulk; vhs += _face_sizes[f++])
+    {
+      if (_face_sizes[f] < 3)
+        continue;
+
+      for (i = 0; i < _face_sizes[f]; ++i)
+      {
+        const int v = vhs[i].idx();
+        if (v < 0 || v >= nV || stamp[v] == int(f) || halfedge_handle(vhs[i]).is_valid())
+        {
+          bulk = false;
+          break;
+        }
+        stamp[v] = int(f);
+      }
+
+      n_corners += _face_sizes[f];
+    }
+  }
+
+  // Local connectivity of the new items. Halfedge 2*e goes from
+  // edge_from[e] to edge_to[e], halfedge 2*e+1 the other way.
+  std::vector<int> edge_from, edge_to;     // per new edge
+  std::vector<int> hface, hnext;           // per new halfedge, -1 = boundary
+  std::vector<int> face_heh;               // per new face
+  std::vector<int> vertex_heh;             // per vertex, -1 = untouched
+
+  // --- build halfedges with an edge hash table ---
+  if (bulk)
+  {
+    EdgeTable edge_table(n_corners);
+    std::vector<int> corner_heh;
+
+    edge_from.reserve(n_corners);
+    edge_to.reserve(n_corners);
+    hface.reserve(2 * n_corners);
+    hnext.reserve(2 * n_corners);
+
+    const VertexHandle* vhs = _vhandles;
+    for (f = 0; f < _n_faces && bulk; vhs += _face_sizes[f++])
+    {
+      const size_t n = _face_sizes[f];
+      if (n < 3)
+        continue;
+
+      const int fidx = int(face_heh.size());
+      corner_heh.resize(n);
+
+      for (i = 0, ii = 1; i < n; ++i, ++ii, ii %= n)
+      {
+        const int v0 = vhs[i].idx(), v1 = vhs[ii].idx();
+        const int e  = edge_table.find_or_insert(v0, v1, int(edge_from.size()));
+
+        if (e == int(edge_from.size()))
+        {
+          // new edge, created in the same order as add_face() would do
+          edge_from.push_back(v0);
+          edge_to.push_back(v1);
+          hface.push_back(-1);  hface.push_back(-1);
+          hnext.push_back(-1);  hnext.push_back(-1);
+        }
+
+        const int heh = (edge_from[e] == v0) ? 2*e : 2*e+1;
+
+        // halfedge already used by another face
+        if (hface[heh] != -1)
+        {
+          bulk = false;
+          break;
+        }
+
+        hface[heh]    = fidx;
+        corner_heh[i] = heh;
+      }
+
+      if (!bulk)
+        break;
+
+      for (i = 0, ii = 1; i < n; ++i, ++ii, ii %= n)
+        hnext[corner_heh[i]] = corner_heh[ii];
+
+      face_heh.push_back(corner_heh[n-1]);
+    }
+  }
+
+  // --- check that every vertex is manifold and link boundary halfedges ---
+  if (bulk)
+  {
+    const int nH = int(hface.size());
+
+    // outgoing halfedges per vertex (compressed row storage)
+    std::vector<int> out_start(nV + 1, 0), out_heh(nH);
+    for (int h = 0; h < nH; ++h)
+      ++out_start[((h & 1) ? edge_to[h >> 1] : edge_from[h >> 1]) + 1];
+    for (int v = 0; v < nV; ++v)
+      out_start[v + 1] += out_start[v];
+    {
+      std::vector<int> fill(out_start.begin(), out_start.end() - 1);
+      for (int h = 0; h < nH; ++h)
+        out_heh[fill[(h & 1) ? edge_to[h >> 1] : edge_from[h >> 1]]++] = h;
+    }
+
+    vertex_heh.assign(nV, -1);
+    std::vector<int> boundary_out, boundary_in;
+
+    for (int v = 0; v < nV && bulk; ++v)
+    {
+      const int begin = out_start[v], end = out_start[v + 1];
+      if (begin == end)
+        continue;
+
+      boundary_out.clear();
+      boundary_in.clear();
+
+      for (int j = begin; j < end; ++j)
+        if (hface[out_heh[j]] == -1)
+          boundary_out.push_back(out_heh[j]);
+
+      const int n_face_out = end - begin - int(boundary_out.size());
+      int       n_visited  = 0;
+
+      if (boundary_out.empty())
+      {
+        // interior vertex: one closed fan has to contain all faces
+        const int h0 = out_heh[begin];
+        int       h  = h0;
+        do
+        {
+          ++n_visited;
+          if (hface[h ^ 1] == -1 || n_visited > n_face_out)
+          {
+            bulk = false;
+            break;
+          }
+          h = hnext[h ^ 1];
+        }
+        while (h != h0);
+
+        vertex_heh[v] = h0;
+      }
+      else
+      {
+        // boundary vertex: open fans between boundary halfedges
+        for (size_t k = 0; k < boundary_out.size() && bulk; ++k)
+        {
+          int h = hnext[boundary_out[k] ^ 1];
+          for (;;)
+          {
+            if (++n_visited > n_face_out)
+            {
+              bulk = false;
+              break;
+            }
+            if (hface[h ^ 1] == -1)
+            {
+              boundary_in.push_back(h ^ 1);
+              break;
+            }
+            h = hnext[h ^ 1];
+          }
+        }
+
+        // chain the fans, so that circulators visit all of them
+        for (size_t k = 0; k < boundary_in.size(); ++k)
+          hnext[boundary_in[k]] = boundary_out[(k + 1) % boundary_out.size()];
+
+        vertex_heh[v] = boundary_out[0];
+      }
+
+      // faces in a second closed fan or a fan attached to a closed one
+      if (n_visited != n_face_out)
+        bulk = false;
+    }
+  }
+
+  // --- fall back to add_face(), which reports non-manifold faces ---
+  if (!bulk)
+  {
+    size_t n_added = 0;
+    const VertexHandle* vhs = _vhandles;
+    std::vector<int> stamp(nV, -1);
+
+    for (f = 0; f < _n_faces; vhs += _face_sizes[f++])
+    {
+      FaceHandle fh;
+      if (_face_sizes[f] > 2)
+      {
+        // add_face() expects valid and distinct vertices
+        bool valid = true;
+        for (i = 0; i < _face_sizes[f] && valid; ++i)
+        {
+          const int v = vhs[i].idx();
+          if (v < 0 || v >= nV)
+          {
+            omerr() << "PolyMeshT::add_faces: invalid vertex index in face " << f << "\n";
+            valid = false;
+          }
+          else if (stamp[v] == int(f))
+          {
+            omerr() << "PolyMeshT::add_faces: face " << f << " uses a vertex twice\n";
+            valid = false;
+          }
+          else
+            stamp[v] = int(f);
+        }
+
+        if (valid)
+          fh = PolyConnectivity::add_face(vhs, _face_sizes[f]);
+      }
+
+      if (fh.is_valid())
+        ++n_added;
+      if (_fhandles)
+        _fhandles[f] = fh;
+    }
+
+    return n_added;
+  }
+
+  // --- create the items in one go ---
+  const int e_base = int(n_edges());
+  const int h_base = 2 * e_base;
+  const int f_base = int(n_faces());
+  const int nE     = int(edge_from.size());
+  const int nF     = int(face_heh.size());
+
+  resize(n_vertices(), e_base + nE, f_base + nF);
+
+  for (int e = 0; e < nE; ++e)
+  {
+    set_vertex_handle(HalfedgeHandle(h_base + 2*e),     VertexHandle(edge_to[e]));
+    set_vertex_handle(HalfedgeHandle(h_base + 2*e + 1), VertexHandle(edge_from[e]));
+  }
+
+  for (int h = 0; h < 2*nE; ++h)
+  {
+    if (hface[h] != -1)
+      set_face_handle(HalfedgeHandle(h_base + h), FaceHandle(f_base + hface[h]));
+    set_next_halfedge_handle(HalfedgeHandle(h_base + h), HalfedgeHandle(h_base + hnext[h]));
+  }
+
+  for (int fi = 0; fi < nF; ++fi)
+    set_halfedge_handle(FaceHandle(f_base + fi), HalfedgeHandle(h_base + face_heh[fi]));
+
+  for (int v = 0; v < nV; ++v)
+    if (vertex_heh[v] != -1)
+      set_halfedge_handle(VertexHandle(v), HalfedgeHandle(h_base + vertex_heh[v]));
+
+  if (_fhandles)
+  {
+    int fi = 0;
+    for (f = 0; f < _n_faces; ++f)
+      _fhandles[f] = (_face_sizes[f] > 2) ? FaceHandle(f_base + fi++) : InvalidFaceHandle;
+  }
+
+  return size_t(nF);
+}
+
+
 //-----------------------------------------------------------------------------
 bool PolyConnectivity::is_collapse_ok(HalfedgeHandle v0v1)
 {
@@ -930,6 +1272,7 @@ PolyConnectivity::remove_edge(EdgeHandle _eh)
 }
 
 //-----------------------------------------------------------------------------
+#ifndef OM_NO_PREV_HALFEDGE
 void PolyConnectivity::reinsert_edge(EdgeHandle _eh)
 {
   //this does not work without prev_halfedge_handle
@@ -979,6 +1322,7 @@ void PolyConnectivity::reinsert_edge(EdgeHandle _eh)
     }
   }
 }
+#endif
 
 //-----------------------------------------------------------------------------
 PolyConnectivity::HalfedgeHandle
@@ -447,6 +447,32 @@ public:
   */
   FaceHandle add_face(const VertexHandle* _vhandles, size_t _vhs_size);
 
+  /** \brief Add and connect many faces at once
+  *
+  * Adds the faces of an indexed face set. The result is the same as
+  * calling add_face() for every face in the given order, but if all
+  * vertices are still isolated the connectivity is built in one pass
+  * using an edge hash table instead of searching every edge with
+  * find_halfedge(). Edges and faces get the same indices as with
+  * add_face(); only the outgoing halfedge stored at interior vertices
+  * may differ.
+  *
+  * If the faces contain a complex edge or a complex vertex, or if some
+  * of the vertices are already connected, the faces are added one by one
+  * through add_face(), which reports the failing faces as usual.
+  * Faces with less than three vertices are skipped. Faces with an invalid
+  * vertex handle or a repeated vertex are reported and not added.
+  *
+  * @param _vhandles   vertex handles of all faces, one face after the other
+  * @param _face_sizes number of vertices of each face
+  * @param _n_faces    number of faces
+  * @param _fhandles   optional array of size _n_faces receiving the handle of
+  *                    each added face (invalid if the face could not be added)
+  * @return number of faces that have been added
+  */
+  size_t add_faces(const VertexHandle* _vhandles, const unsigned int* _face_sizes,
+                   size_t _n_faces, FaceHandle* _fhandles = 0);
+
   //@}
 
   /// \name Deleting mesh items and other connectivity/topology modifications
@@ -1455,10 +1481,13 @@ public:
       only marks items as deleted.
   */
   FaceHandle remove_edge(EdgeHandle _eh);
+#ifndef OM_NO_PREV_HALFEDGE
   /** Inverse of remove_edge. _eh should be the handle of the edge and the
       vertex and halfedge handles pointed by edge(_eh) should be valid. 
+      Not available without previous halfedge handles (OM_NO_PREV_HALFEDGE).
   */
   void reinsert_edge(EdgeHandle _eh);
+#endif
   /** Inserts an edge between to_vh(_prev_heh) and from_vh(_next_heh).
       A new face is created started at heh0 of the inserted edge and
       its halfedges loop includes both _prev_heh and _next_heh. If an 
@@ -65,6 +65,10 @@
 #include <OpenMesh/Core/System/omstream.hh>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 //== NAMESPACES ===============================================================
 
@@ -211,6 +215,24 @@ update_normals()
 //-----------------------------------------------------------------------------
 
 
+template <class Kernel>
+void
+PolyMeshT<Kernel>::
+update_normals(unsigned int _n_threads)
+{
+  // Face normals are required to compute the vertex and the halfedge normals
+  if (Kernel::has_face_normals() ) {
+    update_face_normals(_n_threads);
+
+    if (Kernel::has_vertex_normals() ) update_vertex_normals(_n_threads);
+    if (Kernel::has_halfedge_normals()) update_halfedge_normals(0.8, _n_threads);
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 template <class Kernel>
 void
 PolyMeshT<Kernel>::
@@ -226,6 +248,31 @@ update_face_normals()
 //-----------------------------------------------------------------------------
 
 
+template <class Kernel>
+void
+PolyMeshT<Kernel>::
+update_face_normals(unsigned int _n_threads)
+{
+  // Loop over the index range instead of using FaceIter. Like faces_begin()
+  // in update_face_normals() this visits every face, deleted or hidden ones
+  // included.
+  const int n_faces = int(Kernel::n_faces());
+
+#ifdef _OPENMP
+  const int n_threads = _n_threads ? int(_n_threads) : omp_get_max_threads();
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_faces; ++i)
+  {
+    const FaceHandle fh(i);
+    this->set_normal(fh, calc_face_normal(fh));
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 template <class Kernel>
 void
 PolyMeshT<Kernel>::
@@ -241,6 +288,28 @@ update_halfedge_normals(const double _feature_angle)
 //-----------------------------------------------------------------------------
 
 
+template <class Kernel>
+void
+PolyMeshT<Kernel>::
+update_halfedge_normals(const double _feature_angle, unsigned int _n_threads)
+{
+  const int n_halfedges = int(Kernel::n_halfedges());
+
+#ifdef _OPENMP
+  const int n_threads = _n_threads ? int(_n_threads) : omp_get_max_threads();
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_halfedges; ++i)
+  {
+    const HalfedgeHandle heh(i);
+    this->set_normal(heh, calc_halfedge_normal(heh, _feature_angle));
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
 template <class Kernel>
 typename PolyMeshT<Kernel>::Normal
 PolyMeshT<Kernel>::
@@ -411,6 +480,28 @@ update_vertex_normals()
     this->set_normal(*v_it, calc_vertex_normal(*v_it));
 }
 
+
+//-----------------------------------------------------------------------------
+
+
+template <class Kernel>
+void
+PolyMeshT<Kernel>::
+update_vertex_normals(unsigned int _n_threads)
+{
+  const int n_vertices = int(Kernel::n_vertices());
+
+#ifdef _OPENMP
+  const int n_threads = _n_threads ? int(_n_threads) : omp_get_max_threads();
+  #pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle vh(i);
+    this->set_normal(vh, calc_vertex_normal(vh));
+  }
+}
+
 //=============================================================================
 } // namespace OpenMesh
 //=============================================================================
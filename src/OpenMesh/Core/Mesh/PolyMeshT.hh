@@ -221,6 +221,22 @@ public:
    */
   void update_normals();
 
+  /** \brief Compute normals for all primitives using multiple threads
+   *
+   * Same as update_normals(), but the face, halfedge and vertex passes are
+   * each split into chunks over the index range and processed in parallel.
+   * Like the serial version every item is visited, including deleted and
+   * hidden ones, and computed the same way, so the result is bit-identical
+   * to update_normals().
+   *
+   * \note The parallel code path is only available if OpenMesh (or the
+   *       code instantiating this template) is compiled with OpenMP support.
+   *       Otherwise this function falls back to the serial computation.
+   *
+   * @param _n_threads Number of threads to use, 0 selects the OpenMP default
+   */
+  void update_normals(unsigned int _n_threads);
+
   /// Update normal for face _fh
   void update_normal(FaceHandle _fh)
   { this->set_normal(_fh, calc_face_normal(_fh)); }
@@ -232,6 +248,15 @@ public:
    */
   void update_face_normals();
 
+  /** \brief Update normal vectors for all faces using multiple threads.
+   *
+   * \see update_normals(unsigned int)
+   *
+   * \attention Needs the Attributes::Normal attribute for faces.
+   *            Call request_face_normals() before using it!
+   */
+  void update_face_normals(unsigned int _n_threads);
+
   /** Calculate normal vector for face _fh. */
   virtual Normal calc_face_normal(FaceHandle _fh) const;
 
@@ -261,6 +286,17 @@ public:
    */
   void update_halfedge_normals(const double _feature_angle = 0.8);
 
+  /** \brief Update normal vectors for all halfedges using multiple threads.
+   *
+   * \see update_normals(unsigned int)
+   *
+   * \note Face normals have to be computed first!
+   *
+   * \attention Needs the Attributes::Normal attribute for faces and halfedges.
+   *            Call request_face_normals() and request_halfedge_normals() before using it!
+   */
+  void update_halfedge_normals(const double _feature_angle, unsigned int _n_threads);
+
   /** \brief Calculate halfedge normal for one specific halfedge
    *
    * Calculate normal vector for halfedge _heh.
@@ -295,6 +331,17 @@ public:
    */
   void update_vertex_normals();
 
+  /** \brief Update normal vectors for all vertices using multiple threads.
+   *
+   * \see update_normals(unsigned int)
+   *
+   * \note Face normals have to be computed first!
+   *
+   * \attention Needs the Attributes::Normal attribute for faces and vertices.
+   *            Call request_face_normals() and request_vertex_normals() before using it!
+   */
+  void update_vertex_normals(unsigned int _n_threads);
+
   /** \brief Calculate vertex normal for one specific vertex
    *
    * Calculate normal vector for vertex _vh by averaging normals
@@ -100,7 +100,12 @@ class StatusInfo
 {
 public:
 
+#ifdef OM_COMPACT_STATUS
+  // one byte holds the standard bits, but leaves no room for status sets
+  typedef unsigned char value_type;
+#else
   typedef unsigned int value_type;
+#endif
     
   StatusInfo() : status_(0) {}
 
@@ -155,18 +160,18 @@ public:
   /// return whole status
   unsigned int bits() const { return status_; }
   /// set whole status at once
-  void set_bits(unsigned int _bits) { status_ = _bits; }
+  void set_bits(unsigned int _bits) { status_ = value_type(_bits); }
 
 
   /// is a certain bit set ?
   bool is_bit_set(unsigned int _s) const { return (status_ & _s) > 0; }
   /// set a certain bit
-  void set_bit(unsigned int _s) { status_ |= _s; }
+  void set_bit(unsigned int _s) { status_ = value_type(status_ | _s); }
   /// unset a certain bit
-  void unset_bit(unsigned int _s) { status_ &= ~_s; }
+  void unset_bit(unsigned int _s) { status_ = value_type(status_ & ~_s); }
   /// set or unset a certain bit
   void change_bit(unsigned int _s, bool _b) {  
-    if (_b) status_ |= _s; else status_ &= ~_s; }
+    if (_b) set_bit(_s); else unset_bit(_s); }
 
 
 private: 
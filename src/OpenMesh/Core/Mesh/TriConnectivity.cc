@@ -51,6 +51,7 @@
 
 #include <OpenMesh/Core/Mesh/TriConnectivity.hh>
 #include <OpenMesh/Core/System/omstream.hh>
+#include <algorithm>
 
 namespace OpenMesh
 {
@@ -106,6 +107,52 @@ FaceHandle TriConnectivity::add_face(VertexHandle _vh0, VertexHandle _vh1, Verte
 
 //-----------------------------------------------------------------------------
 
+size_t TriConnectivity::add_faces(const VertexHandle* _vhandles, const unsigned int* _face_sizes,
+                                  size_t _n_faces, FaceHandle* _fhandles)
+{
+  // triangulate the polygons like add_face() does
+  std::vector<VertexHandle> triangles;
+  std::vector<size_t>       last_triangle(_n_faces);
+  size_t                    n_triangles(0);
+
+  const VertexHandle* vhs = _vhandles;
+  for (size_t f = 0; f < _n_faces; vhs += _face_sizes[f++])
+  {
+    for (unsigned int i = 1; i + 1 < _face_sizes[f]; ++i)
+    {
+      triangles.push_back(vhs[0]);
+      triangles.push_back(vhs[i]);
+      triangles.push_back(vhs[i+1]);
+      ++n_triangles;
+    }
+
+    // faces with less than three vertices have no triangle
+    last_triangle[f] = (_face_sizes[f] > 2) ? n_triangles - 1 : size_t(-1);
+  }
+
+  if (n_triangles == 0)
+  {
+    if (_fhandles)
+      std::fill(_fhandles, _fhandles + _n_faces, InvalidFaceHandle);
+    return 0;
+  }
+
+  std::vector<unsigned int> triangle_sizes(n_triangles, 3);
+  std::vector<FaceHandle>   triangle_handles(n_triangles);
+
+  const size_t n_added = PolyConnectivity::add_faces(&triangles[0], &triangle_sizes[0],
+                                                     n_triangles, &triangle_handles[0]);
+
+  if (_fhandles)
+    for (size_t f = 0; f < _n_faces; ++f)
+      _fhandles[f] = (last_triangle[f] != size_t(-1)) ? triangle_handles[last_triangle[f]]
+                                                      : InvalidFaceHandle;
+
+  return n_added;
+}
+
+//-----------------------------------------------------------------------------
+
 bool TriConnectivity::is_collapse_ok(HalfedgeHandle v0v1)
 {
   // is the edge already deleted?
@@ -113,6 +113,15 @@ public:
    * @return FaceHandle of the added face (invalid, if the operation failed)
    */
   FaceHandle add_face(VertexHandle _vh0, VertexHandle _vh1, VertexHandle _vh2);
+
+  /** \brief Add and connect many faces at once
+   *
+   * Override OpenMesh::PolyConnectivity::add_faces(). Faces that aren't
+   * triangles are triangulated like in add_face(), the returned handle
+   * of such a face is the handle of its last triangle.
+   */
+  size_t add_faces(const VertexHandle* _vhandles, const unsigned int* _face_sizes,
+                   size_t _n_faces, FaceHandle* _fhandles = 0);
   
   //@}
 
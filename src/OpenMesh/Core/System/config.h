@@ -99,6 +99,26 @@
 #endif
 
 typedef unsigned int uint;
+
+// ----------------------------------------------------------------------------
+
+/* OM_COMPACT_KERNEL selects the compact kernel layout for memory bound
+   workloads: halfedges without previous handle (OM_NO_PREV_HALFEDGE) and
+   one byte status bits (OM_COMPACT_STATUS). The layout changes the binary
+   interface, so the library and all code using it have to be compiled
+   with the same defines. The CMake build writes the CMake option
+   OPENMESH_COMPACT_KERNEL into the copy of this file it compiles with
+   and installs. */
+/* #undef OM_COMPACT_KERNEL */
+
+#ifdef OM_COMPACT_KERNEL
+#  ifndef OM_NO_PREV_HALFEDGE
+#    define OM_NO_PREV_HALFEDGE
+#  endif
+#  ifndef OM_COMPACT_STATUS
+#    define OM_COMPACT_STATUS
+#  endif
+#endif
 //=============================================================================
 #endif // OPENMESH_CONFIG_H defined
 //=============================================================================
@@ -191,8 +191,22 @@ protected:
     // If working on multiple threads, we need to serialize the output correctly (requires c++11 headers)
     #if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
        std::lock_guard<std::mutex> lck (serializer_);
+       flush_buffer();
+    #elif defined( _OPENMP )
+       // without c++11, serialize with OpenMP if available
+       #pragma omp critical(OpenMeshMostream)
+       flush_buffer();
+    #else
+       flush_buffer();
     #endif
 
+    return base_type::sync();
+  }
+
+
+  // multiplex buffer_ and clear it
+  void flush_buffer()
+  {
     if (!buffer_.empty())
     {
       if (enabled_) multiplex();
@@ -202,7 +216,6 @@ protected:
       buffer_.clear();
 #endif
     }
-    return base_type::sync();
   }
 
 
@@ -219,6 +232,9 @@ protected:
          std::lock_guard<std::mutex> lck (serializer_);
          buffer_.push_back(c);
        }
+    #elif defined( _OPENMP )
+      #pragma omp critical(OpenMeshMostream)
+      buffer_.push_back(c);
     #else
       buffer_.push_back(c);
     #endif
@@ -104,4 +104,16 @@ OpenMesh::mostream& omerr()
 }
 
 
+// Create the streams during the static initialization of the library, so
+// that the first calls from several threads do not race on the lazy
+// initialization above.
+namespace {
+struct InitStreams
+{
+  InitStreams() { omlog(); omout(); omerr(); }
+};
+InitStreams init_streams;
+}
+
+
 //=============================================================================
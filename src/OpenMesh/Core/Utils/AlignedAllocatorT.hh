@@ -0,0 +1,161 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_ALIGNEDALLOCATORT_HH
+#define OPENMESH_ALIGNEDALLOCATORT_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <cstddef>
+#include <new>
+#if defined(_WIN32)
+#  include <malloc.h>
+#else
+#  include <stdlib.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class AlignedAllocatorT AlignedAllocatorT.hh <OpenMesh/Core/Utils/AlignedAllocatorT.hh>
+
+    Standard conforming allocator returning memory aligned to \c Alignment
+    bytes (a power of two, at least sizeof(void*)). Use it with std::vector
+    to get arrays whose first element starts at a cache line or SIMD
+    register boundary.
+
+    \see SoAPropertyT
+*/
+template <class T, size_t Alignment = 64>
+class AlignedAllocatorT
+{
+public:
+
+  typedef T              value_type;
+  typedef T*             pointer;
+  typedef const T*       const_pointer;
+  typedef T&             reference;
+  typedef const T&       const_reference;
+  typedef size_t         size_type;
+  typedef std::ptrdiff_t difference_type;
+
+  template <class U> struct rebind { typedef AlignedAllocatorT<U, Alignment> other; };
+
+  /// Alignment of the returned memory in bytes
+  enum { alignment = Alignment };
+
+public:
+
+  AlignedAllocatorT() {}
+
+  template <class U>
+  AlignedAllocatorT(const AlignedAllocatorT<U, Alignment>&) {}
+
+  pointer       address(reference _x)       const { return &_x; }
+  const_pointer address(const_reference _x) const { return &_x; }
+
+  pointer allocate(size_type _n, const void* = 0)
+  {
+    if (_n == 0)
+      return 0;
+    if (_n > max_size())
+      throw std::bad_alloc();
+
+#if defined(_WIN32)
+    void* p = _aligned_malloc(_n * sizeof(T), Alignment);
+    if (!p)
+      throw std::bad_alloc();
+#else
+    void* p = 0;
+    if (posix_memalign(&p, Alignment, _n * sizeof(T)) != 0)
+      throw std::bad_alloc();
+#endif
+
+    return static_cast<pointer>(p);
+  }
+
+  void deallocate(pointer _p, size_type)
+  {
+#if defined(_WIN32)
+    _aligned_free(_p);
+#else
+    free(_p);
+#endif
+  }
+
+  size_type max_size() const { return size_type(-1) / sizeof(T); }
+
+  void construct(pointer _p, const T& _v) { new (static_cast<void*>(_p)) T(_v); }
+  void destroy(pointer _p) { _p->~T(); }
+};
+
+
+template <class T, class U, size_t Alignment>
+inline bool operator==(const AlignedAllocatorT<T, Alignment>&, const AlignedAllocatorT<U, Alignment>&)
+{ return true; }
+
+template <class T, class U, size_t Alignment>
+inline bool operator!=(const AlignedAllocatorT<T, Alignment>&, const AlignedAllocatorT<U, Alignment>&)
+{ return false; }
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_ALIGNEDALLOCATORT_HH defined
+//=============================================================================
@@ -57,4 +57,54 @@ void BaseProperty::stats(std::ostream& _ostr) const
   _ostr << "  " << name() << (persistent() ? ", persistent " : "") << "\n";
 }
 
+void BaseProperty::load_deferred() const
+{
+  // Several threads may access a deferred property for the first time,
+  // the first one restores the data while the others wait. pending_ is
+  // cleared last with release semantics, so a thread that sees it
+  // cleared in pending() also sees the restored data.
+#ifdef _OPENMP
+#pragma omp critical(OpenMeshPropertyLoad)
+#endif
+  {
+    if (loader_) {
+      loader_->load(const_cast<BaseProperty&>(*this));
+      delete loader_;
+      loader_ = 0;
+#if defined(__GNUC__)
+      __atomic_store_n(&pending_, 0, __ATOMIC_RELEASE);
+#elif defined(_MSC_VER)
+      *static_cast<volatile int*>(&pending_) = 0;
+#else
+      pending_ = 0;
+#endif
+    }
+  }
+}
+
+void BaseProperty::compact(const std::vector<int>& _new_index, size_t _n)
+{
+  for (size_t i = 0; i < _new_index.size(); ++i)
+    if (_new_index[i] != -1 && size_t(_new_index[i]) != i)
+      swap(i, _new_index[i]);
+  resize(_n);
+}
+
+void BaseProperty::permute(const std::vector<int>& _new_index)
+{
+  // target of the element currently stored at i
+  std::vector<int> target(_new_index);
+
+  for (size_t i = 0; i < target.size(); ++i)
+  {
+    while (size_t(target[i]) != i)
+    {
+      const size_t j = size_t(target[i]);
+      swap(i, j);
+      target[i] = target[j];
+      target[j] = int(j);
+    }
+  }
+}
+
 }
@@ -50,6 +50,7 @@
 #define OPENMESH_BASEPROPERTY_HH
 
 #include <string>
+#include <vector>
 #include <OpenMesh/Core/IO/StoreRestore.hh>
 #include <OpenMesh/Core/System/omstream.hh>
 
@@ -57,6 +58,25 @@ namespace OpenMesh {
 
 //== CLASS DEFINITION =========================================================
 
+class BaseProperty;
+
+/** \class PropertyLoader BaseProperty.hh <OpenMesh/Core/Utils/BaseProperty.hh>
+
+    Restores the data of a property whose loading has been deferred, see
+    BaseProperty::set_loader(). The OM reader uses it to restore custom
+    properties from the mapped file on first access.
+**/
+class OPENMESHDLLEXPORT PropertyLoader
+{
+public:
+
+  virtual ~PropertyLoader() {}
+
+  /// Restore the data of _bp. Called at most once per loader.
+  virtual void load(BaseProperty& _bp) = 0;
+};
+
+
 /** \class BaseProperty Property.hh <OpenMesh/Core/Utils/PropertyT.hh>
 
     Abstract class defining the basic interface of a dynamic property.
@@ -86,15 +106,28 @@ public:
   /// \param _name Optional textual name for the property.
   ///
   BaseProperty(const std::string& _name = "<unknown>")
-  : name_(_name), persistent_(false)
+  : name_(_name), persistent_(false), loader_(0), pending_(0)
   {}
 
   /// \brief Copy constructor
+  ///
+  /// A deferred property is loaded before it is copied.
   BaseProperty(const BaseProperty & _rhs)
-      : name_( _rhs.name_ ), persistent_( _rhs.persistent_ ) {}
+      : name_( _rhs.name_ ), persistent_( _rhs.persistent_ ), loader_(0), pending_(0)
+  { _rhs.load(); }
+
+  /// \brief Assignment, a deferred right hand side is loaded first.
+  BaseProperty& operator=(const BaseProperty & _rhs)
+  {
+    _rhs.load();
+    set_loader(0);
+    name_       = _rhs.name_;
+    persistent_ = _rhs.persistent_;
+    return *this;
+  }
 
   /// Destructor.
-  virtual ~BaseProperty() {}
+  virtual ~BaseProperty() { delete loader_; }
 
 public: // synchronized array interface
 
@@ -115,6 +148,17 @@ public: // synchronized array interface
 
   /// Copy one element to another
   virtual void copy(size_t _io, size_t _i1) = 0;
+
+  /** Move element i to _new_index[i] for all i with _new_index[i] != -1,
+      then resize to _n elements. The target of a move must be the element
+      itself, an element that is dropped or one that has been moved already,
+      e.g. _new_index[i] <= i. The default implementation uses swap(). */
+  virtual void compact(const std::vector<int>& _new_index, size_t _n);
+
+  /** Move element i to _new_index[i] for all i. _new_index must be a
+      permutation of 0..n_elements()-1. The default implementation follows
+      the cycles of the permutation with swap(). */
+  virtual void permute(const std::vector<int>& _new_index);
   
   /// Return a deep copy of self.
   virtual BaseProperty* clone () const = 0;
@@ -164,6 +208,38 @@ public: // I/O support
   **/
   virtual size_t restore( std::istream& _istr, bool _swap ) = 0;
 
+public: // deferred loading
+
+  /** \brief Defer restoring the data of self until it is accessed.
+
+      Self takes ownership of _loader and calls it once on the first
+      access through the mesh (element access included) or any member
+      that changes the size or the order of the elements. The elements
+      must already have their final count. A previous loader is
+      discarded, passing 0 cancels the deferred restore.
+
+      \note The element operator[] of a property object does not check
+      for a pending loader, get the property from the mesh (or call
+      load()) before keeping a reference to it.
+
+      \note Not thread safe, set the loader before the property is shared.
+  **/
+  void set_loader(PropertyLoader* _loader)
+  {
+    if (_loader != loader_)
+      delete loader_;
+    loader_  = _loader;
+    pending_ = (_loader != 0);
+  }
+
+  /// Returns false, if restoring the data of self has been deferred.
+  bool loaded() const { return !pending(); }
+
+  /// Restore the data of self now, if it has been deferred. Cheap enough
+  /// for every element access and safe to be called concurrently, the
+  /// data is restored by the first caller.
+  void load() const { if (pending()) load_deferred(); }
+
 protected:
 
   // To be used in a derived class, when overloading set_persistent()
@@ -177,8 +253,29 @@ protected:
 
 private:
 
+  void load_deferred() const;
+
+  // Read pending_ with acquire semantics, it is cleared with release
+  // semantics after the data has been restored (see load_deferred()).
+  bool pending() const
+  {
+#if defined(__GNUC__)
+    return __atomic_load_n(&pending_, __ATOMIC_ACQUIRE) != 0;
+#elif defined(_MSC_VER)
+    // volatile reads acquire with /volatile:ms, the default on x86 and x64
+    return *static_cast<const volatile int*>(&pending_) != 0;
+#else
+    return pending_ != 0;
+#endif
+  }
+
   std::string name_;
   bool        persistent_;
+
+  // loader_ is only touched under the lock once the property is shared,
+  // pending_ is the flag checked before taking the lock.
+  mutable PropertyLoader* loader_;
+  mutable int             pending_;
 };
 
 }//namespace OpenMesh
@@ -114,14 +114,38 @@ public:
 
 public: // inherited from BaseProperty
 
-  virtual void reserve(size_t _n) { data_.reserve(_n);    }
-  virtual void resize(size_t _n)  { data_.resize(_n);     }
-  virtual void clear()  { data_.clear(); vector_type().swap(data_);    }
-  virtual void push_back()        { data_.push_back(T()); }
+  virtual void reserve(size_t _n) { load(); data_.reserve(_n);    }
+  virtual void resize(size_t _n)  { load(); data_.resize(_n);     }
+  virtual void clear()  { set_loader(0); data_.clear(); vector_type().swap(data_);    }
+  virtual void push_back()        { load(); data_.push_back(T()); }
   virtual void swap(size_t _i0, size_t _i1)
-  { std::swap(data_[_i0], data_[_i1]); }
+  { load(); std::swap(data_[_i0], data_[_i1]); }
   virtual void copy(size_t _i0, size_t _i1)
-  { data_[_i1] = data_[_i0]; }
+  { load(); data_[_i1] = data_[_i0]; }
+  virtual void compact(const std::vector<int>& _new_index, size_t _n)
+  {
+    load();
+    for (size_t i = 0; i < _new_index.size(); ++i)
+      if (_new_index[i] != -1 && size_t(_new_index[i]) != i)
+#if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
+        data_[_new_index[i]] = std::move(data_[i]);
+#else
+        data_[_new_index[i]] = data_[i];
+#endif
+    data_.resize(_n);
+  }
+  virtual void permute(const std::vector<int>& _new_index)
+  {
+    load();
+    vector_type permuted(data_.size());
+    for (size_t i = 0; i < _new_index.size(); ++i)
+#if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
+      permuted[_new_index[i]] = std::move(data_[i]);
+#else
+      permuted[_new_index[i]] = data_[i];
+#endif
+    data_.swap(permuted);
+  }
 
 public:
 
@@ -150,6 +174,7 @@ public:
 
   virtual size_t store( std::ostream& _ostr, bool _swap ) const
   {
+    load();
     if ( IO::is_streamable<vector_type>() )
       return IO::store(_ostr, data_, _swap );
     size_t bytes = 0;
@@ -173,6 +198,7 @@ public: // data access interface
   /// Get pointer to array (does not work for T==bool)
   const T* data() const {
 
+    load();
     if( data_.empty() )
       return 0;
 
@@ -181,11 +207,13 @@ public: // data access interface
 
   /// Get reference to property vector (be careful, improper usage, e.g. resizing, may crash OpenMesh!!!)
   vector_type& data_vector() {
+    load();
     return data_;
   }
 
   /// Const access to property vector
   const vector_type& data_vector() const {
+    load();
     return data_;
   }
 
@@ -249,6 +277,20 @@ public: // inherited from BaseProperty
   { bool t(data_[_i0]); data_[_i0]=data_[_i1]; data_[_i1]=t; }
   virtual void copy(size_t _i0, size_t _i1)
   { data_[_i1] = data_[_i0]; }
+  virtual void compact(const std::vector<int>& _new_index, size_t _n)
+  {
+    for (size_t i = 0; i < _new_index.size(); ++i)
+      if (_new_index[i] != -1 && size_t(_new_index[i]) != i)
+        data_[_new_index[i]] = bool(data_[i]);
+    data_.resize(_n);
+  }
+  virtual void permute(const std::vector<int>& _new_index)
+  {
+    vector_type permuted(data_.size());
+    for (size_t i = 0; i < _new_index.size(); ++i)
+      permuted[_new_index[i]] = bool(data_[i]);
+    data_.swap(permuted);
+  }
 
 public:
 
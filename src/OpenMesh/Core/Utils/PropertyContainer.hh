@@ -128,6 +128,7 @@ public:
 #endif
          )
       {
+        (*p_it)->load();
         return BasePropHandleT<T>(idx);
       }
     }
@@ -141,6 +142,7 @@ public:
     {
       if (*p_it != NULL && (*p_it)->name() == _name) //skip deleted properties
       {
+        (*p_it)->load();
         return *p_it;
       }
     }
@@ -212,6 +214,28 @@ public:
     std::for_each(properties_.begin(), properties_.end(), Swap(_i0, _i1));
   }
 
+  /// Compact all properties, see BaseProperty::compact(). The properties are processed in parallel.
+  void compact(const std::vector<int>& _new_index, size_t _n) const {
+    const int n_props = int(properties_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(_new_index.size() > 10000)
+#endif
+    for (int i = 0; i < n_props; ++i)
+      if (properties_[i])
+        properties_[i]->compact(_new_index, _n);
+  }
+
+  /// Permute all properties, see BaseProperty::permute(). The properties are processed in parallel.
+  void permute(const std::vector<int>& _new_index) const {
+    const int n_props = int(properties_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if(_new_index.size() > 10000)
+#endif
+    for (int i = 0; i < n_props; ++i)
+      if (properties_[i])
+        properties_[i]->permute(_new_index);
+  }
+
 
 
 protected: // generic add/get
@@ -232,6 +256,7 @@ protected: // generic add/get
     assert( properties_[_idx] != NULL);
     BaseProperty *p = properties_[_idx];
     assert( p != NULL );
+    p->load();
     return *p;
   }
 
@@ -241,6 +266,7 @@ protected: // generic add/get
     assert( properties_[_idx] != NULL);
     BaseProperty *p = properties_[_idx];
     assert( p != NULL );
+    p->load();
     return *p;
   }
 
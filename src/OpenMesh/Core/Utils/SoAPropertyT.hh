@@ -0,0 +1,289 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_SOAPROPERTYT_HH
+#define OPENMESH_SOAPROPERTYT_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/BaseProperty.hh>
+#include <OpenMesh/Core/Utils/AlignedAllocatorT.hh>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <cassert>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class SoAPropertyT SoAPropertyT.hh <OpenMesh/Core/Utils/SoAPropertyT.hh>
+
+    \brief Property class for vector types stored as structure of arrays.
+
+    Instead of one std::vector<T>, the property keeps one array per
+    vector component (e.g. all x coordinates, then all y coordinates,
+    ...). Each array is aligned to a 64 byte boundary, so loops over a
+    component array can be vectorized by the compiler.
+
+    Elements are returned by value. The non-const operator[] returns a
+    proxy that can be assigned to, like std::vector<bool>.
+
+    T has to be a vector type supported by vector_traits, e.g. an
+    OpenMesh::VectorT. The binary format of store()/restore() is the
+    same as the one of PropertyT<T>.
+
+    \see AttribKernelT, Attributes::SoA
+*/
+template <class T>
+class SoAPropertyT : public BaseProperty
+{
+public:
+
+  typedef T                                                Value;
+  typedef T                                                value_type;
+  typedef typename vector_traits<T>::value_type            Scalar;
+  typedef std::vector<Scalar, AlignedAllocatorT<Scalar> >  component_vector_type;
+  typedef const T                                          const_reference;
+
+  /// Number of component arrays
+  enum { n_components = vector_traits<T>::size_ };
+
+#ifndef DOXY_IGNORE_THIS
+  /// Proxy returned by the non-const operator[]
+  class reference
+  {
+  public:
+    reference(SoAPropertyT& _prop, int _idx) : prop_(_prop), idx_(_idx) {}
+
+    operator T() const { return prop_.value(idx_); }
+
+    reference& operator=(const T& _v)
+    { prop_.set_value(idx_, _v); return *this; }
+
+    reference& operator=(const reference& _r)
+    { prop_.set_value(idx_, T(_r)); return *this; }
+
+  private:
+    SoAPropertyT& prop_;
+    int           idx_;
+  };
+#endif
+
+public:
+
+  /// Default constructor
+  SoAPropertyT(const std::string& _name = "<unknown>")
+  : BaseProperty(_name)
+  {}
+
+  /// Copy constructor
+  SoAPropertyT(const SoAPropertyT & _rhs)
+  : BaseProperty( _rhs )
+  {
+    for (int c=0; c<n_components; ++c)
+      data_[c] = _rhs.data_[c];
+  }
+
+public: // inherited from BaseProperty
+
+  virtual void reserve(size_t _n)
+  { load(); for (int c=0; c<n_components; ++c) data_[c].reserve(_n); }
+
+  virtual void resize(size_t _n)
+  { load(); for (int c=0; c<n_components; ++c) data_[c].resize(_n); }
+
+  virtual void clear()
+  {
+    set_loader(0);
+    for (int c=0; c<n_components; ++c)
+      component_vector_type().swap(data_[c]);
+  }
+
+  virtual void push_back()
+  { load(); for (int c=0; c<n_components; ++c) data_[c].push_back(Scalar()); }
+
+  virtual void swap(size_t _i0, size_t _i1)
+  { load(); for (int c=0; c<n_components; ++c) std::swap(data_[c][_i0], data_[c][_i1]); }
+
+  virtual void copy(size_t _i0, size_t _i1)
+  { load(); for (int c=0; c<n_components; ++c) data_[c][_i1] = data_[c][_i0]; }
+
+  virtual void compact(const std::vector<int>& _new_index, size_t _n)
+  {
+    load();
+    for (int c=0; c<n_components; ++c)
+    {
+      component_vector_type& d = data_[c];
+      for (size_t i = 0; i < _new_index.size(); ++i)
+        if (_new_index[i] != -1 && size_t(_new_index[i]) != i)
+          d[_new_index[i]] = d[i];
+      d.resize(_n);
+    }
+  }
+
+  virtual void permute(const std::vector<int>& _new_index)
+  {
+    load();
+    for (int c=0; c<n_components; ++c)
+    {
+      component_vector_type permuted(data_[c].size());
+      for (size_t i = 0; i < _new_index.size(); ++i)
+        permuted[_new_index[i]] = data_[c][i];
+      data_[c].swap(permuted);
+    }
+  }
+
+public:
+
+  virtual void set_persistent( bool _yn )
+  { check_and_set_persistent<T>( _yn ); }
+
+  virtual size_t       n_elements()   const { return data_[0].size(); }
+  virtual size_t       element_size() const { return IO::size_of<T>(); }
+
+  virtual size_t size_of(void) const
+  { return this->BaseProperty::size_of(n_elements()); }
+
+  virtual size_t size_of(size_t _n_elem) const
+  { return this->BaseProperty::size_of(_n_elem); }
+
+  virtual size_t store( std::ostream& _ostr, bool _swap ) const
+  {
+    load();
+    size_t bytes = 0;
+    for (size_t i=0; i<n_elements(); ++i)
+      bytes += IO::store( _ostr, value(int(i)), _swap );
+    return bytes;
+  }
+
+  virtual size_t restore( std::istream& _istr, bool _swap )
+  {
+    size_t bytes = 0;
+    for (size_t i=0; i<n_elements(); ++i)
+    {
+      T v;
+      bytes += IO::restore( _istr, v, _swap );
+      set_value(int(i), v);
+    }
+    return bytes;
+  }
+
+public: // data access interface
+
+  /** Pointer to the aligned array of the \c _c-th component of all
+      elements. The array holds n_elements() values. The pointer is
+      invalidated if the property is resized.
+  */
+  Scalar* component(int _c)
+  {
+    load();
+    assert( _c >= 0 && _c < n_components );
+    return data_[_c].empty() ? 0 : &data_[_c][0];
+  }
+
+  /// Const version of component()
+  const Scalar* component(int _c) const
+  {
+    load();
+    assert( _c >= 0 && _c < n_components );
+    return data_[_c].empty() ? 0 : &data_[_c][0];
+  }
+
+  /// Get the i'th element
+  T value(int _idx) const
+  {
+    assert( size_t(_idx) < n_elements() );
+    T v;
+    for (int c=0; c<n_components; ++c)
+      v[c] = data_[c][_idx];
+    return v;
+  }
+
+  /// Set the i'th element
+  void set_value(int _idx, const T& _v)
+  {
+    assert( size_t(_idx) < n_elements() );
+    for (int c=0; c<n_components; ++c)
+      data_[c][_idx] = _v[c];
+  }
+
+  /// Access the i'th element. No range check is performed!
+  reference operator[](int _idx)
+  { return reference(*this, _idx); }
+
+  /// Const access to the i'th element. No range check is performed!
+  const_reference operator[](int _idx) const
+  { return value(_idx); }
+
+  /// Make a copy of self.
+  SoAPropertyT<T>* clone() const
+  { return new SoAPropertyT<T>( *this ); }
+
+
+private:
+
+  component_vector_type data_[n_components];
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_SOAPROPERTYT_HH defined
+//=============================================================================
@@ -0,0 +1,353 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//=============================================================================
+//
+//  CLASS VertexWelderT - IMPLEMENTATION
+//
+//=============================================================================
+
+
+#define OPENMESH_VERTEXWELDERT_C
+
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Core/Utils/VertexWelderT.hh>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <cstring>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+
+
+//== IMPLEMENTATION ==========================================================
+
+
+template <class Point>
+typename VertexWelderT<Point>::Cell
+VertexWelderT<Point>::
+cell(const Point& _p) const
+{
+  Cell result;
+
+  for (int k = 0; k < 3; ++k)
+  {
+    if (eps_ > Scalar(0))
+    {
+      // far away or invalid coordinates share the border cells
+      double c = std::floor(double(_p[k]) / double(eps_));
+      if (!(c > -9.0e18))  c = -9.0e18;
+      if (!(c <  9.0e18))  c =  9.0e18;
+      result.c[k] = (long long)(c);
+    }
+    else
+    {
+      // the cell is the bit pattern of the coordinate, -0 -> +0
+      const Scalar s = _p[k] + Scalar(0);
+      result.c[k] = 0;
+      memcpy(&result.c[k], &s, sizeof(Scalar) < sizeof(long long) ? sizeof(Scalar) : sizeof(long long));
+    }
+  }
+
+  return result;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Point>
+bool
+VertexWelderT<Point>::
+close(const Point& _p0, const Point& _p1) const
+{
+  for (int k = 0; k < 3; ++k)
+    if (!(std::fabs(double(_p0[k]) - double(_p1[k])) <= double(eps_)))
+      return false;
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Point>
+size_t
+VertexWelderT<Point>::
+hash(const Cell& _cell)
+{
+  unsigned long long h = (unsigned long long)(_cell.c[0]) * 73856093ull
+                       ^ (unsigned long long)(_cell.c[1]) * 19349663ull
+                       ^ (unsigned long long)(_cell.c[2]) * 83492791ull;
+  // final mixing (murmur3)
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return size_t(h);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Point>
+size_t
+VertexWelderT<Point>::
+weld(const Point* _points, size_t _n, std::vector<int>& _map,
+     unsigned int _n_threads) const
+{
+  assert(vector_traits<Point>::size() == 3);
+
+  if (_n > size_t(INT_MAX))
+  {
+    omerr() << "VertexWelderT: Too many points\n";
+    _map.clear();
+    return 0;
+  }
+
+  _map.resize(_n);
+  if (_n == 0)
+    return 0;
+
+  const int  n        = int(_n);
+  const bool exact    = !(eps_ > Scalar(0));
+  // threads only pay off for larger arrays
+  const bool parallel = _n >= 16384;
+
+#ifdef _OPENMP
+  const int n_threads = _n_threads ? int(_n_threads) : omp_get_max_threads();
+#else
+  (void)_n_threads;
+#endif
+
+  // -------------------- hash table of the occupied cells
+
+  // Open addressing, each slot holds the first point of a cell. The points
+  // of a cell are linked in increasing order through next. The cells are
+  // recomputed from the points instead of being stored.
+  size_t capacity = 16;
+  while (capacity < 2 * _n)
+    capacity *= 2;
+  const size_t mask = capacity - 1;
+
+  std::vector<int> table(capacity, -1);
+  std::vector<int> next(_n, -1);
+
+  for (int i = n - 1; i >= 0; --i)
+  {
+    const Cell c = cell(_points[i]);
+
+    size_t s = hash(c) & mask;
+    while (table[s] != -1 && !(cell(_points[table[s]]) == c))
+      s = (s + 1) & mask;
+
+    next[i]  = table[s];
+    table[s] = i;
+  }
+
+  // -------------------- first earlier point that matches each point
+
+  // stored in _map for now
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads) if(parallel)
+#endif
+  for (int i = 0; i < n; ++i)
+  {
+    const Cell ci = cell(_points[i]);
+    int match = i;
+
+    if (exact)
+    {
+      // all points of the cell are equal, the first one is the match
+      size_t s = hash(ci) & mask;
+      while (!(cell(_points[table[s]]) == ci))
+        s = (s + 1) & mask;
+      match = table[s];
+    }
+    else
+    {
+      Cell c;
+      for (int dx = -1; dx <= 1; ++dx)
+        for (int dy = -1; dy <= 1; ++dy)
+          for (int dz = -1; dz <= 1; ++dz)
+          {
+            c.c[0] = ci.c[0] + dx;
+            c.c[1] = ci.c[1] + dy;
+            c.c[2] = ci.c[2] + dz;
+
+            size_t s = hash(c) & mask;
+            while (table[s] != -1 && !(cell(_points[table[s]]) == c))
+              s = (s + 1) & mask;
+
+            // the first close point of the cell is the earliest one
+            for (int j = table[s]; j != -1 && j < match; j = next[j])
+              if (close(_points[i], _points[j]))
+              {
+                match = j;
+                break;
+              }
+          }
+    }
+
+    _map[i] = match;
+  }
+
+  // -------------------- number the vertices in order
+
+  int n_vertices = 0;
+  for (int i = 0; i < n; ++i)
+    _map[i] = (_map[i] == i) ? n_vertices++ : _map[_map[i]];
+
+  return size_t(n_vertices);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Point>
+int
+VertexWelderT<Point>::
+add(const Point& _p)
+{
+  assert(vector_traits<Point>::size() == 3);
+
+  const Cell c = cell(_p);
+
+  if (!table_.empty())
+  {
+    const size_t mask = table_.size() - 1;
+
+    if (!(eps_ > Scalar(0)))
+    {
+      // one vertex per cell, its point is equal to _p
+      for (size_t s = hash(c) & mask; table_[s] != -1; s = (s + 1) & mask)
+        if (cell(vertices_[table_[s]]) == c)
+          return table_[s];
+    }
+    else
+    {
+      // the earliest close vertex of the neighbouring cells
+      int  match = -1;
+      Cell n;
+      for (int dx = -1; dx <= 1; ++dx)
+        for (int dy = -1; dy <= 1; ++dy)
+          for (int dz = -1; dz <= 1; ++dz)
+          {
+            n.c[0] = c.c[0] + dx;
+            n.c[1] = c.c[1] + dy;
+            n.c[2] = c.c[2] + dz;
+
+            for (size_t s = hash(n) & mask; table_[s] != -1; s = (s + 1) & mask)
+              if ((match == -1 || table_[s] < match) && close(_p, vertices_[table_[s]]))
+                match = table_[s];
+          }
+
+      if (match != -1)
+        return match;
+    }
+  }
+
+  // -------------------- new vertex
+
+  if (vertices_.size() >= size_t(INT_MAX))
+  {
+    omerr() << "VertexWelderT: Too many vertices\n";
+    return -1;
+  }
+
+  // keep the table at most half full
+  if (2 * (vertices_.size() + 1) > table_.size())
+  {
+    table_.assign(table_.empty() ? 16 : 2 * table_.size(), -1);
+    for (size_t v = 0; v < vertices_.size(); ++v)
+      insert(cell(vertices_[v]), int(v));
+  }
+
+  vertices_.push_back(_p);
+  insert(c, int(vertices_.size() - 1));
+
+  return int(vertices_.size() - 1);
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Point>
+void
+VertexWelderT<Point>::
+insert(const Cell& _cell, int _v)
+{
+  const size_t mask = table_.size() - 1;
+
+  size_t s = hash(_cell) & mask;
+  while (table_[s] != -1)
+    s = (s + 1) & mask;
+
+  table_[s] = _v;
+}
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
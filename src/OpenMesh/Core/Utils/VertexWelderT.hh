@@ -0,0 +1,201 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision$                                                         *
+ *   $Date$                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+//=============================================================================
+//
+//  CLASS VertexWelderT
+//
+//=============================================================================
+
+
+#ifndef OPENMESH_VERTEXWELDERT_HH
+#define OPENMESH_VERTEXWELDERT_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/Utils/vector_traits.hh>
+#include <vector>
+#include <cstddef>
+
+
+//== NAMESPACES ===============================================================
+
+namespace OpenMesh {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class VertexWelderT VertexWelderT.hh <OpenMesh/Core/Utils/VertexWelderT.hh>
+
+    \brief Merges coincident points with a spatial hash grid.
+
+    weld() maps every point of an array to a welded vertex. The vertices
+    are numbered in the order of their first point, so the points with
+    a new vertex number are the ones to keep.
+
+    With an epsilon of 0 (exact mode) points are merged if their
+    coordinates are equal (-0 and +0 count as equal). With a positive
+    epsilon a point is merged with the first earlier point whose
+    coordinates all differ by at most epsilon, and with the vertex of that
+    point. Chains of close points can therefore end up in one vertex
+    although their ends are further apart.
+
+    The points are hashed into grid cells (one per distinct point in
+    exact mode, cubes with edge length epsilon otherwise), so welding takes
+    linear time. For large arrays the matches are computed in parallel if
+    OpenMP is available. The result does not depend on the number of
+    threads.
+
+    add() welds the points one at a time, e.g. while a file is read. Only
+    the first point of every vertex is kept, so the memory needed depends
+    on the number of vertices instead of the number of points. A point is
+    compared with these first points only, so in epsilon mode no chains
+    are formed. In exact mode the result is the same as with weld().
+
+    Usage on a loaded mesh:
+    \code
+    OpenMesh::VertexWelderT<MyMesh::Point> welder(1e-5f);
+    std::vector<int> vertex_of_point;
+    size_t n = welder.weld(mesh.points(), mesh.n_vertices(), vertex_of_point);
+    \endcode
+
+    Point has to be a 3D vector type supported by vector_traits.
+
+    \see OpenMesh::IO::_STLReader_
+*/
+template <class Point>
+class VertexWelderT
+{
+public:
+
+  typedef typename vector_traits<Point>::value_type Scalar;
+
+  /// Construct a welder, an epsilon of 0 selects the exact mode
+  explicit VertexWelderT(Scalar _eps = Scalar(0)) : eps_(_eps) {}
+
+  /// Set the distance up to which coordinates are considered to be equal
+  void set_epsilon(Scalar _eps) { eps_ = _eps; }
+
+  /// Returns the distance up to which coordinates are considered to be equal
+  Scalar epsilon() const { return eps_; }
+
+  /** Weld the _n points at _points.
+   *
+   * @param _points     The points
+   * @param _n          Number of points
+   * @param _map        Is resized to _n and receives the vertex number of each point
+   * @param _n_threads  Number of threads to use, 0 selects the OpenMP default
+   * @return            The number of vertices
+   */
+  size_t weld(const Point* _points, size_t _n, std::vector<int>& _map,
+              unsigned int _n_threads = 0) const;
+
+  /// Weld all points of _points, see above
+  size_t weld(const std::vector<Point>& _points, std::vector<int>& _map,
+              unsigned int _n_threads = 0) const
+  {
+    return weld(_points.empty() ? 0 : &_points[0], _points.size(), _map, _n_threads);
+  }
+
+  /** Weld _p with the vertices created by earlier calls.
+   *
+   * @param _p  The point
+   * @return    The vertex number of _p, n_vertices()-1 if it is a new
+   *            vertex, -1 if there are too many vertices
+   */
+  int add(const Point& _p);
+
+  /// Number of vertices created by add()
+  size_t n_vertices() const { return vertices_.size(); }
+
+  /// Forget the vertices created by add()
+  void clear() { vertices_.clear(); table_.clear(); }
+
+private:
+
+  /// Integer coordinates of a grid cell
+  struct Cell
+  {
+    long long c[3];
+
+    bool operator==(const Cell& _other) const
+    { return c[0] == _other.c[0] && c[1] == _other.c[1] && c[2] == _other.c[2]; }
+  };
+
+  Cell   cell(const Point& _p) const;
+  bool   close(const Point& _p0, const Point& _p1) const;
+  static size_t hash(const Cell& _cell);
+  void   insert(const Cell& _cell, int _v);
+
+private:
+
+  Scalar eps_;
+
+  /// First point of every vertex created by add()
+  std::vector<Point> vertices_;
+
+  /// Open addressing table of the vertices by cell, -1 marks free slots
+  std::vector<int>   table_;
+};
+
+
+//=============================================================================
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_VERTEXWELDERT_C)
+#  define OPENMESH_VERTEXWELDERT_TEMPLATES
+#  include "VertexWelderT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_VERTEXWELDERT_HH defined
+//=============================================================================
@@ -210,6 +210,16 @@ protected:
     return true;
   }
 
+  /// Returns true if all active modules are thread safe, see ModBaseT::is_thread_safe()
+  bool is_thread_safe() const
+  {
+    typename ModuleList::const_iterator m_it, m_end = bmodules_.end();
+    for (m_it = bmodules_.begin(); m_it != m_end; ++m_it)
+      if (!(*m_it)->is_thread_safe())
+        return false;
+    return cmodule_ == NULL || cmodule_->is_thread_safe();
+  }
+
   /// Reset the initialized flag, and clear the bmodules_ and cmodule_
   void set_uninitialized() {
     initialized_ = false;
@@ -89,7 +89,6 @@ DecimaterT<Mesh>::DecimaterT(Mesh& _mesh) :
   // private vertex properties
   mesh_.add_property(collapse_target_);
   mesh_.add_property(priority_);
-  mesh_.add_property(heap_position_);
 }
 
 //-----------------------------------------------------------------------------
@@ -100,15 +99,13 @@ DecimaterT<Mesh>::~DecimaterT() {
   // private vertex properties
   mesh_.remove_property(collapse_target_);
   mesh_.remove_property(priority_);
-  mesh_.remove_property(heap_position_);
 
 }
 
 //-----------------------------------------------------------------------------
 
 template<class Mesh>
-void DecimaterT<Mesh>::heap_vertex(VertexHandle _vh) {
-  //   std::clog << "heap_vertex: " << _vh << std::endl;
+bool DecimaterT<Mesh>::update_collapse_target(VertexHandle _vh) {
 
   float prio, best_prio(FLT_MAX);
   typename Mesh::HalfedgeHandle heh, collapse_target;
@@ -128,27 +125,57 @@ void DecimaterT<Mesh>::heap_vertex(VertexHandle _vh) {
     }
   }
 
-  // target found -> put vertex on heap
-  if (collapse_target.is_valid()) {
-    //     std::clog << "  added|updated" << std::endl;
-    mesh_.property(collapse_target_, _vh) = collapse_target;
-    mesh_.property(priority_, _vh)        = best_prio;
+  mesh_.property(collapse_target_, _vh) = collapse_target;
+  mesh_.property(priority_, _vh) = collapse_target.is_valid() ? best_prio : -1;
 
-    if (heap_->is_stored(_vh))
-      heap_->update(_vh);
-    else
-      heap_->insert(_vh);
+  return collapse_target.is_valid();
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void DecimaterT<Mesh>::heap_vertices(std::vector<VertexHandle>& _vhs) {
+
+  // vertices without a valid collapse are removed, the others are moved
+  // to the front and inserted or updated at once
+  typename std::vector<VertexHandle>::iterator v_it, keep(_vhs.begin());
+  for (v_it = _vhs.begin(); v_it != _vhs.end(); ++v_it) {
+    assert(!mesh_.status(*v_it).deleted());
+    if (update_collapse_target(*v_it))
+      *keep++ = *v_it;
+    else if (heap_->is_stored(*v_it))
+      heap_->remove(*v_it);
   }
 
-  // not valid -> remove from heap
-  else {
-    //     std::clog << "  n/a|removed" << std::endl;
-    if (heap_->is_stored(_vh))
-      heap_->remove(_vh);
+  heap_->update(_vhs.begin(), keep);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void DecimaterT<Mesh>::init_heap() {
+
+  HeapInterface HI(mesh_, priority_);
 
-    mesh_.property(collapse_target_, _vh) = collapse_target;
-    mesh_.property(priority_, _vh) = -1;
+#if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
+  heap_ = std::unique_ptr<DeciHeap>(new DeciHeap(HI));
+#else
+  heap_ = std::auto_ptr<DeciHeap>(new DeciHeap(HI));
+#endif
+
+  heap_->reserve(mesh_.n_vertices());
+
+  // evaluate all vertices first and build the heap in one go
+  std::vector<VertexHandle> candidates;
+  candidates.reserve(mesh_.n_vertices());
+
+  typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
+  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it) {
+    if (!mesh_.status(*v_it).deleted() && update_collapse_target(*v_it))
+      candidates.push_back(*v_it);
   }
+
+  heap_->build(candidates.begin(), candidates.end());
 }
 
 //-----------------------------------------------------------------------------
@@ -158,7 +185,6 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses) {
   if (!this->is_initialized())
     return 0;
 
-  typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
   typename Mesh::VertexHandle vp;
   typename Mesh::HalfedgeHandle v0v1;
   typename Mesh::VertexVertexIter vv_it;
@@ -166,32 +192,15 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses) {
   unsigned int n_collapses(0);
 
   typedef std::vector<typename Mesh::VertexHandle> Support;
-  typedef typename Support::iterator SupportIterator;
 
   Support support(15);
-  SupportIterator s_it, s_end;
 
   // check _n_collapses
   if (!_n_collapses)
     _n_collapses = mesh_.n_vertices();
 
   // initialize heap
-  HeapInterface HI(mesh_, priority_, heap_position_);
-
-#if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
-  heap_ = std::unique_ptr<DeciHeap>(new DeciHeap(HI));
-#else
-  heap_ = std::auto_ptr<DeciHeap>(new DeciHeap(HI));
-#endif
-
-
-  heap_->reserve(mesh_.n_vertices());
-
-  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it) {
-    heap_->reset_heap_position(*v_it);
-    if (!mesh_.status(*v_it).deleted())
-      heap_vertex(*v_it);
-  }
+  init_heap();
 
   const bool update_normals = mesh_.has_face_normals();
 
@@ -232,10 +241,7 @@ size_t DecimaterT<Mesh>::decimate(size_t _n_collapses) {
     this->postprocess_collapse(ci);
 
     // update heap (former one ring of decimated vertex)
-    for (s_it = support.begin(), s_end = support.end(); s_it != s_end; ++s_it) {
-      assert(!mesh_.status(*s_it).deleted());
-      heap_vertex(*s_it);
-    }
+    heap_vertices(support);
 
     // notify observer and stop if the observer requests it
     if (!this->notify_observer(n_collapses))
@@ -262,7 +268,6 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
   if (_nv >= mesh_.n_vertices() || _nf >= mesh_.n_faces())
     return 0;
 
-  typename Mesh::VertexIter v_it, v_end(mesh_.vertices_end());
   typename Mesh::VertexHandle vp;
   typename Mesh::HalfedgeHandle v0v1;
   typename Mesh::VertexVertexIter vv_it;
@@ -272,25 +277,11 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
   unsigned int n_collapses = 0;
 
   typedef std::vector<typename Mesh::VertexHandle> Support;
-  typedef typename Support::iterator SupportIterator;
 
   Support support(15);
-  SupportIterator s_it, s_end;
 
   // initialize heap
-  HeapInterface HI(mesh_, priority_, heap_position_);
-  #if __cplusplus > 199711L || defined( __GXX_EXPERIMENTAL_CXX0X__ )
-    heap_ = std::unique_ptr<DeciHeap>(new DeciHeap(HI));
-  #else
-    heap_ = std::auto_ptr<DeciHeap>(new DeciHeap(HI));
-  #endif
-  heap_->reserve(mesh_.n_vertices());
-
-  for (v_it = mesh_.vertices_begin(); v_it != v_end; ++v_it) {
-    heap_->reset_heap_position(*v_it);
-    if (!mesh_.status(*v_it).deleted())
-      heap_vertex(*v_it);
-  }
+  init_heap();
 
   const bool update_normals = mesh_.has_face_normals();
 
@@ -341,10 +332,7 @@ size_t DecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
     this->postprocess_collapse(ci);
 
     // update heap (former one ring of decimated vertex)
-    for (s_it = support.begin(), s_end = support.end(); s_it != s_end; ++s_it) {
-      assert(!mesh_.status(*s_it).deleted());
-      heap_vertex(*s_it);
-    }
+    heap_vertices(support);
 
     const size_t n_faces_removed = mesh_.n_faces() - nf;
     // notify observer and stop if the observer requests it
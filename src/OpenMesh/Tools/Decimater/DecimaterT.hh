@@ -65,6 +65,7 @@
 
 #include <OpenMesh/Core/Utils/Property.hh>
 #include <OpenMesh/Tools/Utils/HeapT.hh>
+#include <OpenMesh/Tools/Utils/IndexedHeapT.hh>
 #include <OpenMesh/Tools/Decimater/BaseDecimaterT.hh>
 
 //== NAMESPACE ================================================================
@@ -130,9 +131,8 @@ public:
   public:
 
     HeapInterface(Mesh&               _mesh,
-      VPropHandleT<float> _prio,
-      VPropHandleT<int>   _pos)
-      : mesh_(_mesh), prio_(_prio), pos_(_pos)
+      VPropHandleT<float> _prio)
+      : mesh_(_mesh), prio_(_prio)
     { }
 
     inline bool
@@ -143,28 +143,28 @@ public:
     greater( VertexHandle _vh0, VertexHandle _vh1 )
     { return mesh_.property(prio_, _vh0) > mesh_.property(prio_, _vh1); }
 
-    inline int
-    get_heap_position(VertexHandle _vh)
-    { return mesh_.property(pos_, _vh); }
-
-    inline void
-    set_heap_position(VertexHandle _vh, int _pos)
-    { mesh_.property(pos_, _vh) = _pos; }
-
+    inline float
+    get_key( VertexHandle _vh )
+    { return mesh_.property(prio_, _vh); }
 
   private:
     Mesh&                mesh_;
     VPropHandleT<float>  prio_;
-    VPropHandleT<int>    pos_;
   };
 
-  typedef Utils::HeapT<VertexHandle, HeapInterface>  DeciHeap;
+  typedef Utils::IndexedHeapT<VertexHandle, HeapInterface>  DeciHeap;
 
 
 private: //---------------------------------------------------- private methods
 
-  /// Insert vertex in heap
-  void heap_vertex(VertexHandle _vh);
+  /// Insert, update or remove the vertices _vhs in the heap, reorders _vhs
+  void heap_vertices(std::vector<VertexHandle>& _vhs);
+
+  /// Find the best collapse of _vh, returns false if there is none
+  bool update_collapse_target(VertexHandle _vh);
+
+  /// Create the heap and fill it with all vertices that can be collapsed
+  void init_heap();
 
 private: //------------------------------------------------------- private data
 
@@ -182,7 +182,6 @@ private: //------------------------------------------------------- private data
   // vertex properties
   VPropHandleT<HalfedgeHandle>  collapse_target_;
   VPropHandleT<float>           priority_;
-  VPropHandleT<int>             heap_position_;
 
 };
 
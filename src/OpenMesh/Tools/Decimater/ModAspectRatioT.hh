@@ -99,6 +99,7 @@ class ModAspectRatioT: public ModBaseT<MeshT> {
         Base(_mesh, _is_binary), mesh_(Base::mesh()), min_aspect_(
             1.f / _min_aspect) {
       mesh_.add_property(aspect_);
+      Base::set_thread_safe(true);
     }
 
     /// destructor
@@ -210,7 +210,8 @@ protected:
   /// Default constructor
   /// \see \ref decimater_docu
   ModBaseT(MeshT& _mesh, bool _is_binary)
-    : error_tolerance_factor_(1.0), mesh_(_mesh), is_binary_(_is_binary) {}
+    : error_tolerance_factor_(1.0), mesh_(_mesh), is_binary_(_is_binary),
+      is_thread_safe_(false) {}
 
 public:
 
@@ -227,6 +228,11 @@ public:
   /// Set whether module is binary or not.
   void set_binary(bool _b)   { is_binary_ = _b; }
 
+  /** Returns true if the module may be used by several threads at once,
+      see set_thread_safe() and ParallelDecimaterT.
+   */
+  bool is_thread_safe(void) const { return is_thread_safe_; }
+
 
 public: // common interface
 
@@ -284,6 +290,14 @@ protected:
   // current percentage of the original constraint
   double error_tolerance_factor_;
 
+  /** Declare the module thread safe. Then collapse_priority() must
+      not change the mesh or the module, and preprocess_collapse() and
+      postprocess_collapse() may only change the mesh data of v0, v1 and
+      their one-rings. ParallelDecimaterT uses a single thread as long
+      as one of its modules is not thread safe.
+   */
+  void set_thread_safe(bool _b) { is_thread_safe_ = _b; }
+
 private:
 
   // hide copy constructor & assignemnt
@@ -293,6 +307,8 @@ private:
   MeshT& mesh_;
 
   bool is_binary_;
+
+  bool is_thread_safe_;
 };
 
 
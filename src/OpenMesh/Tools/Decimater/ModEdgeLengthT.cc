@@ -72,6 +72,7 @@ ModEdgeLengthT<MeshT>::ModEdgeLengthT(MeshT &_mesh, float _edge_length,
     bool _is_binary) :
     Base(_mesh, _is_binary), mesh_(Base::mesh()) {
   set_edge_length(_edge_length);
+  Base::set_thread_safe(true);
 }
 
 //-----------------------------------------------------------------------------
@@ -81,6 +81,7 @@ class ModIndependentSetsT: public ModBaseT<MeshT> {
     /// Constructor
     ModIndependentSetsT(MeshT &_mesh) :
         Base(_mesh, true) {
+      Base::set_thread_safe(true);
     }
 
     /// override
@@ -98,6 +98,7 @@ public:
   {
     unset_max_err();
     Base::mesh().add_property( quadrics_ );
+    Base::set_thread_safe(true);
   }
 
 
@@ -105,7 +105,7 @@ class ModRoundnessT : public ModBaseT<MeshT>
   ModRoundnessT( MeshT &_dec ) :
     Base(_dec, false),
     min_r_(-1.0)
-  { }
+  { Base::set_thread_safe(true); }
 
   /// Destructor
   ~ModRoundnessT() { }
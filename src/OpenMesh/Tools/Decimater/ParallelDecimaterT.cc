@@ -0,0 +1,449 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+ \*===========================================================================*/
+
+
+/** \file ParallelDecimaterT.cc
+ */
+
+//=============================================================================
+//
+//  CLASS ParallelDecimaterT - IMPLEMENTATION
+//
+//=============================================================================
+#define OPENMESH_PARALLEL_DECIMATER_DECIMATERT_CC
+
+//== INCLUDES =================================================================
+
+#include <OpenMesh/Tools/Decimater/ParallelDecimaterT.hh>
+
+#include <vector>
+#include <algorithm>
+#if defined(OM_CC_MIPS)
+#  include <float.h>
+#else
+#  include <cfloat>
+#endif
+
+#ifdef _OPENMP
+# include <omp.h>
+#endif
+
+//== NAMESPACE ===============================================================
+
+namespace OpenMesh {
+namespace Decimater {
+
+//== IMPLEMENTATION ==========================================================
+
+template<class Mesh>
+ParallelDecimaterT<Mesh>::ParallelDecimaterT(Mesh& _mesh) :
+  BaseDecimaterT<Mesh>(_mesh),
+    mesh_(_mesh), n_threads_(0), round_(0) {
+
+  // private vertex properties
+  mesh_.add_property(collapse_target_);
+  mesh_.add_property(priority_);
+
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+ParallelDecimaterT<Mesh>::~ParallelDecimaterT() {
+
+  // private vertex properties
+  mesh_.remove_property(collapse_target_);
+  mesh_.remove_property(priority_);
+
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+int ParallelDecimaterT<Mesh>::n_threads() const {
+#ifdef _OPENMP
+  if (!this->is_thread_safe()) {
+    if (n_threads_ != 1)
+      omlog() << "[ParallelDecimater] : not all modules are thread safe, using a single thread\n";
+    return 1;
+  }
+  return n_threads_ ? int(n_threads_) : omp_get_max_threads();
+#else
+  return 1;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool ParallelDecimaterT<Mesh>::is_collapse_legal_concurrent(const CollapseInfo& _ci) const {
+
+  // locked ?
+  if (mesh_.status(_ci.v0).locked())
+    return false;
+
+  // is v0v1, v0 or v1 deleted?
+  if (mesh_.status(mesh_.edge_handle(_ci.v0v1)).deleted()
+      || mesh_.status(_ci.v0).deleted() || mesh_.status(_ci.v1).deleted())
+    return false;
+
+  // are both vlv0 and v1vl boundary edges?
+  if (_ci.vl.is_valid() && mesh_.is_boundary(mesh_.opposite_halfedge_handle(_ci.v0vl))
+      && mesh_.is_boundary(mesh_.opposite_halfedge_handle(_ci.vlv1)))
+    return false;
+
+  // are both v0vr and vrv1 boundary edges?
+  if (_ci.vr.is_valid() && mesh_.is_boundary(mesh_.opposite_halfedge_handle(_ci.vrv0))
+      && mesh_.is_boundary(mesh_.opposite_halfedge_handle(_ci.v1vr)))
+    return false;
+
+  // are vl and vr equal or both invalid?
+  if (_ci.vl == _ci.vr)
+    return false;
+
+  // one ring intersection test, without tagging: the one-ring of v1 is
+  // gathered in a local array, large rings fall back to find_halfedge()
+  const int max_ring = 64;
+  typename Mesh::VertexHandle ring[max_ring];
+  int n_ring = 0;
+
+  typename Mesh::ConstVertexVertexIter vv_it;
+  for (vv_it = mesh_.cvv_iter(_ci.v1); vv_it.is_valid() && n_ring <= max_ring; ++vv_it)
+    if (n_ring < max_ring)
+      ring[n_ring++] = *vv_it;
+    else
+      n_ring = max_ring + 1;
+
+  for (vv_it = mesh_.cvv_iter(_ci.v0); vv_it.is_valid(); ++vv_it) {
+    if (*vv_it == _ci.vl || *vv_it == _ci.vr || *vv_it == _ci.v1)
+      continue;
+    if (n_ring > max_ring) {
+      if (mesh_.find_halfedge(*vv_it, _ci.v1).is_valid())
+        return false;
+    }
+    else if (std::find(ring, ring + n_ring, *vv_it) != ring + n_ring)
+      return false;
+  }
+
+  // edge between two boundary vertices should be a boundary edge
+  if (mesh_.is_boundary(_ci.v0) && mesh_.is_boundary(_ci.v1)
+      && !mesh_.is_boundary(_ci.v0v1) && !mesh_.is_boundary(_ci.v1v0))
+    return false;
+
+  if (_ci.vl.is_valid() && _ci.vr.is_valid()
+      && mesh_.find_halfedge(_ci.vl, _ci.vr).is_valid()
+      && mesh_.valence(_ci.vl) == 3 && mesh_.valence(_ci.vr) == 3) {
+    return false;
+  }
+  //--- feature test ---
+
+  if (mesh_.status(_ci.v0).feature()
+      && !mesh_.status(mesh_.edge_handle(_ci.v0v1)).feature())
+    return false;
+
+  //--- test boundary cases ---
+  if (mesh_.is_boundary(_ci.v0)) {
+
+    // don't collapse a boundary vertex to an inner one
+    if (!mesh_.is_boundary(_ci.v1))
+      return false;
+
+    // only one one ring intersection
+    if (_ci.vl.is_valid() && _ci.vr.is_valid())
+      return false;
+  }
+
+  // there have to be at least 2 incident faces at v0
+  if (mesh_.cw_rotated_halfedge_handle(
+      mesh_.cw_rotated_halfedge_handle(_ci.v0v1)) == _ci.v0v1)
+    return false;
+
+  // collapse passed all tests -> ok
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+void ParallelDecimaterT<Mesh>::evaluate_vertex(typename Mesh::VertexHandle _vh) {
+
+  float prio, best_prio(FLT_MAX);
+  typename Mesh::HalfedgeHandle heh, collapse_target;
+
+  // find best target in one ring
+  if (!mesh_.status(_vh).deleted()) {
+    typename Mesh::VertexOHalfedgeIter voh_it(mesh_, _vh);
+    for (; voh_it.is_valid(); ++voh_it) {
+      heh = *voh_it;
+      CollapseInfo ci(mesh_, heh);
+
+      if (is_collapse_legal_concurrent(ci)) {
+        prio = this->collapse_priority(ci);
+        if (prio >= 0.0 && prio < best_prio) {
+          best_prio = prio;
+          collapse_target = heh;
+        }
+      }
+    }
+  }
+
+  mesh_.property(collapse_target_, _vh) = collapse_target;
+  mesh_.property(priority_, _vh) = collapse_target.is_valid() ? best_prio : -1.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+bool ParallelDecimaterT<Mesh>::claim_region(const CollapseInfo& _ci) {
+
+  // v0 and v1 are part of each other's one-ring
+  typename Mesh::ConstVertexVertexIter vv_it;
+  for (vv_it = mesh_.cvv_iter(_ci.v0); vv_it.is_valid(); ++vv_it)
+    if (claimed_[vv_it->idx()] == round_)
+      return false;
+  for (vv_it = mesh_.cvv_iter(_ci.v1); vv_it.is_valid(); ++vv_it)
+    if (claimed_[vv_it->idx()] == round_)
+      return false;
+
+  for (vv_it = mesh_.cvv_iter(_ci.v0); vv_it.is_valid(); ++vv_it)
+    claimed_[vv_it->idx()] = round_;
+  for (vv_it = mesh_.cvv_iter(_ci.v1); vv_it.is_valid(); ++vv_it)
+    claimed_[vv_it->idx()] = round_;
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t ParallelDecimaterT<Mesh>::decimate(size_t _n_collapses) {
+
+  if (!this->is_initialized())
+    return 0;
+
+  // check _n_collapses
+  if (!_n_collapses)
+    _n_collapses = mesh_.n_vertices();
+
+  return decimate_rounds(_n_collapses, 0, false);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t ParallelDecimaterT<Mesh>::decimate_to_faces(size_t _nv, size_t _nf) {
+
+  if (!this->is_initialized())
+    return 0;
+
+  if (_nv >= mesh_.n_vertices() || _nf >= mesh_.n_faces())
+    return 0;
+
+  return decimate_rounds(mesh_.n_vertices() - _nv, _nf, true);
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Mesh>
+size_t ParallelDecimaterT<Mesh>::decimate_rounds(size_t _n_collapses, size_t _n_faces,
+                                                 bool _report_faces) {
+
+  typedef typename Mesh::VertexHandle   VertexHandle;
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+  typedef std::pair<float, int>         Candidate;
+
+  const int  n_vertices     = int(mesh_.n_vertices());
+  const int  n_threads      = this->n_threads();
+  const bool update_normals = mesh_.has_face_normals();
+
+  typename Mesh::VertexVertexIter vv_it;
+
+  size_t nf          = mesh_.n_faces();
+  size_t n_collapses = 0;
+  bool   aborted     = false;
+
+  // vertices whose best collapse has to be (re-)evaluated
+  std::vector<unsigned char> dirty(n_vertices, 1);
+  std::vector<int>           evaluate;
+
+  std::vector<Candidate>      candidates;
+  std::vector<HalfedgeHandle> collapses;
+  std::vector<VertexHandle>   remaining;
+  std::vector<size_t>         n_faces_after;
+
+  claimed_.assign(n_vertices, 0);
+  round_ = 0;
+
+  while (!aborted && n_collapses < _n_collapses && _n_faces < nf) {
+
+    ++round_;
+
+    // evaluate all vertices whose neighborhood changed in parallel
+    evaluate.clear();
+    for (int i = 0; i < n_vertices; ++i) {
+      if (dirty[i]) {
+        evaluate.push_back(i);
+        dirty[i] = 0;
+      }
+    }
+
+    const int n_evaluate = int(evaluate.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(n_threads)
+#endif
+    for (int i = 0; i < n_evaluate; ++i)
+      evaluate_vertex(VertexHandle(evaluate[i]));
+
+    // collect candidates, sorted by priority and vertex index
+    candidates.clear();
+    for (int i = 0; i < n_vertices; ++i) {
+      const VertexHandle vh(i);
+      if (!mesh_.status(vh).deleted() && mesh_.property(collapse_target_, vh).is_valid())
+        candidates.push_back(Candidate(mesh_.property(priority_, vh), i));
+    }
+
+    if (candidates.empty())
+      break;
+
+    // only the cheapest quarter of the collapses is considered
+    const size_t n_select = std::max(candidates.size() / 4, size_t(1));
+    std::nth_element(candidates.begin(), candidates.begin() + (n_select - 1), candidates.end());
+    std::sort(candidates.begin(), candidates.begin() + n_select);
+
+    // greedily select collapses with disjoint one-rings
+    collapses.clear();
+    remaining.clear();
+    n_faces_after.clear();
+    for (size_t k = 0; k < n_select; ++k) {
+
+      if (n_collapses + collapses.size() >= _n_collapses || _n_faces >= nf)
+        break;
+
+      const VertexHandle   v0(candidates[k].second);
+      const HalfedgeHandle v0v1 = mesh_.property(collapse_target_, v0);
+
+      // cheap test before setting up the collapse
+      if (claimed_[v0.idx()] == round_ || claimed_[mesh_.to_vertex_handle(v0v1).idx()] == round_)
+        continue;
+
+      CollapseInfo ci(mesh_, v0v1);
+
+      // check topological correctness AGAIN, the neighborhood may have changed
+      if (!is_collapse_legal_concurrent(ci)) {
+        mesh_.property(collapse_target_, ci.v0) = HalfedgeHandle();
+        continue;
+      }
+
+      if (!claim_region(ci))
+        continue;
+
+      // adjust complexity in advance (need boundary status)
+      if (mesh_.is_boundary(ci.v0v1) || mesh_.is_boundary(ci.v1v0))
+        --nf;
+      else
+        nf -= 2;
+
+      collapses.push_back(ci.v0v1);
+      remaining.push_back(ci.v1);
+      n_faces_after.push_back(nf);
+    }
+
+    // perform the independent collapses in parallel
+    const int n_apply = int(collapses.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(n_threads)
+#endif
+    for (int i = 0; i < n_apply; ++i) {
+
+      CollapseInfo ci(mesh_, collapses[i]);
+
+      // pre-processing
+      this->preprocess_collapse(ci);
+
+      // perform collapse
+      mesh_.collapse(ci.v0v1);
+
+      // update triangle normals
+      if (update_normals)
+      {
+        typename Mesh::VertexFaceIter f_it = mesh_.vf_iter(ci.v1);
+        for (; f_it.is_valid(); ++f_it)
+          if (!mesh_.status(*f_it).deleted())
+            mesh_.set_normal(*f_it, mesh_.calc_face_normal(*f_it));
+      }
+
+      // post-process collapse
+      this->postprocess_collapse(ci);
+    }
+
+    // update candidates (former one-ring of the decimated vertices)
+    for (int i = 0; i < n_apply; ++i) {
+      dirty[remaining[i].idx()] = 1;
+      for (vv_it = mesh_.vv_iter(remaining[i]); vv_it.is_valid(); ++vv_it)
+        dirty[vv_it->idx()] = 1;
+    }
+
+    // notify observer and stop after this round if the observer requests it
+    for (int i = 0; i < n_apply; ++i) {
+      ++n_collapses;
+      const size_t n_faces_removed = _report_faces ? mesh_.n_faces() - n_faces_after[i] : 0;
+      if (!this->notify_observer(n_collapses, n_faces_removed))
+        aborted = true;
+    }
+  }
+
+  claimed_.clear();
+
+  return n_collapses;
+}
+
+//=============================================================================
+}// END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+
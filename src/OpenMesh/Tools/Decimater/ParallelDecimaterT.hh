@@ -0,0 +1,195 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+/** \file ParallelDecimaterT.hh
+ */
+
+//=============================================================================
+//
+//  CLASS ParallelDecimaterT
+//
+//=============================================================================
+
+#ifndef OPENMESH_PARALLEL_DECIMATER_DECIMATERT_HH
+#define OPENMESH_PARALLEL_DECIMATER_DECIMATERT_HH
+
+
+//== INCLUDES =================================================================
+
+#include <vector>
+#include <OpenMesh/Tools/Decimater/BaseDecimaterT.hh>
+
+
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh  {
+namespace Decimater {
+
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Parallel decimater framework for triangle meshes.
+
+    Instead of a single priority queue the decimater works in rounds.
+    In each round all vertices whose neighborhood changed are evaluated
+    in parallel. From the cheapest quarter of the resulting collapses an
+    independent set is chosen greedily, such that the closed one-rings of
+    the chosen collapses do not overlap. These collapses do not interfere
+    with each other and are performed in parallel.
+
+    The selection is independent of the number of threads, therefore
+    the result is the same for any thread count. Compared to DecimaterT
+    the order of the collapses differs slightly, which may result in a
+    slightly different mesh.
+
+    Threads are only used if OpenMesh has been compiled with OpenMP and
+    all modules are thread safe (see ModBaseT::is_thread_safe()).
+    Otherwise the decimater runs on a single thread.
+
+    \see BaseModT, \ref decimater_docu
+*/
+template < typename MeshT >
+class ParallelDecimaterT : virtual public BaseDecimaterT<MeshT>
+{
+public: //-------------------------------------------------------- public types
+
+  typedef ParallelDecimaterT< MeshT >   Self;
+  typedef MeshT                         Mesh;
+  typedef CollapseInfoT<MeshT>          CollapseInfo;
+  typedef ModBaseT<MeshT>               Module;
+  typedef std::vector< Module* >        ModuleList;
+  typedef typename ModuleList::iterator ModuleListIterator;
+
+public: //------------------------------------------------------ public methods
+
+  /// Constructor
+  ParallelDecimaterT( Mesh& _mesh );
+
+  /// Destructor
+  ~ParallelDecimaterT();
+
+public:
+
+  /** Decimate (perform _n_collapses collapses). Return number of
+      performed collapses. If _n_collapses is not given reduce as
+      much as possible */
+  size_t decimate( size_t _n_collapses = 0 );
+
+  /// Decimate to target complexity, returns number of collapses
+  size_t decimate_to( size_t  _n_vertices )
+  {
+    return ( (_n_vertices < this->mesh().n_vertices()) ?
+	     decimate( this->mesh().n_vertices() - _n_vertices ) : 0 );
+  }
+
+  /** Decimate to target complexity (vertices and faces).
+   *  Stops when the number of vertices or the number of faces is reached.
+   *  Returns number of performed collapses.
+   */
+  size_t decimate_to_faces( size_t  _n_vertices=0, size_t _n_faces=0 );
+
+  /** Set the number of threads used for evaluating and performing the
+      collapses. 0 (the default) uses all available cores. */
+  void set_num_threads(unsigned int _n_threads) { n_threads_ = _n_threads; }
+
+  /// Number of threads set by set_num_threads()
+  unsigned int num_threads() const { return n_threads_; }
+
+private: //----------------------------------------------------- private methods
+
+  /** Perform rounds of independent collapses until _n_collapses collapses
+      are done or the number of faces drops to _n_faces. */
+  size_t decimate_rounds( size_t _n_collapses, size_t _n_faces, bool _report_faces );
+
+  /// Find the best collapse of _vh and store it in collapse_target_ and priority_
+  void evaluate_vertex( typename Mesh::VertexHandle _vh );
+
+  /** Same tests as BaseDecimaterT::is_collapse_legal(), but without
+      setting the tagged bit, so it can be called by several threads. */
+  bool is_collapse_legal_concurrent( const CollapseInfo& _ci ) const;
+
+  /** Claim the vertices of the closed one-rings of v0 and v1 for the
+      current round. Returns false if one of them is claimed already. */
+  bool claim_region( const CollapseInfo& _ci );
+
+  /// Number of threads actually used
+  int n_threads() const;
+
+private: //------------------------------------------------------- private data
+
+
+  // reference to mesh
+  Mesh&      mesh_;
+
+  // number of threads, 0 = all cores
+  unsigned int n_threads_;
+
+  // vertex properties
+  VPropHandleT<typename Mesh::HalfedgeHandle>  collapse_target_;
+  VPropHandleT<float>                          priority_;
+
+  // round in which a vertex has been claimed by a collapse
+  std::vector<unsigned int> claimed_;
+  unsigned int              round_;
+
+};
+
+//=============================================================================
+} // END_NS_DECIMATER
+} // END_NS_OPENMESH
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_PARALLEL_DECIMATER_DECIMATERT_CC)
+#define OPENMESH_PARALLEL_DECIMATER_TEMPLATES
+#include "ParallelDecimaterT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_PARALLEL_DECIMATER_DECIMATERT_HH defined
+//=============================================================================
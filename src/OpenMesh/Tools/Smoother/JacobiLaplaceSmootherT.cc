@@ -104,31 +104,38 @@ void
 JacobiLaplaceSmootherT<Mesh>::
 compute_new_positions_C0()
 {
-  typename Mesh::VertexIter  							v_it, v_end(Base::mesh_.vertices_end());
-  typename Mesh::ConstVertexOHalfedgeIter voh_it;
-  typename Mesh::Normal      							u, p, zero(0,0,0);
-  typename Mesh::Scalar      							w;
-
-  for (v_it=Base::mesh_.vertices_begin(); v_it!=v_end; ++v_it)
+  const int n_vertices = int(Base::mesh_.n_vertices());
+
+  // Each vertex only reads the old points of its neighbors and writes its
+  // own new position, so the loop can run in parallel.
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(this->n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    if (this->is_active(*v_it))
+    const typename Mesh::VertexHandle vh(i);
+
+    if (this->is_active(vh))
     {
+      typename Mesh::ConstVertexOHalfedgeIter voh_it;
+      typename Mesh::Normal                   u(0,0,0), p;
+      typename Mesh::Scalar                   w;
+
       // compute umbrella
-      u = zero;
-      for (voh_it = Base::mesh_.cvoh_iter(*v_it); voh_it.is_valid(); ++voh_it) {
+      for (voh_it = Base::mesh_.cvoh_iter(vh); voh_it.is_valid(); ++voh_it) {
         w = this->weight(Base::mesh_.edge_handle(*voh_it));
         u += vector_cast<typename Mesh::Normal>(Base::mesh_.point(Base::mesh_.to_vertex_handle(*voh_it))) * w;
       }
-      u *= this->weight(*v_it);
-      u -= vector_cast<typename Mesh::Normal>(Base::mesh_.point(*v_it));
+      u *= this->weight(vh);
+      u -= vector_cast<typename Mesh::Normal>(Base::mesh_.point(vh));
 
       // damping
       u *= 0.5;
     
       // store new position
-      p  = vector_cast<typename Mesh::Normal>(Base::mesh_.point(*v_it));
+      p  = vector_cast<typename Mesh::Normal>(Base::mesh_.point(vh));
       p += u;
-      this->set_new_position(*v_it, p);
+      this->set_new_position(vh, p);
     }
   }
 }
@@ -142,51 +149,67 @@ void
 JacobiLaplaceSmootherT<Mesh>::
 compute_new_positions_C1()
 {
-  typename Mesh::VertexIter  							v_it, v_end(Base::mesh_.vertices_end());
-  typename Mesh::ConstVertexOHalfedgeIter voh_it;
-  typename Mesh::Normal      							u, uu, p, zero(0,0,0);
-  typename Mesh::Scalar      							w, diag;
+  const int n_vertices = int(Base::mesh_.n_vertices());
 
 
-  // 1st pass: compute umbrellas
-  for (v_it=Base::mesh_.vertices_begin(); v_it!=v_end; ++v_it)
+  // 1st pass: compute umbrellas. Active vertices read the umbrellas of all
+  // their neighbours in the 2nd pass, so hidden vertices need one as well.
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(this->n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    u = zero;
-    for (voh_it = Base::mesh_.cvoh_iter(*v_it); voh_it.is_valid(); ++voh_it) {
+    const typename Mesh::VertexHandle vh(i);
+
+    if (Base::mesh_.status(vh).deleted())
+      continue;
+
+    typename Mesh::ConstVertexOHalfedgeIter voh_it;
+    typename Mesh::Normal                   u(0,0,0);
+    typename Mesh::Scalar                   w;
+
+    for (voh_it = Base::mesh_.cvoh_iter(vh); voh_it.is_valid(); ++voh_it) {
       w  = this->weight(Base::mesh_.edge_handle(*voh_it));
       u -= vector_cast<typename Mesh::Normal>(Base::mesh_.point(Base::mesh_.to_vertex_handle(*voh_it)))*w;
     }
-    u *= this->weight(*v_it);
-    u += vector_cast<typename Mesh::Normal>(Base::mesh_.point(*v_it));
+    u *= this->weight(vh);
+    u += vector_cast<typename Mesh::Normal>(Base::mesh_.point(vh));
 
-    Base::mesh_.property(umbrellas_, *v_it) = u;
+    Base::mesh_.property(umbrellas_, vh) = u;
   }
 
 
   // 2nd pass: compute updates
-  for (v_it=Base::mesh_.vertices_begin(); v_it!=v_end; ++v_it)
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(this->n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    if (this->is_active(*v_it))
+    const typename Mesh::VertexHandle vh(i);
+
+    if (this->is_active(vh))
     {
-      uu   = zero;
-      diag = 0.0;   
-      for (voh_it = Base::mesh_.cvoh_iter(*v_it); voh_it.is_valid(); ++voh_it) {
+      typename Mesh::ConstVertexOHalfedgeIter voh_it;
+      typename Mesh::Normal                   uu(0,0,0), p;
+      typename Mesh::Scalar                   w, diag(0.0);
+
+      for (voh_it = Base::mesh_.cvoh_iter(vh); voh_it.is_valid(); ++voh_it) {
         w  = this->weight(Base::mesh_.edge_handle(*voh_it));
         uu   -= Base::mesh_.property(umbrellas_, Base::mesh_.to_vertex_handle(*voh_it));
         diag += (w * this->weight(Base::mesh_.to_vertex_handle(*voh_it)) + static_cast<typename Mesh::Scalar>(1.0) ) * w;
       }
-      uu   *= this->weight(*v_it);
-      diag *= this->weight(*v_it);
-      uu   += Base::mesh_.property(umbrellas_, *v_it);
+      uu   *= this->weight(vh);
+      diag *= this->weight(vh);
+      uu   += Base::mesh_.property(umbrellas_, vh);
       if (diag) uu *= static_cast<typename Mesh::Scalar>(1.0) / diag;
 
       // damping
       uu *= 0.25;
     
       // store new position
-      p  = vector_cast<typename Mesh::Normal>(Base::mesh_.point(*v_it));
+      p  = vector_cast<typename Mesh::Normal>(Base::mesh_.point(vh));
       p -= uu;
-      this->set_new_position(*v_it, p);
+      this->set_new_position(vh, p);
     }
   }
 }
@@ -63,6 +63,10 @@
 #include <OpenMesh/Core/Utils/vector_cast.hh>
 #include <OpenMesh/Tools/Smoother/SmootherT.hh>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 //== NAMESPACES ===============================================================
 
 
@@ -95,6 +99,7 @@ SmootherT(Mesh& _mesh)
   component_  = Tangential_and_Normal;
   continuity_ = C0;
   tolerance_  = -1.0;
+  n_threads_  = 1;
 }
 
 
@@ -166,6 +171,12 @@ set_active_vertices()
     { nothing_selected = false; break; }
 
 
+  // vertices skipped by the iterators are never active, the parallel
+  // smoothing loops run over all vertex indices
+  for (size_t i=0; i<mesh_.n_vertices(); ++i)
+    mesh_.property(is_active_, VertexHandle(int(i))) = false;
+
+
   // tagg all active vertices
   for (v_it=mesh_.vertices_begin(); v_it!=v_end; ++v_it)
   {
@@ -357,23 +368,27 @@ void
 SmootherT<Mesh>::
 project_to_tangent_plane()
 {
-  typename Mesh::VertexIter  v_it(mesh_.vertices_begin()),
-                             v_end(mesh_.vertices_end());
-  // Normal should be a vector type. In some environment a vector type
-  // is different from point type, e.g. OpenSG!
-  typename Mesh::Normal      translation, normal;
+  const int n_vertices = int(mesh_.n_vertices());
 
-
-  for (; v_it != v_end; ++v_it)
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    if (is_active(*v_it))
+    const VertexHandle vh(i);
+
+    if (is_active(vh))
     {
-      translation  = new_position(*v_it)-orig_position(*v_it);
-      normal       = orig_normal(*v_it);
+      // Normal should be a vector type. In some environment a vector type
+      // is different from point type, e.g. OpenSG!
+      typename Mesh::Normal translation, normal;
+
+      translation  = new_position(vh)-orig_position(vh);
+      normal       = orig_normal(vh);
       normal      *= dot(translation, normal);
       translation -= normal;
-      translation += vector_cast<typename Mesh::Normal>(orig_position(*v_it));
-      set_new_position(*v_it, translation);
+      translation += vector_cast<typename Mesh::Normal>(orig_position(vh));
+      set_new_position(vh, translation);
     }
   }
 }
@@ -387,26 +402,26 @@ void
 SmootherT<Mesh>::
 local_error_check()
 {
-  typename Mesh::VertexIter  v_it(mesh_.vertices_begin()),
-                             v_end(mesh_.vertices_end());
+  const int n_vertices = int(mesh_.n_vertices());
 
-  typename Mesh::Normal      translation;
-  typename Mesh::Scalar      s;
-
-
-  for (; v_it != v_end; ++v_it)
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
   {
-    if (is_active(*v_it))
+    const VertexHandle vh(i);
+
+    if (is_active(vh))
     {
-      translation  = new_position(*v_it) - orig_position(*v_it);
+      typename Mesh::Normal translation = new_position(vh) - orig_position(vh);
 
-      s = fabs(dot(translation, orig_normal(*v_it)));
+      typename Mesh::Scalar s = fabs(dot(translation, orig_normal(vh)));
 
       if (s > tolerance_)
       {
         translation *= (tolerance_ / s);
-        translation += vector_cast<NormalType>(orig_position(*v_it));
-        set_new_position(*v_it, translation);
+        translation += vector_cast<NormalType>(orig_position(vh));
+        set_new_position(vh, translation);
       }
     }
   }
@@ -421,12 +436,34 @@ void
 SmootherT<Mesh>::
 move_points()
 {
-  typename Mesh::VertexIter  v_it(mesh_.vertices_begin()),
-                             v_end(mesh_.vertices_end());
+  const int n_vertices = int(mesh_.n_vertices());
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static) num_threads(n_threads())
+#endif
+  for (int i = 0; i < n_vertices; ++i)
+  {
+    const VertexHandle vh(i);
 
-  for (; v_it != v_end; ++v_it)
-    if (is_active(*v_it))
-      mesh_.set_point(*v_it, mesh_.property(new_positions_, *v_it));
+    if (is_active(vh))
+      mesh_.set_point(vh, mesh_.property(new_positions_, vh));
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+int
+SmootherT<Mesh>::
+n_threads() const
+{
+#ifdef _OPENMP
+  return n_threads_ ? int(n_threads_) : omp_get_max_threads();
+#else
+  return 1;
+#endif
 }
 
 
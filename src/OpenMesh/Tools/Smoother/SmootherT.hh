@@ -174,6 +174,24 @@ public:
 
   /** @} */
 
+  //===========================================================================
+  /** @name Parallelization
+  * @{ */
+  //===========================================================================
+
+  /** \brief Set the number of threads used by smooth()
+   *
+   * All smoothing steps compute the new positions from the positions of the
+   * previous iteration only, so the vertices are processed in parallel. The
+   * result is the same for every number of threads. Requires OpenMesh to be
+   * compiled with OpenMP, otherwise the smoother runs single threaded.
+   *
+   * @param _n_threads Number of threads, 0 uses all available cores. Default is 1.
+   */
+  void set_num_threads( unsigned int _n_threads ){ n_threads_ = _n_threads; };
+
+  /** @} */
+
 private:
 
   /** \brief  Find active vertices. Resets tagged status !
@@ -223,6 +241,9 @@ protected:
   bool is_active(VertexHandle _vh) const
   { return mesh_.property(is_active_, _vh); }
 
+  /// Number of threads to use in the loops over all vertices
+  int n_threads() const;
+
   Component  component()  const { return component_;  }
   Continuity continuity() const { return continuity_; }
 
@@ -238,6 +259,7 @@ private:
   Scalar      normal_deviation_;
   Component   component_;
   Continuity  continuity_;
+  unsigned int n_threads_;
 
   OpenMesh::VPropHandleT<Point>      original_positions_;
   OpenMesh::VPropHandleT<NormalType> original_normals_;
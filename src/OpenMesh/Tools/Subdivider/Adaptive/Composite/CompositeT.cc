@@ -64,6 +64,8 @@
 #include <OpenMesh/Core/System/config.hh>
 #include <OpenMesh/Core/System/omstream.hh>
 #include <ostream>
+#include <algorithm>
+#include <utility>
 #include <OpenMesh/Tools/Subdivider/Adaptive/Composite/CompositeT.hh>
 #include <OpenMesh/Tools/Subdivider/Adaptive/Composite/RuleInterfaceT.hh>
 
@@ -292,6 +294,87 @@ void CompositeT<M>::refine(typename M::VertexHandle& _vh)
 // ----------------------------------------------------------------------------
 
 
+template<class M>
+void CompositeT<M>::refine(const std::vector<FH>& _faces, const std::vector<int>& _levels)
+{
+  assert(_faces.size() == _levels.size());
+
+  // faces that have not reached their target level yet
+  std::vector< std::pair<FH, int> > todo;
+  int                               max_level = 0;
+
+  for (size_t i = 0; i < _faces.size(); ++i)
+  {
+    if (_faces[i].is_valid() && level(_faces[i]) < _levels[i])
+    {
+      todo.push_back(std::make_pair(_faces[i], _levels[i]));
+      max_level = std::max(max_level, _levels[i]);
+    }
+  }
+
+  // raise all faces of the front to the next level before going on
+  for (int front = 1; front <= max_level && !todo.empty(); ++front)
+  {
+    size_t n_todo = 0;
+
+    for (size_t i = 0; i < todo.size(); ++i)
+    {
+      FH fh = todo[i].first;
+
+      // the face may have been refined as a neighbour of another one
+      for (int l = level(fh); l < front; ++l)
+        refine(fh);
+
+      if (todo[i].second > front)
+        todo[n_todo++] = todo[i];
+    }
+    todo.resize(n_todo);
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
+template<class M>
+void CompositeT<M>::refine(const std::vector<VH>& _vertices, const std::vector<int>& _levels)
+{
+  assert(_vertices.size() == _levels.size());
+
+  std::vector< std::pair<VH, int> > todo;
+  int                               max_level = 0;
+
+  for (size_t i = 0; i < _vertices.size(); ++i)
+  {
+    if (_vertices[i].is_valid() && level(_vertices[i]) < _levels[i])
+    {
+      todo.push_back(std::make_pair(_vertices[i], _levels[i]));
+      max_level = std::max(max_level, _levels[i]);
+    }
+  }
+
+  for (int front = 1; front <= max_level && !todo.empty(); ++front)
+  {
+    size_t n_todo = 0;
+
+    for (size_t i = 0; i < todo.size(); ++i)
+    {
+      VH vh = todo[i].first;
+
+      for (int l = level(vh); l < front; ++l)
+        refine(vh);
+
+      if (todo[i].second > front)
+        todo[n_todo++] = todo[i];
+    }
+    todo.resize(n_todo);
+  }
+}
+
+
+// ----------------------------------------------------------------------------
+
+
 template <class M>
 std::string CompositeT<M>::rules_as_string(const std::string& _sep) const
 {
@@ -126,7 +126,8 @@ template <typename M> class  RuleInterfaceT;
  *
  *  After the rule sequence has been defined the subdivider has to be
  *  intialized using CompositeT::initialize(). If everything went well,
- *  use CompositeT::refine() to subdivide locally a face or vertex.
+ *  use CompositeT::refine() to subdivide locally a face or vertex, or
+ *  a batch of faces or vertices to given levels.
  *
  *  \note Not all (topological) operators have been implemented!
  *  \note Only triangle meshes are supported.
@@ -186,6 +187,42 @@ public:
   void refine(typename M::VertexHandle& _vh);
 
 
+  /** Refine a batch of faces, face \c _faces[i] to level \c _levels[i].
+   *
+   *  The faces are refined breadth first: all faces are raised to level
+   *  1 before any of them is raised to level 2 and so on. The neighbours
+   *  that the rules raise on the way are therefore at most one level
+   *  behind, which keeps the recursion of RuleInterfaceT::raise() short
+   *  compared to refining the faces one after another to their final
+   *  level. Within a level the faces are refined in the given order.
+   *  Faces created during the refinement are not part of the batch.
+   *
+   *  The refinement runs on one thread. Refining a face raises vertices
+   *  up to its 3-ring and the topological rule adds elements to the
+   *  mesh, so the faces of a level are not independent of each other.
+   */
+  void refine(const std::vector<FH>& _faces, const std::vector<int>& _levels);
+
+  /// Refine a batch of faces to the same level \c _level.
+  void refine(const std::vector<FH>& _faces, int _level)
+  { refine(_faces, std::vector<int>(_faces.size(), _level)); }
+
+  /// Raise a batch of vertices, vertex \c _vertices[i] to level \c _levels[i], breadth first.
+  void refine(const std::vector<VH>& _vertices, const std::vector<int>& _levels);
+
+  /// Raise a batch of vertices to the same level \c _level.
+  void refine(const std::vector<VH>& _vertices, int _level)
+  { refine(_vertices, std::vector<int>(_vertices.size(), _level)); }
+
+  /// Number of times face \c _fh has been refined.
+  int level(FH _fh) const
+  { return (mesh_.data(_fh).state() + int(n_rules()) - subdiv_rule_->number() - 1) / int(n_rules()); }
+
+  /// Number of final levels vertex \c _vh has been raised to.
+  int level(VH _vh) const
+  { return mesh_.data(_vh).state() / int(n_rules()); }
+
+
   /// Return subdivision split type (3 for 1-to-3 split, 4 for 1-to-4 split).
   int subdiv_type() { return subdiv_type_; }
 
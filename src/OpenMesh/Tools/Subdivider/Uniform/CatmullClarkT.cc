@@ -163,6 +163,314 @@ CatmullClarkT<MeshType,RealType>::subdivide( MeshType& _m , size_t _n , const bo
 
 //-----------------------------------------------------------------------------
 
+template <typename MeshType, typename RealType>
+bool
+CatmullClarkT<MeshType,RealType>::subdivide_into( const MeshType& _src, MeshType& _dst,
+                                                  size_t /* _step */, const bool _update_points)
+{
+  const int nV = int(_src.n_vertices());
+  const int nE = int(_src.n_edges());
+  const int nF = int(_src.n_faces());
+  const int nH = 2*nE;
+
+  // The corners (= halfedges) of each face are numbered consecutively,
+  // each corner becomes a quad and an edge from the edge to the face point.
+  std::vector<int> face_corners(nF+1, 0);
+  std::vector<int> corner(nH, -1);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+    face_corners[f+1] = int(_src.valence(FaceHandle(f)));
+
+  for (int f = 0; f < nF; ++f)
+    face_corners[f+1] += face_corners[f];
+
+  const int nC = face_corners[nF];
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+  {
+    const HalfedgeHandle h0 = _src.halfedge_handle(FaceHandle(f));
+    HalfedgeHandle       hh = h0;
+    int                  c  = face_corners[f];
+    do {
+      corner[hh.idx()] = c++;
+      hh = _src.next_halfedge_handle(hh);
+    } while (hh != h0);
+  }
+
+  /* New elements:
+     - vertices: the old vertices, the edge points nV+e, the face points nV+nE+f
+     - edges:    old halfedge h gives edge h from its edge point to its
+                 to vertex, corner c gives edge nH+c from the edge point
+                 of its halfedge to the face point
+     - faces:    corner c gives the quad at the to vertex of its halfedge
+
+     Halfedge h from a to b with edge point m becomes A(h) = a->m, B(h) = m->b,
+     its corner gives I(h) = m->F and I'(h) = F->m.
+   */
+  const int nV2 = nV + nE + nF;
+  const int nH2 = 2*(nH + nC);
+
+  std::vector<int> vertex_halfedges(nV2, -1);
+  std::vector<int> halfedges(3*size_t(nH2));
+  std::vector<int> face_halfedges(nC);
+
+#define A_HEH( H ) ( 2*((H)^1) + 1 )
+#define B_HEH( H ) ( 2*(H) )
+#define I_HEH( H ) ( 2*(nH + corner[H]) )
+#define SET_HEH( H, TO, NEXT, FACE ) \
+  halfedges[3*size_t(H)] = (TO); halfedges[3*size_t(H)+1] = (NEXT); halfedges[3*size_t(H)+2] = (FACE)
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int h = 0; h < nH; ++h)
+  {
+    const HalfedgeHandle hh(h);
+    const int            m    = nV + h/2;
+    const int            to   = _src.to_vertex_handle(hh).idx();
+    const int            next = _src.next_halfedge_handle(hh).idx();
+
+    if (_src.is_boundary(hh))
+    {
+      SET_HEH( A_HEH(h), m,  B_HEH(h),    -1 );
+      SET_HEH( B_HEH(h), to, A_HEH(next), -1 );
+    }
+    else
+    {
+      const int prev = _src.prev_halfedge_handle(hh).idx();
+      const int F    = nV + nE + _src.face_handle(hh).idx();
+
+      SET_HEH( A_HEH(h),     m,  I_HEH(h),        corner[prev] );
+      SET_HEH( B_HEH(h),     to, A_HEH(next),     corner[h]    );
+      SET_HEH( I_HEH(h),     F,  I_HEH(prev) + 1, corner[prev] );
+      SET_HEH( I_HEH(h) + 1, m,  B_HEH(h),        corner[h]    );
+
+      face_halfedges[corner[h]] = B_HEH(h);
+    }
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int v = 0; v < nV; ++v)
+  {
+    const HalfedgeHandle hh = _src.halfedge_handle(VertexHandle(v));
+    if (hh.is_valid())
+      vertex_halfedges[v] = A_HEH(hh.idx());
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int e = 0; e < nE; ++e)
+  {
+    // the boundary halfedge, if there is one
+    const int h = _src.is_boundary(HalfedgeHandle(2*e)) ? 2*e : 2*e+1;
+    vertex_halfedges[nV + e] = B_HEH(h);
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+    vertex_halfedges[nV + nE + f] = I_HEH(_src.halfedge_handle(FaceHandle(f)).idx()) + 1;
+
+#undef A_HEH
+#undef B_HEH
+#undef I_HEH
+#undef SET_HEH
+
+  // geometry, computed like in subdivide()
+  std::vector<Point> face_points(nF);
+  std::vector<Point> edge_points(nE);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+    _src.calc_face_centroid(FaceHandle(f), face_points[f]);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int e = 0; e < nE; ++e)
+  {
+    const HalfedgeHandle heh(2*e), opp_heh(2*e+1);
+
+    Point pos( _src.point( _src.to_vertex_handle( heh)));
+    pos += _src.point( _src.to_vertex_handle( opp_heh));
+
+    if (_src.is_boundary(EdgeHandle(e)) || !_update_points)
+      pos *= 0.5;
+    else
+    {
+      pos += face_points[_src.face_handle(heh).idx()];
+      pos += face_points[_src.face_handle(opp_heh).idx()];
+      pos *= 0.25;
+    }
+    edge_points[e] = pos;
+  }
+
+  _dst.clear();
+  _dst.resize(nV2, 0, 0);
+
+  if (!_dst.set_connectivity(vertex_halfedges, halfedges, face_halfedges))
+    return false;
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int v = 0; v < nV; ++v)
+  {
+    const VertexHandle vh(v);
+    Point              pos(_src.point(vh));
+
+    if (_update_points)
+    {
+      if ( _src.is_boundary(vh) )
+      {
+        for (typename MeshType::ConstVertexEdgeIter ve_itr = _src.cve_iter(vh); ve_itr.is_valid(); ++ve_itr)
+          if ( _src.is_boundary( *ve_itr ) )
+            pos += edge_points[ve_itr->idx()];
+        pos /= 3.0;
+      }
+      else
+      {
+        RealType valence(0.0);
+        pos = Point(0.0,0.0,0.0);
+        for (typename MeshType::ConstVertexOHalfedgeIter voh_it = _src.cvoh_iter(vh); voh_it.is_valid(); ++voh_it)
+        {
+          pos += _src.point( _src.to_vertex_handle( *voh_it ) );
+          valence+=1.0;
+        }
+        pos /= valence*valence;
+
+        Point Q(0, 0, 0);
+        for (typename MeshType::ConstVertexFaceIter vf_itr = _src.cvf_iter(vh); vf_itr.is_valid(); ++vf_itr)
+          Q += face_points[vf_itr->idx()];
+        Q /= valence*valence;
+
+        pos += _src.point(vh) * (valence - RealType(2.0) )/valence + Q;
+      }
+    }
+
+    _dst.set_point(vh, pos);
+  }
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int e = 0; e < nE; ++e)
+    _dst.set_point(VertexHandle(nV + e), edge_points[e]);
+
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+    _dst.set_point(VertexHandle(nV + nE + f), face_points[f]);
+
+  _dst.update_normals();
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
+template <typename MeshType, typename RealType>
+bool
+CatmullClarkT<MeshType,RealType>::subdivide_stencils( const MeshType& _src, size_t /* _step */,
+                                                      std::vector<Stencil>& _stencils,
+                                                      const bool _update_points)
+{
+  const int nV = int(_src.n_vertices());
+  const int nE = int(_src.n_edges());
+  const int nF = int(_src.n_faces());
+
+  _stencils.assign(nV + nE + nF, Stencil());
+
+  // face points: centroids
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int f = 0; f < nF; ++f)
+  {
+    const FaceHandle fh(f);
+    Stencil&         s = _stencils[nV + nE + f];
+    const RealType   w = RealType(1.0) / RealType(_src.valence(fh));
+
+    for (typename MeshType::ConstFaceVertexIter fv_itr = _src.cfv_iter(fh); fv_itr.is_valid(); ++fv_itr)
+      s.push_back(typename table_t::Entry(fv_itr->idx(), w));
+  }
+
+  // edge points, see subdivide_into()
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int e = 0; e < nE; ++e)
+  {
+    const HalfedgeHandle heh(2*e), opp_heh(2*e+1);
+    Stencil&             s = _stencils[nV + e];
+
+    if (_src.is_boundary(EdgeHandle(e)) || !_update_points)
+    {
+      s.push_back(typename table_t::Entry(_src.to_vertex_handle(heh).idx(),     RealType(0.5)));
+      s.push_back(typename table_t::Entry(_src.to_vertex_handle(opp_heh).idx(), RealType(0.5)));
+    }
+    else
+    {
+      s.push_back(typename table_t::Entry(_src.to_vertex_handle(heh).idx(),     RealType(0.25)));
+      s.push_back(typename table_t::Entry(_src.to_vertex_handle(opp_heh).idx(), RealType(0.25)));
+      table_t::append(s, _stencils[nV + nE + _src.face_handle(heh).idx()],     RealType(0.25));
+      table_t::append(s, _stencils[nV + nE + _src.face_handle(opp_heh).idx()], RealType(0.25));
+    }
+  }
+
+  // old vertices, see subdivide_into()
+#ifdef _OPENMP
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int v = 0; v < nV; ++v)
+  {
+    const VertexHandle vh(v);
+    Stencil&           s = _stencils[v];
+
+    if (!_update_points)
+      s.push_back(typename table_t::Entry(v, RealType(1.0)));
+    else if ( _src.is_boundary(vh) )
+    {
+      const RealType w = RealType(1.0/3.0);
+
+      s.push_back(typename table_t::Entry(v, w));
+      for (typename MeshType::ConstVertexEdgeIter ve_itr = _src.cve_iter(vh); ve_itr.is_valid(); ++ve_itr)
+        if ( _src.is_boundary( *ve_itr ) )
+          table_t::append(s, _stencils[nV + ve_itr->idx()], w);
+    }
+    else
+    {
+      const RealType valence = RealType(_src.valence(vh));
+      const RealType w       = RealType(1.0) / (valence*valence);
+
+      for (typename MeshType::ConstVertexOHalfedgeIter voh_it = _src.cvoh_iter(vh); voh_it.is_valid(); ++voh_it)
+        s.push_back(typename table_t::Entry(_src.to_vertex_handle(*voh_it).idx(), w));
+
+      for (typename MeshType::ConstVertexFaceIter vf_itr = _src.cvf_iter(vh); vf_itr.is_valid(); ++vf_itr)
+        table_t::append(s, _stencils[nV + nE + vf_itr->idx()], w);
+
+      s.push_back(typename table_t::Entry(v, (valence - RealType(2.0)) / valence));
+    }
+  }
+
+  return true;
+}
+
+//-----------------------------------------------------------------------------
+
 template <typename MeshType, typename RealType>
 void
 CatmullClarkT<MeshType,RealType>::split_face( MeshType& _m, const FaceHandle& _fh)
@@ -65,6 +65,7 @@
 #include <OpenMesh/Tools/Subdivider/Uniform/SubdividerT.hh>
 
 // -------------------- STL
+#include <vector>
 #if defined(OM_CC_MIPS)
 #  include <math.h>
 #else
@@ -111,6 +112,9 @@ public:
 
   typedef SubdividerT< MeshType, RealType >           parent_t;
 
+  typedef StencilTableT< RealType >                   table_t;
+  typedef typename table_t::Stencil                   Stencil;
+
   /// Constructor
   CatmullClarkT(  ) : parent_t() {  }
 
@@ -140,6 +144,35 @@ protected:
      */
   virtual bool subdivide( MeshType& _m, size_t _n , const bool _update_points = true);
 
+  /** \brief Execute one subdivision step out of place
+     *
+     * Builds the refined mesh with the same vertex numbering as one step
+     * of subdivide(): the old vertices, one vertex per edge and one per
+     * face. The edges and faces are numbered arithmetically from the
+     * halfedges of _src and the connectivity is set with
+     * ArrayKernel::set_connectivity().
+     *
+     * @param _src Mesh to refine
+     * @param _dst Refined mesh
+     * @param _step Unused here
+     * @param _update_points Compute new positions for the old vertices?
+     * @return successful?
+     */
+  virtual bool subdivide_into( const MeshType& _src, MeshType& _dst, size_t _step,
+                               const bool _update_points = true);
+
+  /** \brief Compute the stencils of one subdivide_into() step
+     *
+     * @param _src Mesh to refine
+     * @param _step Unused here
+     * @param _stencils Stencils of the refined vertices in terms of the vertices of _src
+     * @param _update_points Compute new positions for the old vertices?
+     * @return successful?
+     */
+  virtual bool subdivide_stencils( const MeshType& _src, size_t _step,
+                                   std::vector<Stencil>& _stencils,
+                                   const bool _update_points = true);
+
 private:
 
   //===========================================================================
@@ -104,6 +104,9 @@ public:
   typedef std::pair< real_t, real_t >             weight_t;
   typedef std::vector< std::pair<real_t,real_t> > weights_t;
 
+  typedef StencilTableT< real_t >                 table_t;
+  typedef typename table_t::Stencil               Stencil;
+
 public:
 
 
@@ -209,6 +212,240 @@ protected:
     return true;
   }
 
+
+  /** Execute one subdivision step out of place.
+   *
+   * Builds the refined mesh with the same vertex numbering as one step
+   * of subdivide(): the old vertices followed by one vertex per edge.
+   * Each triangle f becomes the corner triangles 4f, 4f+1, 4f+2 and the
+   * center triangle 4f+3. The edges are numbered arithmetically from the halfedges of
+   * _src and the connectivity is set with ArrayKernel::set_connectivity().
+   */
+  bool subdivide_into( const mesh_t& _src, mesh_t& _dst, size_t /* _step */,
+                       const bool _update_points = true)
+  {
+    typedef typename mesh_t::Point          Point;
+    typedef typename mesh_t::HalfedgeHandle HalfedgeHandle;
+
+    const int nV = int(_src.n_vertices());
+    const int nE = int(_src.n_edges());
+    const int nF = int(_src.n_faces());
+    const int nH = 2*nE;
+
+    // corner 3f+j is the j-th halfedge of triangle f
+    std::vector<int> corner(nH, -1);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int f = 0; f < nF; ++f)
+    {
+      HalfedgeHandle hh = _src.halfedge_handle(typename mesh_t::FaceHandle(f));
+      for (int j = 0; j < 3; ++j, hh = _src.next_halfedge_handle(hh))
+        corner[hh.idx()] = 3*f + j;
+    }
+
+    /* New elements:
+       - vertices: the old vertices and the edge points nV+e
+       - edges:    old halfedge h gives edge h from its edge point to its to
+                   vertex, corner c gives edge nH+c between the edge points
+                   of the halfedge and of the next halfedge
+       - faces:    corner c of triangle f gives the triangle c+f at the to
+                   vertex of its halfedge, 4f+3 is the center triangle
+
+       Halfedge h from a to b with edge point m becomes A(h) = a->m,
+       B(h) = m->b, its corner gives K(h) = m(next)->m and K'(h) = m->m(next).
+     */
+    const int nV2 = nV + nE;
+    const int nH2 = 2*(nH + 3*nF);
+
+    std::vector<int> vertex_halfedges(nV2, -1);
+    std::vector<int> halfedges(3*size_t(nH2));
+    std::vector<int> face_halfedges(4*size_t(nF));
+
+#define A_HEH( H ) ( 2*((H)^1) + 1 )
+#define B_HEH( H ) ( 2*(H) )
+#define K_HEH( H ) ( 2*(nH + corner[H]) )
+#define C_FACE( H ) ( corner[H] + corner[H]/3 )
+#define SET_HEH( H, TO, NEXT, FACE ) \
+    halfedges[3*size_t(H)] = (TO); halfedges[3*size_t(H)+1] = (NEXT); halfedges[3*size_t(H)+2] = (FACE)
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int h = 0; h < nH; ++h)
+    {
+      const HalfedgeHandle hh(h);
+      const int            m    = nV + h/2;
+      const int            to   = _src.to_vertex_handle(hh).idx();
+      const int            next = _src.next_halfedge_handle(hh).idx();
+
+      if (_src.is_boundary(hh))
+      {
+        SET_HEH( A_HEH(h), m,  B_HEH(h),    -1 );
+        SET_HEH( B_HEH(h), to, A_HEH(next), -1 );
+      }
+      else
+      {
+        const int prev   = _src.prev_halfedge_handle(hh).idx();
+        const int center = 4*(corner[h]/3) + 3;
+
+        SET_HEH( A_HEH(h),     m,             K_HEH(prev),     C_FACE(prev) );
+        SET_HEH( B_HEH(h),     to,            A_HEH(next),     C_FACE(h)    );
+        SET_HEH( K_HEH(h),     m,             B_HEH(h),        C_FACE(h)    );
+        SET_HEH( K_HEH(h) + 1, nV + next/2,   K_HEH(next) + 1, center       );
+
+        face_halfedges[C_FACE(h)] = B_HEH(h);
+        if (corner[h] % 3 == 0)
+          face_halfedges[center] = K_HEH(h) + 1;
+      }
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV; ++v)
+    {
+      const HalfedgeHandle hh = _src.halfedge_handle(typename mesh_t::VertexHandle(v));
+      if (hh.is_valid())
+        vertex_halfedges[v] = A_HEH(hh.idx());
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+    {
+      // the boundary halfedge, if there is one
+      const int h = _src.is_boundary(HalfedgeHandle(2*e)) ? 2*e : 2*e+1;
+      vertex_halfedges[nV + e] = B_HEH(h);
+    }
+
+#undef A_HEH
+#undef B_HEH
+#undef K_HEH
+#undef C_FACE
+#undef SET_HEH
+
+    _dst.clear();
+    _dst.resize(nV2, 0, 0);
+
+    if (!_dst.set_connectivity(vertex_halfedges, halfedges, face_halfedges))
+      return false;
+
+    // geometry, computed like in subdivide()
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV; ++v)
+    {
+      const typename mesh_t::VertexHandle vh(v);
+      Point                               pos(_src.point(vh));
+
+      if (_update_points)
+        smoothed(_src, vh, pos);
+
+      _dst.set_point(vh, pos);
+    }
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+    {
+      const typename mesh_t::EdgeHandle eh(e);
+      Point                             pos;
+
+      if (_update_points)
+        pos = midpoint(_src, eh);
+      else
+      {
+        pos  = _src.point(_src.to_vertex_handle(_src.halfedge_handle(eh, 0)));
+        pos += _src.point(_src.to_vertex_handle(_src.halfedge_handle(eh, 1)));
+        pos *= 0.5;
+      }
+
+      _dst.set_point(typename mesh_t::VertexHandle(nV + e), pos);
+    }
+
+    return true;
+  }
+
+
+  /// Compute the stencils of one subdivide_into() step.
+  bool subdivide_stencils( const mesh_t& _src, size_t /* _step */,
+                           std::vector<Stencil>& _stencils,
+                           const bool _update_points = true)
+  {
+    typedef typename mesh_t::VertexHandle   VertexHandle;
+    typedef typename mesh_t::HalfedgeHandle HalfedgeHandle;
+    typedef typename table_t::Entry         Entry;
+
+    const int nV = int(_src.n_vertices());
+    const int nE = int(_src.n_edges());
+
+    _stencils.assign(nV + nE, Stencil());
+
+    // old vertices, see smoothed()
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV; ++v)
+    {
+      const VertexHandle vh(v);
+      Stencil&           s = _stencils[v];
+
+      if (!_update_points)
+        s.push_back(Entry(v, real_t(1.0)));
+      else if (_src.is_boundary(vh))
+      {
+        const HalfedgeHandle heh = _src.halfedge_handle(vh);
+
+        if (heh.is_valid())
+        {
+          s.push_back(Entry(v, real_t(6.0) * _1over8));
+          s.push_back(Entry(_src.to_vertex_handle(heh).idx(), _1over8));
+          s.push_back(Entry(_src.from_vertex_handle(_src.prev_halfedge_handle(heh)).idx(), _1over8));
+        }
+        else
+          s.push_back(Entry(v, real_t(1.0)));
+      }
+      else
+      {
+        const size_t valence = _src.valence(vh);
+
+        for (typename mesh_t::ConstVertexVertexIter vvit = _src.cvv_iter(vh); vvit.is_valid(); ++vvit)
+          s.push_back(Entry(vvit->idx(), weights_[valence].second));
+        s.push_back(Entry(v, weights_[valence].first));
+      }
+    }
+
+    // edge points, see midpoint()
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+    {
+      const HalfedgeHandle heh(2*e), opp_heh(2*e+1);
+      Stencil&             s = _stencils[nV + e];
+
+      if (!_update_points || _src.is_boundary(typename mesh_t::EdgeHandle(e)))
+      {
+        s.push_back(Entry(_src.to_vertex_handle(heh).idx(),     real_t(0.5)));
+        s.push_back(Entry(_src.to_vertex_handle(opp_heh).idx(), real_t(0.5)));
+      }
+      else
+      {
+        s.push_back(Entry(_src.to_vertex_handle(heh).idx(),     _3over8));
+        s.push_back(Entry(_src.to_vertex_handle(opp_heh).idx(), _3over8));
+        s.push_back(Entry(_src.to_vertex_handle(_src.next_halfedge_handle(heh)).idx(),     _1over8));
+        s.push_back(Entry(_src.to_vertex_handle(_src.next_halfedge_handle(opp_heh)).idx(), _1over8));
+      }
+    }
+
+    return true;
+  }
+
 private:
 
   /// Helper functor to compute weights for Loop-subdivision
@@ -379,6 +616,12 @@ private: // topological modifiers
 private: // geometry helper
 
   void compute_midpoint(mesh_t& _m, const typename mesh_t::EdgeHandle& _eh)
+  {
+    _m.property( ep_pos_, _eh ) = midpoint( _m, _eh );
+  }
+
+  /// New position of the edge point of _eh
+  typename mesh_t::Point midpoint(const mesh_t& _m, const typename mesh_t::EdgeHandle& _eh) const
   {
 #define V( X ) vector_cast< typename mesh_t::Normal >( X )
     typename mesh_t::HalfedgeHandle heh, opp_heh;
@@ -403,11 +646,21 @@ private: // geometry helper
       pos += V(_m.point(_m.to_vertex_handle(_m.next_halfedge_handle(opp_heh))));
       pos *= _1over8;
     }
-    _m.property( ep_pos_, _eh ) = pos;
+    return pos;
 #undef V
   }
 
   void smooth(mesh_t& _m, const typename mesh_t::VertexHandle& _vh)
+  {
+    typename mesh_t::Point pos;
+
+    if ( smoothed( _m, _vh, pos ) )
+      _m.property( vp_pos_, _vh ) = pos;
+  }
+
+  /// New position of the old vertex _vh, false for isolated vertices
+  bool smoothed(const mesh_t& _m, const typename mesh_t::VertexHandle& _vh,
+                typename mesh_t::Point& _pos) const
   {
     typename mesh_t::Point            pos(0.0,0.0,0.0);
 
@@ -435,16 +688,16 @@ private: // geometry helper
 
       }
       else
-        return;
+        return false;
     }
     else // inner vertex: (1-a) * p + a/n * Sum q, q in one-ring of p
     {
       typedef typename mesh_t::Normal   Vec;
-      typename mesh_t::VertexVertexIter vvit;
+      typename mesh_t::ConstVertexVertexIter vvit;
       size_t                            valence(0);
 
       // Calculate Valence and sum up neighbour points
-      for (vvit=_m.vv_iter(_vh); vvit.is_valid(); ++vvit) {
+      for (vvit=_m.cvv_iter(_vh); vvit.is_valid(); ++vvit) {
         ++valence;
         pos += vector_cast< Vec >( _m.point(*vvit) );
       }
@@ -453,7 +706,8 @@ private: // geometry helper
           * vector_cast<Vec>(_m.point(_vh)); // + (1-a)*p
     }
 
-    _m.property( vp_pos_, _vh ) = pos;
+    _pos = pos;
+    return true;
   }
 
 private: // data
@@ -111,6 +111,9 @@ public:
   typedef std::pair< real_t, real_t >             weight_t;
   typedef std::vector< std::pair<real_t,real_t> > weights_t;
 
+  typedef StencilTableT< real_t >                 table_t;
+  typedef typename table_t::Stencil               Stencil;
+
 public:
 
 
@@ -272,6 +275,303 @@ protected:
     return true;
   }
 
+
+  /** Execute one subdivision step out of place.
+   *
+   * Builds the refined mesh with the same vertex numbering as one step
+   * of subdivide(): the old vertices, in odd steps two vertices per
+   * boundary edge, and one vertex per face that is split at its
+   * centroid. The triangles are
+   * computed per old edge as they result from the edge flips and the
+   * mesh is built with PolyConnectivity::add_faces(). _step takes the
+   * role of the generation of subdivide(). Odd steps fail on meshes with
+   * faces that have more than one boundary edge.
+   */
+  bool subdivide_into( const MeshType& _src, MeshType& _dst, size_t _step,
+                       const bool /* _update_points */ = true)
+  {
+    typedef typename MeshType::Point          Point;
+    typedef typename MeshType::VertexHandle   VertexHandle;
+    typedef typename MeshType::HalfedgeHandle HalfedgeHandle;
+    typedef typename MeshType::EdgeHandle     EdgeHandle;
+    typedef typename MeshType::FaceHandle     FaceHandle;
+
+    const bool odd = (_step % 2) != 0;
+    const int  nV  = int(_src.n_vertices());
+    const int  nE  = int(_src.n_edges());
+    const int  nF  = int(_src.n_faces());
+
+    // Number the new vertices and the triangles of each old edge (two if
+    // flipped, one at the boundary)
+    std::vector<int> boundary_offset;
+    std::vector<int> face_point;
+    std::vector<int> triangle_offset(nE+1, 0);
+
+    if (!number_new_vertices(_src, odd, boundary_offset, face_point))
+      return false;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+      triangle_offset[e+1] = _src.is_boundary(EdgeHandle(e)) ? 1 : 2;
+
+    for (int e = 0; e < nE; ++e)
+      triangle_offset[e+1] += triangle_offset[e];
+
+    const int nV2 = face_point[nF];
+    const int nT  = triangle_offset[nE];
+
+    std::vector<Point> points(nV2);
+
+    // relaxation of the old vertices
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV; ++v)
+    {
+      const VertexHandle vh(v);
+      Point              pos(_src.point(vh));
+
+      if ( _src.is_boundary(vh) )
+      {
+        const HalfedgeHandle heh = _src.halfedge_handle(vh);
+        if ( odd && heh.is_valid() )
+        {
+          const HalfedgeHandle prev_heh = _src.prev_halfedge_handle(heh);
+
+          pos  = _src.point(_src.to_vertex_handle(heh));
+          pos += _src.point(_src.from_vertex_handle(prev_heh));
+          pos *= real_t(4.0);
+
+          pos += real_t(19.0) * _src.point( vh );
+          pos *= _1over27;
+        }
+      }
+      else
+      {
+        size_t valence=0;
+
+        pos = Point(0,0,0);
+        for (typename MeshType::ConstVertexVertexIter vvit = _src.cvv_iter(vh); vvit.is_valid(); ++vvit)
+        {
+          pos += _src.point( *vvit );
+          ++valence;
+        }
+        pos *= weights_[ valence ].second;
+        pos += weights_[ valence ].first * _src.point(vh);
+      }
+      points[v] = pos;
+    }
+
+    // new boundary points, see compute_new_boundary_points()
+    if (odd)
+    {
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (int e = 0; e < nE; ++e)
+      {
+        if (boundary_offset[e+1] == boundary_offset[e])
+          continue;
+
+        const EdgeHandle     eh(e);
+        const HalfedgeHandle heh = _src.halfedge_handle(eh, _src.is_boundary(_src.halfedge_handle(eh,1)));
+
+        const Point P1 = _src.point(_src.to_vertex_handle( _src.next_halfedge_handle( heh ) ));
+        const Point P2 = _src.point(_src.to_vertex_handle( heh ));
+        const Point P3 = _src.point(_src.from_vertex_handle( heh ));
+        const Point P4 = _src.point(_src.from_vertex_handle( _src.prev_halfedge_handle( heh ) ));
+
+        points[nV + boundary_offset[e]]     = (P1 + real_t(16.0f) * P2 + real_t(10.0f) * P3) * _1over27;
+        points[nV + boundary_offset[e] + 1] = ( real_t(10.0f) * P2 + real_t(16.0f) * P3 + P4) * _1over27;
+      }
+    }
+
+    // face points
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int f = 0; f < nF; ++f)
+    {
+      if (face_point[f+1] == face_point[f])
+        continue;
+
+      typename MeshType::ConstFaceVertexIter fvit = _src.cfv_iter(FaceHandle(f));
+      Point pos;
+      pos  = _src.point(  *fvit);
+      pos += _src.point(*(++fvit));
+      pos += _src.point(*(++fvit));
+      pos *= _1over3;
+      points[face_point[f]] = pos;
+    }
+
+    // triangles after the flips, the vertex opposite of each old halfedge
+    // is the face point or, in faces split at the boundary, the new
+    // boundary vertex next to it
+    std::vector<VertexHandle> vhandles(3*size_t(nT));
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+    {
+      const HalfedgeHandle heh(2*e), opp_heh(2*e+1);
+      VertexHandle*        t = &vhandles[3*size_t(triangle_offset[e])];
+
+      if (_src.is_boundary(EdgeHandle(e)))
+      {
+        const HalfedgeHandle h = _src.is_boundary(heh) ? opp_heh : heh;
+
+        if (odd)
+        {
+          // P2->P3 split into P2->pl->pr->P3, center triangle towards the apex
+          t[0] = VertexHandle(nV + boundary_offset[e]);
+          t[1] = VertexHandle(nV + boundary_offset[e] + 1);
+          t[2] = _src.to_vertex_handle(_src.next_halfedge_handle(h));
+        }
+        else
+        {
+          t[0] = _src.from_vertex_handle(h);
+          t[1] = _src.to_vertex_handle(h);
+          t[2] = opposite_vertex(_src, h, boundary_offset, face_point);
+        }
+      }
+      else
+      {
+        const VertexHandle x   = opposite_vertex(_src, heh,     boundary_offset, face_point);
+        const VertexHandle opp = opposite_vertex(_src, opp_heh, boundary_offset, face_point);
+
+        t[0] = _src.from_vertex_handle(heh);
+        t[1] = opp;
+        t[2] = x;
+        t[3] = opp;
+        t[4] = _src.to_vertex_handle(heh);
+        t[5] = x;
+      }
+    }
+
+    _dst.clear();
+    _dst.resize(nV2, 0, 0);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV2; ++v)
+      _dst.set_point(VertexHandle(v), points[v]);
+
+    const std::vector<unsigned int> sizes(nT, 3u);
+
+    return nT == 0 ||
+           _dst.add_faces(&vhandles[0], &sizes[0], size_t(nT)) == size_t(nT);
+  }
+
+
+  /// Compute the stencils of one subdivide_into() step.
+  bool subdivide_stencils( const MeshType& _src, size_t _step,
+                           std::vector<Stencil>& _stencils,
+                           const bool /* _update_points */ = true)
+  {
+    typedef typename MeshType::VertexHandle   VertexHandle;
+    typedef typename MeshType::HalfedgeHandle HalfedgeHandle;
+    typedef typename MeshType::EdgeHandle     EdgeHandle;
+    typedef typename MeshType::FaceHandle     FaceHandle;
+    typedef typename table_t::Entry           Entry;
+
+    const bool odd = (_step % 2) != 0;
+    const int  nV  = int(_src.n_vertices());
+    const int  nE  = int(_src.n_edges());
+    const int  nF  = int(_src.n_faces());
+
+    std::vector<int> boundary_offset;
+    std::vector<int> face_point;
+
+    if (!number_new_vertices(_src, odd, boundary_offset, face_point))
+      return false;
+
+    _stencils.assign(face_point[nF], Stencil());
+
+    // relaxation of the old vertices
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int v = 0; v < nV; ++v)
+    {
+      const VertexHandle vh(v);
+      Stencil&           s = _stencils[v];
+
+      if ( _src.is_boundary(vh) )
+      {
+        const HalfedgeHandle heh = _src.halfedge_handle(vh);
+        if ( odd && heh.is_valid() )
+        {
+          const HalfedgeHandle prev_heh = _src.prev_halfedge_handle(heh);
+
+          s.push_back(Entry(_src.to_vertex_handle(heh).idx(),        real_t(4.0) * _1over27));
+          s.push_back(Entry(_src.from_vertex_handle(prev_heh).idx(), real_t(4.0) * _1over27));
+          s.push_back(Entry(v,                                       real_t(19.0) * _1over27));
+        }
+        else
+          s.push_back(Entry(v, real_t(1.0)));
+      }
+      else
+      {
+        const size_t valence = _src.valence(vh);
+
+        for (typename MeshType::ConstVertexVertexIter vvit = _src.cvv_iter(vh); vvit.is_valid(); ++vvit)
+          s.push_back(Entry(vvit->idx(), weights_[ valence ].second));
+        s.push_back(Entry(v, weights_[ valence ].first));
+      }
+    }
+
+    // new boundary points
+    if (odd)
+    {
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (int e = 0; e < nE; ++e)
+      {
+        if (boundary_offset[e+1] == boundary_offset[e])
+          continue;
+
+        const EdgeHandle     eh(e);
+        const HalfedgeHandle heh = _src.halfedge_handle(eh, _src.is_boundary(_src.halfedge_handle(eh,1)));
+
+        const int P1 = _src.to_vertex_handle( _src.next_halfedge_handle( heh ) ).idx();
+        const int P2 = _src.to_vertex_handle( heh ).idx();
+        const int P3 = _src.from_vertex_handle( heh ).idx();
+        const int P4 = _src.from_vertex_handle( _src.prev_halfedge_handle( heh ) ).idx();
+
+        Stencil& l = _stencils[nV + boundary_offset[e]];
+        l.push_back(Entry(P1, _1over27));
+        l.push_back(Entry(P2, real_t(16.0) * _1over27));
+        l.push_back(Entry(P3, real_t(10.0) * _1over27));
+
+        Stencil& r = _stencils[nV + boundary_offset[e] + 1];
+        r.push_back(Entry(P2, real_t(10.0) * _1over27));
+        r.push_back(Entry(P3, real_t(16.0) * _1over27));
+        r.push_back(Entry(P4, _1over27));
+      }
+    }
+
+    // face points
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int f = 0; f < nF; ++f)
+    {
+      if (face_point[f+1] == face_point[f])
+        continue;
+
+      Stencil& s = _stencils[face_point[f]];
+      for (typename MeshType::ConstFaceVertexIter fvit = _src.cfv_iter(FaceHandle(f)); fvit.is_valid(); ++fvit)
+        s.push_back(Entry(fvit->idx(), _1over3));
+    }
+
+    return true;
+  }
+
 private:
 
   /// Helper functor to compute weights for sqrt(3)-subdivision
@@ -296,6 +596,78 @@ private:
 
 private:
 
+  /** Number the vertices added by subdivide_into(): two per boundary edge
+   *  in odd steps, starting at n_vertices() (_boundary_offset[e] for edge
+   *  e), followed by the face points (_face_point[f] for face f, faces
+   *  split at the boundary get none). Both arrays hold one more entry
+   *  than elements. Returns false for odd steps on meshes with faces that
+   *  have more than one boundary edge.
+   */
+  bool number_new_vertices( const MeshType& _m, bool _odd,
+                            std::vector<int>& _boundary_offset,
+                            std::vector<int>& _face_point ) const
+  {
+    const int nV = int(_m.n_vertices());
+    const int nE = int(_m.n_edges());
+    const int nF = int(_m.n_faces());
+    bool      ok = true;
+
+    _boundary_offset.assign(nE+1, 0);
+    _face_point.assign(nF+1, 0);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int e = 0; e < nE; ++e)
+      _boundary_offset[e+1] = (_odd && _m.is_boundary(typename MeshType::EdgeHandle(e))) ? 2 : 0;
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static) reduction(&&:ok)
+#endif
+    for (int f = 0; f < nF; ++f)
+    {
+      int n_boundary = 0;
+      for (typename MeshType::ConstFaceHalfedgeIter fh_it = _m.cfh_iter(typename MeshType::FaceHandle(f)); fh_it.is_valid(); ++fh_it)
+        if (_m.is_boundary(_m.opposite_halfedge_handle(*fh_it)))
+          ++n_boundary;
+      _face_point[f+1] = (_odd && n_boundary) ? 0 : 1;
+      ok = ok && (!_odd || n_boundary < 2);
+    }
+
+    if (!ok)
+      return false;
+
+    for (int e = 0; e < nE; ++e)
+      _boundary_offset[e+1] += _boundary_offset[e];
+
+    _face_point[0] = nV + _boundary_offset[nE];
+    for (int f = 0; f < nF; ++f)
+      _face_point[f+1] += _face_point[f];
+
+    return true;
+  }
+
+  /// Vertex of the refined face of _heh opposite of the old edge, see subdivide_into()
+  typename MeshType::VertexHandle
+  opposite_vertex( const MeshType& _m, const typename MeshType::HalfedgeHandle& _heh,
+                   const std::vector<int>& _boundary_offset,
+                   const std::vector<int>& _face_point ) const
+  {
+    const int f = _m.face_handle(_heh).idx();
+
+    if (_face_point[f+1] != _face_point[f])
+      return typename MeshType::VertexHandle(_face_point[f]);
+
+    // face split at its boundary edge P2->P3, _heh is P3->P5 or P5->P2
+    typename MeshType::HalfedgeHandle next = _m.next_halfedge_handle(_heh);
+    const bool                        left = _m.is_boundary(_m.opposite_halfedge_handle(next));
+    const typename MeshType::HalfedgeHandle
+      boundary = left ? next : _m.prev_halfedge_handle(_heh);
+    const int e = _m.edge_handle(boundary).idx();
+
+    return typename MeshType::VertexHandle(_m.n_vertices() + _boundary_offset[e] + (left ? 0 : 1));
+  }
+
   // Pre-compute location of new boundary points for odd generations
   // and store them in the edge property ep_nv_;
   void compute_new_boundary_points( MeshType& _m, 
@@ -0,0 +1,360 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file StencilTableT.hh
+    Sparse tables mapping control points to refined points
+ */
+
+//=============================================================================
+//
+//  CLASS StencilTableT
+//
+//=============================================================================
+
+#ifndef OPENMESH_SUBDIVIDER_UNIFORM_STENCILTABLET_HH
+#define OPENMESH_SUBDIVIDER_UNIFORM_STENCILTABLET_HH
+
+//== INCLUDE ==================================================================
+
+#include <OpenMesh/Core/System/config.hh>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh   {
+namespace Subdivider {
+namespace Uniform    {
+
+
+//== CLASS DEFINITION =========================================================
+
+/** Sparse matrix holding one stencil per refined vertex.
+ *
+ *  The stencil of a refined vertex lists the control vertices it depends
+ *  on and their weights, so its position is the weighted sum of the
+ *  control points. The table is stored row by row (compressed sparse
+ *  rows) in separate index and weight arrays.
+ *
+ *  Uniform subdivision schemes are linear in the points as long as the
+ *  topology does not change. SubdividerT::compute_stencils() builds the
+ *  table of \c n steps once; afterwards update_points() evaluates the
+ *  refined positions for new control points in a single pass, in
+ *  parallel if OpenMP is available.
+ *
+ *  \see SubdividerT::compute_stencils()
+ */
+template <typename RealType=float>
+class StencilTableT
+{
+public:
+
+  typedef RealType real_t;
+
+  /// A control vertex with its weight
+  struct Entry
+  {
+    Entry() : idx(-1), weight(0) { }
+    Entry(int _idx, real_t _weight) : idx(_idx), weight(_weight) { }
+
+    bool operator<(const Entry& _rhs) const { return idx < _rhs.idx; }
+
+    int    idx;
+    real_t weight;
+  };
+
+  /// Stencil of one refined vertex while building a table
+  typedef std::vector<Entry> Stencil;
+
+public:
+
+  /// Empty table
+  StencilTableT() : n_control_(0), offsets_(1, 0) { }
+
+  /// Number of stencils (refined vertices)
+  size_t n_stencils() const { return offsets_.size()-1; }
+
+  /// Number of control vertices
+  size_t n_control() const { return n_control_; }
+
+  /// Number of non-zero weights
+  size_t n_entries() const { return indices_.size(); }
+
+  /// Number of control vertices in stencil \c _i
+  size_t size(size_t _i) const { return size_t(offsets_[_i+1] - offsets_[_i]); }
+
+  /// Control vertex indices of stencil \c _i
+  const int* indices(size_t _i) const
+  { return indices_.empty() ? NULL : &indices_[0] + offsets_[_i]; }
+
+  /// Weights of stencil \c _i
+  const real_t* weights(size_t _i) const
+  { return weights_.empty() ? NULL : &weights_[0] + offsets_[_i]; }
+
+  /// Remove all stencils
+  void clear()
+  {
+    n_control_ = 0;
+    offsets_.assign(1, 0);
+    indices_.clear();
+    weights_.clear();
+  }
+
+  /// Each of the \c _n vertices depends only on itself
+  void set_identity(size_t _n)
+  {
+    n_control_ = _n;
+    offsets_.resize(_n+1);
+    indices_.resize(_n);
+    weights_.assign(_n, real_t(1));
+
+    for (size_t i = 0; i <= _n; ++i)
+      offsets_[i] = int(i);
+    for (size_t i = 0; i < _n; ++i)
+      indices_[i] = int(i);
+  }
+
+  /** Build the table from one stencil per refined vertex. The entries of
+   *  each stencil are sorted by index, entries with the same index are
+   *  summed up and zero weights are removed. \c _stencils is modified.
+   */
+  void set(size_t _n_control, std::vector<Stencil>& _stencils)
+  {
+    const int n = int(_stencils.size());
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (int i = 0; i < n; ++i)
+      merge(_stencils[i]);
+
+    n_control_ = _n_control;
+    offsets_.resize(n+1);
+    offsets_[0] = 0;
+    for (int i = 0; i < n; ++i)
+      offsets_[i+1] = offsets_[i] + int(_stencils[i].size());
+
+    indices_.resize(offsets_[n]);
+    weights_.resize(offsets_[n]);
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 1024)
+#endif
+    for (int i = 0; i < n; ++i)
+    {
+      int j = offsets_[i];
+      for (typename Stencil::const_iterator it = _stencils[i].begin(); it != _stencils[i].end(); ++it, ++j)
+      {
+        assert(it->idx >= 0 && size_t(it->idx) < n_control_);
+        indices_[j] = it->idx;
+        weights_[j] = it->weight;
+      }
+    }
+  }
+
+  /** Replace the table by the product \c _next * this, i.e. the stencils
+   *  of \c _next refer to the vertices refined by this table, the result
+   *  to the control vertices of this table.
+   */
+  void compose(const StencilTableT& _next)
+  {
+    assert(_next.n_control() == n_stencils());
+
+    const int            n = int(_next.n_stencils());
+    std::vector<Stencil> stencils(n);
+
+#ifdef _OPENMP
+    #pragma omp parallel
+#endif
+    {
+      // dense accumulator, position of each control vertex in the current row
+      std::vector<int> pos(n_control_, -1);
+
+#ifdef _OPENMP
+      #pragma omp for schedule(dynamic, 1024)
+#endif
+      for (int i = 0; i < n; ++i)
+      {
+        Stencil&       s      = stencils[i];
+        const int*     idx    = _next.indices(i);
+        const real_t*  weight = _next.weights(i);
+
+        for (size_t k = 0; k < _next.size(i); ++k)
+        {
+          for (int j = offsets_[idx[k]]; j < offsets_[idx[k]+1]; ++j)
+          {
+            int& p = pos[indices_[j]];
+            if (p < 0)
+            {
+              p = int(s.size());
+              s.push_back(Entry(indices_[j], real_t(0)));
+            }
+            s[p].weight += weight[k] * weights_[j];
+          }
+        }
+
+        for (typename Stencil::const_iterator it = s.begin(); it != s.end(); ++it)
+          pos[it->idx] = -1;
+      }
+    }
+
+    set(n_control_, stencils);
+  }
+
+  /** Evaluate the stencils for the control points \c _control (n_control()
+   *  points) and write the results to \c _refined (n_stencils() points).
+   *  Empty stencils give the zero vector.
+   */
+  template <typename Point>
+  void apply(const Point* _control, Point* _refined) const
+  {
+    typedef typename Point::value_type Scalar;
+
+    const int n = int(n_stencils());
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; ++i)
+    {
+      const int b = offsets_[i];
+      const int e = offsets_[i+1];
+
+      // an empty stencil evaluates to the zero vector
+      Point p;
+      p.vectorize(Scalar(0));
+      for (int j = b; j < e; ++j)
+        p += _control[indices_[j]] * Scalar(weights_[j]);
+      _refined[i] = p;
+    }
+  }
+
+  /// Same as above for vectors, \c _refined is resized to n_stencils()
+  template <typename Point>
+  void apply(const std::vector<Point>& _control, std::vector<Point>& _refined) const
+  {
+    assert(_control.size() == n_control_);
+    _refined.resize(n_stencils());
+    if (!_refined.empty())
+      apply(&_control[0], &_refined[0]);
+  }
+
+  /** Set the points of \c _refined from the points of \c _control. The
+   *  meshes must have n_control() and n_stencils() vertices, e.g. the
+   *  meshes passed to SubdividerT::compute_stencils().
+   */
+  template <typename Mesh>
+  void update_points(const Mesh& _control, Mesh& _refined) const
+  {
+    typedef typename Mesh::Point              Point;
+    typedef typename Mesh::VertexHandle       VertexHandle;
+    typedef typename Point::value_type        Scalar;
+
+    assert(_control.n_vertices() == n_control_);
+    assert(_refined.n_vertices() == n_stencils());
+
+    const int n = int(n_stencils());
+
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < n; ++i)
+    {
+      const int b = offsets_[i];
+      const int e = offsets_[i+1];
+
+      Point p;
+      p.vectorize(Scalar(0));
+      for (int j = b; j < e; ++j)
+        p += _control.point(VertexHandle(indices_[j])) * Scalar(weights_[j]);
+      _refined.set_point(VertexHandle(i), p);
+    }
+  }
+
+  /// Append \c _src scaled by \c _scale to \c _dst
+  static void append(Stencil& _dst, const Stencil& _src, real_t _scale)
+  {
+    for (typename Stencil::const_iterator it = _src.begin(); it != _src.end(); ++it)
+      _dst.push_back(Entry(it->idx, it->weight * _scale));
+  }
+
+private:
+
+  /// Sort by index, sum up duplicates and remove zero weights
+  static void merge(Stencil& _s)
+  {
+    std::sort(_s.begin(), _s.end());
+
+    typename Stencil::iterator out = _s.begin();
+    for (typename Stencil::const_iterator it = _s.begin(); it != _s.end(); )
+    {
+      Entry e = *it;
+      for (++it; it != _s.end() && it->idx == e.idx; ++it)
+        e.weight += it->weight;
+      if (e.weight != real_t(0))
+        *out++ = e;
+    }
+    _s.erase(out, _s.end());
+  }
+
+private:
+
+  size_t              n_control_;
+  std::vector<int>    offsets_;
+  std::vector<int>    indices_;
+  std::vector<real_t> weights_;
+};
+
+//=============================================================================
+} // namespace Uniform
+} // namespace Subdivider
+} // namespace OpenMesh
+//=============================================================================
+#endif // OPENMESH_SUBDIVIDER_UNIFORM_STENCILTABLET_HH
+//=============================================================================
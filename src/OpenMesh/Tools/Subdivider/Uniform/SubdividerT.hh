@@ -63,6 +63,7 @@
 
 #include <OpenMesh/Core/System/config.hh>
 #include <OpenMesh/Core/Utils/Noncopyable.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/StencilTableT.hh>
 #if defined(_DEBUG) || defined(DEBUG)
 // Makes life lot easier, when playing/messing around with low-level topology
 // changing methods of OpenMesh
@@ -89,6 +90,9 @@ namespace Uniform    {
  *  -# prepare()
  *  -# subdivide()
  *  -# cleanup()
+ *
+ *  and may overload subdivide_into() to support out of place subdivision
+ *  and subdivide_stencils() to support stencil tables.
  */
 template <typename MeshType, typename RealType=float>
 class SubdividerT : private Utils::Noncopyable
@@ -168,6 +172,108 @@ public: /// \name Interface 2
   }
   //@}
 
+public: /// \name Interface 3
+  //@{
+  /** Subdivide \c _src \c _n times into \c _dst (out of place).
+   *
+   * Each step builds the refined mesh in one pass into a cleared mesh,
+   * the indices of the new elements are computed from the indices of
+   * their parents and the refinement runs in parallel if OpenMP is
+   * available. _src is not modified and must not contain deleted
+   * elements. _dst keeps its properties, but not their values.
+   *
+   * @return false if the algorithm does not support this interface
+   *         (see subdivide_into()) or cannot handle the mesh
+   */
+  bool operator()( const MeshType& _src, MeshType& _dst, size_t _n,
+                   const bool _update_points = true )
+  {
+    if ( _n == 0 )
+    {
+      if ( &_src != &_dst )
+        _dst = _src;
+      return true;
+    }
+
+    // refine alternately into _dst and tmp, so that the last step ends in _dst
+    MeshType        tmp;
+    MeshType        copy;
+    const MeshType* src = &_src;
+
+    if ( &_src == &_dst && _n % 2 == 1 )
+    {
+      copy = _src;
+      src  = &copy;
+    }
+
+    for ( size_t i = 0; i < _n; ++i )
+    {
+      MeshType& dst = ( (_n - i) % 2 == 1 ) ? _dst : tmp;
+      if ( !subdivide_into( *src, dst, i, _update_points ) )
+        return false;
+      src = &dst;
+    }
+    return true;
+  }
+  //@}
+
+public: /// \name Interface 4
+  //@{
+  /** Precompute the stencils of \c _n out of place steps.
+   *
+   * \c _refined gets the result of operator()(_control, _refined, _n) and
+   * \c _stencils the weights of the control vertices for each vertex of
+   * \c _refined. As long as only the points of \c _control change,
+   * \c _stencils.update_points(_control, _refined) gives the same points
+   * as subdividing again, without touching the topology.
+   *
+   * @return false if the algorithm does not support this interface
+   *         (see subdivide_stencils()) or cannot handle the mesh
+   */
+  bool compute_stencils( const MeshType& _control, MeshType& _refined,
+                         StencilTableT<RealType>& _stencils, size_t _n,
+                         const bool _update_points = true )
+  {
+    typedef typename StencilTableT<RealType>::Stencil Stencil;
+
+    _stencils.set_identity( _control.n_vertices() );
+
+    if ( _n == 0 )
+    {
+      if ( &_control != &_refined )
+        _refined = _control;
+      return true;
+    }
+
+    MeshType                tmp;
+    MeshType                copy;
+    const MeshType*         src = &_control;
+    std::vector<Stencil>    stencils;
+    StencilTableT<RealType> level;
+
+    if ( &_control == &_refined && _n % 2 == 1 )
+    {
+      copy = _control;
+      src  = &copy;
+    }
+
+    for ( size_t i = 0; i < _n; ++i )
+    {
+      MeshType& dst = ( (_n - i) % 2 == 1 ) ? _refined : tmp;
+
+      if ( !subdivide_stencils( *src, i, stencils, _update_points ) )
+        return false;
+      level.set( src->n_vertices(), stencils );
+      _stencils.compose( level );
+
+      if ( !subdivide_into( *src, dst, i, _update_points ) )
+        return false;
+      src = &dst;
+    }
+    return true;
+  }
+  //@}
+
 protected: 
 
   /// \name Overload theses methods
@@ -180,6 +286,21 @@ protected:
 
   /// Cleanup mesh after usage, e.g. remove added properties
   virtual bool cleanup( MeshType& _m ) = 0;
+
+  /** Refine \c _src once into \c _dst, used by interface 3. \c _step
+   *  counts the steps of the current call, starting at 0. The default
+   *  does not support out of place subdivision and returns false. */
+  virtual bool subdivide_into( const MeshType& /* _src */, MeshType& /* _dst */,
+                               size_t /* _step */, const bool /* _update_points */ )
+  { return false; }
+
+  /** Compute the stencils of one subdivide_into() step, one per vertex of
+   *  the refined mesh, in terms of the vertices of \c _src. The default
+   *  does not support stencils and returns false. */
+  virtual bool subdivide_stencils( const MeshType& /* _src */, size_t /* _step */,
+                                   std::vector< typename StencilTableT<RealType>::Stencil >& /* _stencils */,
+                                   const bool /* _update_points */ )
+  { return false; }
   //@}
 
 private:
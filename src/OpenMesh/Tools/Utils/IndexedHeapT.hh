@@ -0,0 +1,403 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+/** \file Tools/Utils/IndexedHeapT.hh
+    A d-ary heap that stores keys and positions in compact arrays
+**/
+
+//=============================================================================
+//
+//  CLASS IndexedHeapT
+//
+//=============================================================================
+
+#ifndef OPENMESH_UTILS_INDEXEDHEAPT_HH
+#define OPENMESH_UTILS_INDEXEDHEAPT_HH
+
+
+//== INCLUDES =================================================================
+
+#include "Config.hh"
+#include <vector>
+#include <iterator>
+#include <cassert>
+#include <OpenMesh/Core/System/omstream.hh>
+
+//== NAMESPACE ================================================================
+
+namespace OpenMesh { // BEGIN_NS_OPENMESH
+namespace Utils { // BEGIN_NS_UTILS
+
+//== CLASS DEFINITION =========================================================
+
+
+/** \class IndexedHeapT IndexedHeapT.hh <OpenMesh/Tools/Utils/IndexedHeapT.hh>
+ *
+ *  A d-ary min heap with the same interface as HeapT.
+ *
+ *  In contrast to HeapT the key of every entry is copied into the heap
+ *  array next to the entry, and the heap positions are kept in a side
+ *  array indexed by \c HeapEntry::idx(). Sifting an entry up or down
+ *  therefore never calls the HeapInterface; the interface is only asked
+ *  for the key when an entry is inserted or updated. A larger arity
+ *  (default 4) makes the heap shallower and keeps the children of a
+ *  node in one cache line.
+ *
+ *  The entries have to provide an \c idx() method returning a small
+ *  non-negative integer, e.g. the mesh handles. The HeapInterface has
+ *  to provide
+ *  \code
+ *  Key get_key(const HeapEntry& _e);
+ *  \endcode
+ *  Unlike for HeapT, no get_heap_position() and set_heap_position()
+ *  methods are needed.
+ *
+ *  Additionally to HeapT the heap can be built from a range of entries
+ *  in linear time (build()) and several entries can be updated at once
+ *  (update(_begin, _end)), where each entry may occur only once.
+ *
+ *  \see HeapT, Decimater::DecimaterT
+ */
+template <class HeapEntry, class HeapInterface, class Key = float, unsigned int Arity = 4>
+class IndexedHeapT
+{
+public:
+
+  /// Constructor
+  IndexedHeapT() {}
+
+  /// Construct with a given \c HeapIterface.
+  IndexedHeapT(const HeapInterface& _interface)
+  : interface_(_interface)
+  {}
+
+  /// Destructor.
+  ~IndexedHeapT() {}
+
+
+  /// clear the heap
+  void clear()
+  {
+    for (size_t i = 0; i < nodes_.size(); ++i)
+      pos_[nodes_[i].entry.idx()] = -1;
+    nodes_.clear();
+  }
+
+  /// is heap empty?
+  bool empty() const { return nodes_.empty(); }
+
+  /// returns the size of heap
+  size_t size() const { return nodes_.size(); }
+
+  /// reserve space for _n entries
+  void reserve(size_t _n) { nodes_.reserve(_n); pos_.reserve(_n); }
+
+  /// reset heap position to -1 (not in heap)
+  void reset_heap_position(HeapEntry _h)
+  {
+    if (size_t(_h.idx()) < pos_.size())
+      pos_[_h.idx()] = -1;
+  }
+
+  /// is an entry in the heap?
+  bool is_stored(HeapEntry _h) const { return position(_h) != -1; }
+
+  /// insert the entry _h with the key given by the HeapInterface
+  void insert(HeapEntry _h) { insert(_h, interface_.get_key(_h)); }
+
+  /// insert the entry _h with key _key
+  void insert(HeapEntry _h, Key _key)
+  {
+    assert(!is_stored(_h));
+    nodes_.push_back(Node(_key, _h));
+    upheap(size()-1);
+  }
+
+  /// get the first entry
+  HeapEntry front() const
+  {
+    assert(!empty());
+    return nodes_[0].entry;
+  }
+
+  /// get the key of the first entry
+  Key front_key() const
+  {
+    assert(!empty());
+    return nodes_[0].key;
+  }
+
+  /// delete the first entry
+  void pop_front()
+  {
+    assert(!empty());
+    reset_heap_position(nodes_[0].entry);
+    if (size() > 1)
+    {
+      nodes_[0] = nodes_.back();
+      nodes_.pop_back();
+      downheap(0);
+    }
+    else
+    {
+      nodes_.pop_back();
+    }
+  }
+
+  /// remove an entry
+  void remove(HeapEntry _h)
+  {
+    int pos = position(_h);
+    reset_heap_position(_h);
+
+    assert(pos != -1);
+    assert((unsigned int) pos < size());
+
+    // last item ?
+    if ((unsigned int) pos == size()-1)
+    {
+      nodes_.pop_back();
+    }
+    else
+    {
+      const Key old_key = nodes_[pos].key;
+      nodes_[pos] = nodes_.back(); // move last elem to pos
+      nodes_.pop_back();
+      if (nodes_[pos].key < old_key)
+        upheap(pos);
+      else
+        downheap(pos);
+    }
+  }
+
+  /** update an entry: fetch the new key from the HeapInterface and
+      update the position to reestablish the heap property.
+  */
+  void update(HeapEntry _h) { update(_h, interface_.get_key(_h)); }
+
+  /// update an entry to the new key _key
+  void update(HeapEntry _h, Key _key)
+  {
+    int pos = position(_h);
+    assert(pos != -1);
+    assert((unsigned int)pos < size());
+
+    const Key old_key = nodes_[pos].key;
+    nodes_[pos].key = _key;
+    if (_key < old_key)
+      upheap(pos);
+    else
+      downheap(pos);
+  }
+
+  /** Build the heap from the entries in [_begin, _end) in linear time.
+      Entries stored before are removed. */
+  template <class InputIterator>
+  void build(InputIterator _begin, InputIterator _end)
+  {
+    clear();
+    for (; _begin != _end; ++_begin)
+      nodes_.push_back(Node(interface_.get_key(*_begin), *_begin));
+    heapify();
+  }
+
+  /** Insert or update all entries in [_begin, _end). If the range is
+      large compared to the heap, the keys are changed in place and the
+      heap is rebuilt in linear time instead of sifting every entry. */
+  template <class ForwardIterator>
+  void update(ForwardIterator _begin, ForwardIterator _end)
+  {
+    const size_t n = std::distance(_begin, _end);
+
+    // cost of n single updates vs. rebuilding the heap
+    size_t depth = 1;
+    for (size_t s = size(); s >= Arity; s /= Arity)
+      ++depth;
+
+    if (n * depth <= size())
+    {
+      for (; _begin != _end; ++_begin)
+      {
+        if (is_stored(*_begin))
+          update(*_begin);
+        else
+          insert(*_begin);
+      }
+      return;
+    }
+
+    for (; _begin != _end; ++_begin)
+    {
+      const int pos = position(*_begin);
+      if (pos != -1)
+        nodes_[pos].key = interface_.get_key(*_begin);
+      else
+        nodes_.push_back(Node(interface_.get_key(*_begin), *_begin));
+    }
+    heapify();
+  }
+
+  /// check heap condition
+  bool check() const
+  {
+    bool ok(true);
+    for (size_t i=0; i<size(); ++i)
+    {
+      if (position(nodes_[i].entry) != int(i))
+      {
+        omerr() << "Heap position wrong\n";
+        ok=false;
+      }
+      if ((i > 0) && (nodes_[i].key < nodes_[parent(i)].key))
+      {
+        omerr() << "Heap condition violated\n";
+        ok=false;
+      }
+    }
+    return ok;
+  }
+
+protected:
+  /// Instance of HeapInterface
+  HeapInterface interface_;
+
+private:
+
+  /// Entry together with its key
+  struct Node
+  {
+    Node(Key _key, HeapEntry _entry) : key(_key), entry(_entry) {}
+    Key       key;
+    HeapEntry entry;
+  };
+
+  /// Get the heap position of _h, -1 if not in heap
+  inline int position(HeapEntry _h) const
+  {
+    return (size_t(_h.idx()) < pos_.size()) ? pos_[_h.idx()] : -1;
+  }
+
+  /// Set node _n to index _idx and store its heap position
+  inline void place(size_t _idx, const Node& _n)
+  {
+    nodes_[_idx] = _n;
+    if (size_t(_n.entry.idx()) >= pos_.size())
+      pos_.resize(_n.entry.idx()+1, -1);
+    pos_[_n.entry.idx()] = int(_idx);
+  }
+
+  /// Upheap. Establish heap property.
+  void upheap(size_t _idx)
+  {
+    const Node n = nodes_[_idx];
+    size_t     parentIdx;
+
+    while ((_idx>0) && (n.key < nodes_[parentIdx=parent(_idx)].key))
+    {
+      place(_idx, nodes_[parentIdx]);
+      _idx = parentIdx;
+    }
+
+    place(_idx, n);
+  }
+
+  /// Downheap. Establish heap property.
+  void downheap(size_t _idx)
+  {
+    const Node n = nodes_[_idx];
+    const size_t s = size();
+
+    for (;;)
+    {
+      size_t childIdx = first_child(_idx);
+      if (childIdx >= s) break;
+
+      // smallest child
+      const size_t childEnd = (childIdx + Arity < s) ? childIdx + Arity : s;
+      for (size_t c = childIdx + 1; c < childEnd; ++c)
+        if (nodes_[c].key < nodes_[childIdx].key)
+          childIdx = c;
+
+      if (!(nodes_[childIdx].key < n.key)) break;
+
+      place(_idx, nodes_[childIdx]);
+      _idx = childIdx;
+    }
+
+    place(_idx, n);
+  }
+
+  /// Establish the heap property for the whole array (Floyd's method)
+  void heapify()
+  {
+    for (size_t i = 0; i < size(); ++i)
+      place(i, nodes_[i]);
+    for (size_t i = size() / Arity + 1; i-- > 0; )
+      if (first_child(i) < size())
+        downheap(i);
+  }
+
+  /// Get parent's index
+  static inline size_t parent(size_t _i) { return (_i-1) / Arity; }
+  /// Get first child's index
+  static inline size_t first_child(size_t _i) { return _i * Arity + 1; }
+
+  /// heap array
+  std::vector<Node> nodes_;
+
+  /// heap position of each entry, indexed by HeapEntry::idx()
+  std::vector<int>  pos_;
+};
+
+
+//=============================================================================
+} // END_NS_UTILS
+} // END_NS_OPENMESH
+//=============================================================================
+#endif // OPENMESH_UTILS_INDEXEDHEAPT_HH defined
+//=============================================================================
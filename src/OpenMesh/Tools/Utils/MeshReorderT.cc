@@ -0,0 +1,593 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#define OPENMESH_MESHREORDERT_C
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Tools/Utils/MeshReorderT.hh>
+#include <algorithm>
+#include <utility>
+#include <cmath>
+
+
+//== NAMESPACES ============================================================== 
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== IMPLEMENTATION ========================================================== 
+
+
+template <class Mesh>
+bool
+MeshReorderT<Mesh>::
+has_deleted_elements() const
+{
+  if (mesh_.has_vertex_status())
+    for (size_t i=0; i<mesh_.n_vertices(); ++i)
+      if (mesh_.status(VertexHandle(int(i))).deleted()) return true;
+
+  if (mesh_.has_edge_status())
+    for (size_t i=0; i<mesh_.n_edges(); ++i)
+      if (mesh_.status(typename Mesh::EdgeHandle(int(i))).deleted()) return true;
+
+  if (mesh_.has_face_status())
+    for (size_t i=0; i<mesh_.n_faces(); ++i)
+      if (mesh_.status(FaceHandle(int(i))).deleted()) return true;
+
+  return false;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+MeshReorderT<Mesh>::
+compute_order(Order _order,
+              std::vector<int>& _v_new_index,
+              std::vector<int>& _e_new_index,
+              std::vector<int>& _f_new_index) const
+{
+  if (has_deleted_elements())
+    return false;
+
+  switch (_order)
+  {
+    case ORDER_SPACE_FILLING_CURVE:
+      vertex_order_morton(_v_new_index);
+      face_order_by_vertices(_v_new_index, _f_new_index);
+      break;
+
+    case ORDER_BFS:
+      vertex_order_bfs(_v_new_index);
+      face_order_by_vertices(_v_new_index, _f_new_index);
+      break;
+
+    case ORDER_VERTEX_CACHE:
+      face_order_vertex_cache(_f_new_index);
+      vertex_order_by_faces(_f_new_index, _v_new_index);
+      break;
+  }
+
+  edge_order_by_faces(_f_new_index, _e_new_index);
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+bool
+MeshReorderT<Mesh>::
+reorder(Order _order, CacheStatistics* _before, CacheStatistics* _after)
+{
+  if (has_deleted_elements())
+  {
+    omerr() << "MeshReorderT: The mesh contains deleted elements, call garbage_collection() first." << std::endl;
+    return false;
+  }
+
+  if (_before)
+    *_before = estimate();
+
+  std::vector<int> v_new_index, e_new_index, f_new_index;
+  if (!compute_order(_order, v_new_index, e_new_index, f_new_index) ||
+      !mesh_.permute(v_new_index, e_new_index, f_new_index))
+    return false;
+
+  if (_after)
+    *_after = estimate();
+
+  return true;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+typename MeshReorderT<Mesh>::CacheStatistics
+MeshReorderT<Mesh>::
+estimate() const
+{
+  const size_t nV = mesh_.n_vertices();
+  const size_t nE = mesh_.n_edges();
+  const size_t nF = mesh_.n_faces();
+
+  const size_t vertex_size   = sizeof(typename Mesh::Vertex);
+  const size_t point_size    = sizeof(typename Mesh::Point);
+  const size_t halfedge_size = sizeof(typename Mesh::Halfedge);
+  const size_t edge_size     = sizeof(typename Mesh::Edge);
+  const size_t face_size     = sizeof(typename Mesh::Face);
+
+  // lay out the arrays one after the other, each starting on a new line
+  const size_t line = line_size_ ? line_size_ : 1;
+  const size_t vertex_base   = 0;
+  const size_t point_base    = ((vertex_base + nV*vertex_size) / line + 1) * line;
+  const size_t edge_base     = ((point_base  + nV*point_size)  / line + 1) * line;
+  const size_t face_base     = ((edge_base   + nE*edge_size)   / line + 1) * line;
+
+  CacheSimulator cache(cache_size_, line_size_, associativity_);
+
+  CacheStatistics stats;
+  stats.n_faces = nF;
+
+  // FIFO vertex cache: a vertex is cached if it has been inserted less
+  // than vertex_cache_size_ insertions ago
+  std::vector<size_t> inserted(nV, size_t(-1));
+  size_t n_inserted = 0;
+
+  // face traversal: face -> halfedges -> to vertex positions
+  for (size_t i=0; i<nF; ++i)
+  {
+    const FaceHandle fh = FaceHandle(int(i));
+    cache.access(face_base + i*face_size, face_size);
+
+    const HalfedgeHandle start = mesh_.halfedge_handle(fh);
+    HalfedgeHandle hh = start;
+    do
+    {
+      const int vi = mesh_.to_vertex_handle(hh).idx();
+      cache.access(edge_base + size_t(hh.idx())*halfedge_size, halfedge_size);
+      cache.access(point_base + size_t(vi)*point_size, point_size);
+
+      if (inserted[vi] == size_t(-1) || n_inserted - inserted[vi] >= vertex_cache_size_)
+      {
+        ++stats.vertex_cache_misses;
+        inserted[vi] = n_inserted++;
+      }
+
+      hh = mesh_.next_halfedge_handle(hh);
+    } while (hh != start);
+  }
+
+  // vertex traversal: vertex -> outgoing halfedges -> neighbour positions
+  for (size_t i=0; i<nV; ++i)
+  {
+    const VertexHandle vh = VertexHandle(int(i));
+    cache.access(vertex_base + i*vertex_size, vertex_size);
+    cache.access(point_base  + i*point_size,  point_size);
+
+    const HalfedgeHandle start = mesh_.halfedge_handle(vh);
+    if (!start.is_valid())
+      continue;
+
+    HalfedgeHandle hh = start;
+    do
+    {
+      cache.access(edge_base + size_t(hh.idx())*halfedge_size, halfedge_size);
+      cache.access(point_base + size_t(mesh_.to_vertex_handle(hh).idx())*point_size, point_size);
+      hh = mesh_.next_halfedge_handle(mesh_.opposite_halfedge_handle(hh));
+    } while (hh != start);
+  }
+
+  stats.accesses = cache.accesses();
+  stats.misses   = cache.misses();
+
+  return stats;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+vertex_order_morton(std::vector<int>& _v_new_index) const
+{
+  const int nV  = int(mesh_.n_vertices());
+  const int dim = int(Mesh::Point::size_) < 3 ? int(Mesh::Point::size_) : 3;
+
+  _v_new_index.resize(nV);
+  if (nV == 0)
+    return;
+
+  // bounding box
+  double bb_min[3] = { 0.0, 0.0, 0.0 }, bb_max[3] = { 0.0, 0.0, 0.0 };
+  for (int c=0; c<dim; ++c)
+    bb_min[c] = bb_max[c] = double(mesh_.point(VertexHandle(0))[c]);
+  for (int i=1; i<nV; ++i)
+    for (int c=0; c<dim; ++c)
+    {
+      const double x = double(mesh_.point(VertexHandle(i))[c]);
+      bb_min[c] = std::min(bb_min[c], x);
+      bb_max[c] = std::max(bb_max[c], x);
+    }
+
+  // interleave 10 bits per coordinate
+  std::vector< std::pair<unsigned int, int> > codes(nV);
+  for (int i=0; i<nV; ++i)
+  {
+    unsigned int code = 0;
+    for (int c=0; c<dim; ++c)
+    {
+      const double extent = bb_max[c] - bb_min[c];
+      const double t = extent > 0.0 ? (double(mesh_.point(VertexHandle(i))[c]) - bb_min[c]) / extent : 0.0;
+      unsigned int x = std::min(1023u, (unsigned int)(t * 1023.0 + 0.5));
+
+      x = (x | (x << 16)) & 0x030000FFu;
+      x = (x | (x <<  8)) & 0x0300F00Fu;
+      x = (x | (x <<  4)) & 0x030C30C3u;
+      x = (x | (x <<  2)) & 0x09249249u;
+
+      code |= x << c;
+    }
+    codes[i] = std::make_pair(code, i);
+  }
+
+  std::sort(codes.begin(), codes.end());
+
+  for (int i=0; i<nV; ++i)
+    _v_new_index[codes[i].second] = i;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+vertex_order_bfs(std::vector<int>& _v_new_index) const
+{
+  const int nV = int(mesh_.n_vertices());
+
+  // start each component at a vertex of minimal valence
+  std::vector< std::pair<unsigned int, int> > by_valence(nV);
+  for (int i=0; i<nV; ++i)
+    by_valence[i] = std::make_pair(mesh_.valence(VertexHandle(i)), i);
+  std::sort(by_valence.begin(), by_valence.end());
+
+  std::vector<int>  order;
+  std::vector<bool> visited(nV, false);
+  std::vector< std::pair<unsigned int, int> > neighbours;
+
+  order.reserve(nV);
+
+  for (int s=0; s<nV; ++s)
+  {
+    const int start = by_valence[s].second;
+    if (visited[start])
+      continue;
+
+    visited[start] = true;
+    size_t front = order.size();
+    order.push_back(start);
+
+    // Cuthill-McKee: visit the neighbours by increasing valence
+    for (; front < order.size(); ++front)
+    {
+      neighbours.clear();
+      typename Mesh::ConstVertexVertexIter vv_it = mesh_.cvv_iter(VertexHandle(order[front]));
+      for (; vv_it.is_valid(); ++vv_it)
+        if (!visited[vv_it->idx()])
+        {
+          visited[vv_it->idx()] = true;
+          neighbours.push_back(std::make_pair(mesh_.valence(*vv_it), vv_it->idx()));
+        }
+
+      std::sort(neighbours.begin(), neighbours.end());
+      for (size_t j=0; j<neighbours.size(); ++j)
+        order.push_back(neighbours[j].second);
+    }
+  }
+
+  // reverse
+  _v_new_index.resize(nV);
+  for (int i=0; i<nV; ++i)
+    _v_new_index[order[i]] = nV - 1 - i;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+face_order_by_vertices(const std::vector<int>& _v_new_index,
+                       std::vector<int>& _f_new_index) const
+{
+  const int nF = int(mesh_.n_faces());
+
+  std::vector< std::pair<int, int> > keys(nF);
+  for (int i=0; i<nF; ++i)
+  {
+    int key = int(_v_new_index.size());
+    typename Mesh::ConstFaceVertexIter fv_it = mesh_.cfv_iter(FaceHandle(i));
+    for (; fv_it.is_valid(); ++fv_it)
+      key = std::min(key, _v_new_index[fv_it->idx()]);
+    keys[i] = std::make_pair(key, i);
+  }
+
+  std::sort(keys.begin(), keys.end());
+
+  _f_new_index.resize(nF);
+  for (int i=0; i<nF; ++i)
+    _f_new_index[keys[i].second] = i;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+face_order_vertex_cache(std::vector<int>& _f_new_index) const
+{
+  const int nV = int(mesh_.n_vertices());
+  const int nF = int(mesh_.n_faces());
+  const int cache_size = std::max(4, int(vertex_cache_size_));
+
+  _f_new_index.assign(nF, -1);
+  if (nF == 0)
+    return;
+
+  // face -> vertices and vertex -> faces adjacency
+  std::vector<int> fv_offsets(nF+1, 0), fv_indices;
+  std::vector<int> remaining(nV, 0);
+  for (int i=0; i<nF; ++i)
+  {
+    typename Mesh::ConstFaceVertexIter fv_it = mesh_.cfv_iter(FaceHandle(i));
+    for (; fv_it.is_valid(); ++fv_it)
+    {
+      fv_indices.push_back(fv_it->idx());
+      ++remaining[fv_it->idx()];
+    }
+    fv_offsets[i+1] = int(fv_indices.size());
+  }
+
+  std::vector<int> vf_offsets(nV+1, 0), vf_indices(fv_indices.size());
+  for (int i=0; i<nV; ++i)
+    vf_offsets[i+1] = vf_offsets[i] + remaining[i];
+  {
+    std::vector<int> fill(vf_offsets.begin(), vf_offsets.end()-1);
+    for (int i=0; i<nF; ++i)
+      for (int j=fv_offsets[i]; j<fv_offsets[i+1]; ++j)
+        vf_indices[fill[fv_indices[j]]++] = i;
+  }
+
+  // scoring as in Forsyth, "Linear-Speed Vertex Cache Optimisation"
+  std::vector<int>    cache_pos(nV, -1);
+  std::vector<double> vscore(nV, 0.0), fscore(nF, 0.0);
+  int last_face_size = 3;
+
+  struct Score
+  {
+    static double vertex(int _pos, int _remaining, int _last, int _cache_size)
+    {
+      if (_remaining == 0)
+        return -1.0;
+
+      double score = 0.0;
+      if (_pos >= 0)
+      {
+        if (_pos < _last)
+          score = 0.75;
+        else
+          score = std::pow(1.0 - double(_pos - _last) / double(std::max(1, _cache_size - _last)), 1.5);
+      }
+      return score + 2.0 / std::sqrt(double(_remaining));
+    }
+  };
+
+  for (int i=0; i<nV; ++i)
+    vscore[i] = Score::vertex(-1, remaining[i], last_face_size, cache_size);
+  for (int i=0; i<nF; ++i)
+    for (int j=fv_offsets[i]; j<fv_offsets[i+1]; ++j)
+      fscore[i] += vscore[fv_indices[j]];
+
+  std::vector<int> cache, new_cache, touched;
+  int best   = -1;
+  int cursor = 0;
+
+  for (int n_emitted=0; n_emitted<nF; ++n_emitted)
+  {
+    // no candidate from the cache, continue with the next unemitted face
+    if (best == -1)
+    {
+      while (_f_new_index[cursor] != -1) ++cursor;
+      best = cursor;
+    }
+
+    _f_new_index[best] = n_emitted;
+    last_face_size = fv_offsets[best+1] - fv_offsets[best];
+
+    // move the vertices of the face to the front of the LRU cache
+    new_cache.clear();
+    for (int j=fv_offsets[best]; j<fv_offsets[best+1]; ++j)
+    {
+      --remaining[fv_indices[j]];
+      new_cache.push_back(fv_indices[j]);
+    }
+    for (size_t j=0; j<cache.size(); ++j)
+      if (std::find(new_cache.begin(), new_cache.begin() + last_face_size, cache[j]) == new_cache.begin() + last_face_size)
+        new_cache.push_back(cache[j]);
+
+    touched.clear();
+    for (size_t j=0; j<new_cache.size(); ++j)
+    {
+      cache_pos[new_cache[j]] = (int(j) < cache_size) ? int(j) : -1;
+      touched.push_back(new_cache[j]);
+    }
+    if (int(new_cache.size()) > cache_size)
+      new_cache.resize(cache_size);
+    cache.swap(new_cache);
+
+    // rescore the touched vertices and their faces, pick the best face
+    for (size_t j=0; j<touched.size(); ++j)
+    {
+      const int v = touched[j];
+      const double score = Score::vertex(cache_pos[v], remaining[v], last_face_size, cache_size);
+      const double delta = score - vscore[v];
+      vscore[v] = score;
+      for (int k=vf_offsets[v]; k<vf_offsets[v+1]; ++k)
+        fscore[vf_indices[k]] += delta;
+    }
+
+    best = -1;
+    for (size_t j=0; j<cache.size(); ++j)
+    {
+      const int v = cache[j];
+      for (int k=vf_offsets[v]; k<vf_offsets[v+1]; ++k)
+      {
+        const int f = vf_indices[k];
+        if (_f_new_index[f] == -1 && (best == -1 || fscore[f] > fscore[best]))
+          best = f;
+      }
+    }
+  }
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+vertex_order_by_faces(const std::vector<int>& _f_new_index,
+                      std::vector<int>& _v_new_index) const
+{
+  const int nV = int(mesh_.n_vertices());
+  const int nF = int(mesh_.n_faces());
+
+  std::vector<int> face_order(nF);
+  for (int i=0; i<nF; ++i)
+    face_order[_f_new_index[i]] = i;
+
+  _v_new_index.assign(nV, -1);
+  int n = 0;
+
+  for (int i=0; i<nF; ++i)
+  {
+    typename Mesh::ConstFaceVertexIter fv_it = mesh_.cfv_iter(FaceHandle(face_order[i]));
+    for (; fv_it.is_valid(); ++fv_it)
+      if (_v_new_index[fv_it->idx()] == -1)
+        _v_new_index[fv_it->idx()] = n++;
+  }
+
+  // vertices without faces keep their relative order at the end
+  for (int i=0; i<nV; ++i)
+    if (_v_new_index[i] == -1)
+      _v_new_index[i] = n++;
+}
+
+
+//-----------------------------------------------------------------------------
+
+
+template <class Mesh>
+void
+MeshReorderT<Mesh>::
+edge_order_by_faces(const std::vector<int>& _f_new_index,
+                    std::vector<int>& _e_new_index) const
+{
+  const int nE = int(mesh_.n_edges());
+  const int nF = int(mesh_.n_faces());
+
+  std::vector<int> face_order(nF);
+  for (int i=0; i<nF; ++i)
+    face_order[_f_new_index[i]] = i;
+
+  _e_new_index.assign(nE, -1);
+  int n = 0;
+
+  for (int i=0; i<nF; ++i)
+  {
+    typename Mesh::ConstFaceHalfedgeIter fh_it = mesh_.cfh_iter(FaceHandle(face_order[i]));
+    for (; fh_it.is_valid(); ++fh_it)
+    {
+      const int ei = mesh_.edge_handle(*fh_it).idx();
+      if (_e_new_index[ei] == -1)
+        _e_new_index[ei] = n++;
+    }
+  }
+
+  // edges without faces keep their relative order at the end
+  for (int i=0; i<nE; ++i)
+    if (_e_new_index[i] == -1)
+      _e_new_index[i] = n++;
+}
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
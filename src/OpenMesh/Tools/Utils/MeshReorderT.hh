@@ -0,0 +1,269 @@
+/* ========================================================================= *
+ *                                                                           *
+ *                               OpenMesh                                    *
+ *           Copyright (c) 2001-2015, RWTH-Aachen University                 *
+ *           Department of Computer Graphics and Multimedia                  *
+ *                          All rights reserved.                             *
+ *                            www.openmesh.org                               *
+ *                                                                           *
+ *---------------------------------------------------------------------------*
+ * This file is part of OpenMesh.                                            *
+ *---------------------------------------------------------------------------*
+ *                                                                           *
+ * Redistribution and use in source and binary forms, with or without        *
+ * modification, are permitted provided that the following conditions        *
+ * are met:                                                                  *
+ *                                                                           *
+ * 1. Redistributions of source code must retain the above copyright notice, *
+ *    this list of conditions and the following disclaimer.                  *
+ *                                                                           *
+ * 2. Redistributions in binary form must reproduce the above copyright      *
+ *    notice, this list of conditions and the following disclaimer in the    *
+ *    documentation and/or other materials provided with the distribution.   *
+ *                                                                           *
+ * 3. Neither the name of the copyright holder nor the names of its          *
+ *    contributors may be used to endorse or promote products derived from   *
+ *    this software without specific prior written permission.               *
+ *                                                                           *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS       *
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED *
+ * TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A           *
+ * PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER *
+ * OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,  *
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,       *
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR        *
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF    *
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING      *
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS        *
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.              *
+ *                                                                           *
+ * ========================================================================= */
+
+/*===========================================================================*\
+ *                                                                           *             
+ *   $Revision: 1258 $                                                         *
+ *   $Date: 2015-04-28 15:07:46 +0200 (Di, 28 Apr 2015) $                   *
+ *                                                                           *
+\*===========================================================================*/
+
+
+#ifndef OPENMESH_MESHREORDERT_HH
+#define OPENMESH_MESHREORDERT_HH
+
+
+//== INCLUDES =================================================================
+
+
+#include <OpenMesh/Core/System/config.h>
+#include <OpenMesh/Core/System/omstream.hh>
+#include <vector>
+#include <cstddef>
+
+
+//== NAMESPACES ===============================================================
+
+
+namespace OpenMesh {
+namespace Utils {
+
+//== CLASS DEFINITION =========================================================
+
+
+/** Reorder the elements of a mesh for memory locality.
+ *
+ *  Computes a new order of the vertices, edges and faces and applies it
+ *  with ArrayKernel::permute(), which moves all registered properties along
+ *  with their elements. The vertex order is either taken from a space
+ *  filling curve, from a reverse Cuthill-McKee (BFS) traversal, or from a
+ *  vertex cache optimized face order. Faces and edges follow the vertices
+ *  so that traversing the faces touches the vertex and edge arrays mostly
+ *  front to back.
+ *
+ *  estimate() simulates a set associative cache on the memory accesses of
+ *  a face and a vertex one-ring traversal, so the effect of a reordering can
+ *  be reported before and after:
+ *
+ *  \code
+ *  OpenMesh::Utils::MeshReorderT<MyMesh> reorder(mesh);
+ *  OpenMesh::Utils::MeshReorderT<MyMesh>::CacheStatistics before, after;
+ *  reorder.reorder(OpenMesh::Utils::MeshReorderT<MyMesh>::ORDER_VERTEX_CACHE, &before, &after);
+ *  std::cout << before.miss_rate() << " -> " << after.miss_rate() << std::endl;
+ *  \endcode
+ *
+ *  The mesh must not contain deleted elements, call garbage_collection()
+ *  first. All handles held outside the mesh are invalidated by reorder().
+ */
+template <class Mesh>
+class MeshReorderT
+{
+public:
+
+  typedef typename Mesh::VertexHandle   VertexHandle;
+  typedef typename Mesh::HalfedgeHandle HalfedgeHandle;
+  typedef typename Mesh::FaceHandle     FaceHandle;
+
+  /// How to compute the new vertex order
+  enum Order
+  {
+    ORDER_SPACE_FILLING_CURVE, ///< Morton (Z-order) curve over the vertex positions
+    ORDER_BFS,                 ///< Reverse Cuthill-McKee order of the vertex graph
+    ORDER_VERTEX_CACHE         ///< Vertex cache optimized face order, vertices by first use
+  };
+
+  /// Result of estimate()
+  struct CacheStatistics
+  {
+    CacheStatistics() : accesses(0), misses(0), n_faces(0), vertex_cache_misses(0) {}
+
+    /// Simulated memory accesses and cache misses
+    size_t accesses, misses;
+
+    /// Number of faces and misses in a FIFO vertex cache of the face order
+    size_t n_faces, vertex_cache_misses;
+
+    /// Fraction of the memory accesses that missed the cache
+    double miss_rate() const
+    { return accesses ? double(misses) / double(accesses) : 0.0; }
+
+    /// Average vertex cache misses per face (ACMR)
+    double acmr() const
+    { return n_faces ? double(vertex_cache_misses) / double(n_faces) : 0.0; }
+  };
+
+public:
+
+  /// constructor
+  MeshReorderT(Mesh& _mesh)
+    : mesh_(_mesh),
+      cache_size_(32*1024), line_size_(64), associativity_(8),
+      vertex_cache_size_(16)
+  {}
+
+  /// destructor
+  ~MeshReorderT() {}
+
+  /// Size of the simulated cache in bytes (default 32KB)
+  void set_cache_size(size_t _bytes) { cache_size_ = _bytes; }
+
+  /// Size of a cache line in bytes (default 64)
+  void set_line_size(size_t _bytes) { line_size_ = _bytes; }
+
+  /// Number of cache lines per set (default 8)
+  void set_associativity(size_t _ways) { associativity_ = _ways; }
+
+  /// Number of entries of the FIFO vertex cache (default 16)
+  void set_vertex_cache_size(size_t _n) { vertex_cache_size_ = _n; }
+
+  /** Compute the new order without changing the mesh. On return
+      _v_new_index[i] is the new index of vertex i, likewise for edges
+      and faces, in the form expected by ArrayKernel::permute().
+      @return false if the mesh contains deleted elements */
+  bool compute_order(Order _order,
+                     std::vector<int>& _v_new_index,
+                     std::vector<int>& _e_new_index,
+                     std::vector<int>& _f_new_index) const;
+
+  /** Compute the new order and apply it to the mesh.
+      @param _before Cache statistics before reordering (may be NULL)
+      @param _after  Cache statistics after reordering (may be NULL)
+      @return false and leave the mesh untouched if it contains deleted elements */
+  bool reorder(Order _order = ORDER_VERTEX_CACHE,
+               CacheStatistics* _before = NULL,
+               CacheStatistics* _after  = NULL);
+
+  /// Estimate the cache behaviour of the current element order
+  CacheStatistics estimate() const;
+
+private:
+
+  /// Set associative LRU cache, counts the misses of a stream of accesses
+  class CacheSimulator
+  {
+  public:
+    CacheSimulator(size_t _cache_size, size_t _line_size, size_t _ways)
+      : line_size_(_line_size ? _line_size : 1), ways_(_ways ? _ways : 1),
+        clock_(0), accesses_(0), misses_(0)
+    {
+      n_sets_ = _cache_size / (line_size_ * ways_);
+      if (n_sets_ == 0) n_sets_ = 1;
+      tags_.assign(n_sets_ * ways_, size_t(-1));
+      stamps_.assign(n_sets_ * ways_, 0);
+    }
+
+    /// Access _size bytes starting at _address
+    void access(size_t _address, size_t _size)
+    {
+      const size_t last = (_address + (_size ? _size : 1) - 1) / line_size_;
+      for (size_t line = _address / line_size_; line <= last; ++line)
+        access_line(line);
+    }
+
+    size_t accesses() const { return accesses_; }
+    size_t misses()   const { return misses_; }
+
+  private:
+    void access_line(size_t _line)
+    {
+      ++accesses_;
+      const size_t first = (_line % n_sets_) * ways_;
+      size_t lru = first;
+      for (size_t i = first; i < first + ways_; ++i)
+      {
+        if (tags_[i] == _line)
+        {
+          stamps_[i] = ++clock_;
+          return;
+        }
+        if (stamps_[i] < stamps_[lru])
+          lru = i;
+      }
+      ++misses_;
+      tags_[lru]   = _line;
+      stamps_[lru] = ++clock_;
+    }
+
+    size_t line_size_, ways_, n_sets_;
+    size_t clock_, accesses_, misses_;
+    std::vector<size_t> tags_, stamps_;
+  };
+
+  bool has_deleted_elements() const;
+
+  void vertex_order_morton(std::vector<int>& _v_new_index) const;
+  void vertex_order_bfs(std::vector<int>& _v_new_index) const;
+
+  /// Faces sorted by the smallest new index of their vertices
+  void face_order_by_vertices(const std::vector<int>& _v_new_index,
+                              std::vector<int>& _f_new_index) const;
+
+  /// Greedy vertex cache optimization of the face order (Forsyth)
+  void face_order_vertex_cache(std::vector<int>& _f_new_index) const;
+
+  /// Vertices in order of their first use by the faces
+  void vertex_order_by_faces(const std::vector<int>& _f_new_index,
+                             std::vector<int>& _v_new_index) const;
+
+  /// Edges in order of their first use by the faces
+  void edge_order_by_faces(const std::vector<int>& _f_new_index,
+                           std::vector<int>& _e_new_index) const;
+
+private:
+
+  Mesh&   mesh_;
+  size_t  cache_size_, line_size_, associativity_;
+  size_t  vertex_cache_size_;
+};
+
+
+//=============================================================================
+} // namespace Utils
+} // namespace OpenMesh
+//=============================================================================
+#if defined(OM_INCLUDE_TEMPLATES) && !defined(OPENMESH_MESHREORDERT_C)
+#define OPENMESH_MESHREORDERT_TEMPLATES
+#include "MeshReorderT.cc"
+#endif
+//=============================================================================
+#endif // OPENMESH_MESHREORDERT_HH defined
+//=============================================================================
+
@@ -541,6 +541,10 @@ void expose_mesh(const char *_name) {
 	void (Mesh::*update_normal_hh)(HalfedgeHandle, double) = &Mesh::update_normal;
 	void (Mesh::*update_normal_vh)(VertexHandle          ) = &Mesh::update_normal;
 
+	void (Mesh::*update_normals       )(      ) = &Mesh::update_normals;
+	void (Mesh::*update_face_normals  )(      ) = &Mesh::update_face_normals;
+	void (Mesh::*update_vertex_normals)(      ) = &Mesh::update_vertex_normals;
+
 	void (Mesh::*update_halfedge_normals)(double) = &Mesh::update_halfedge_normals;
 
 	Normal (Mesh::*calc_face_normal    )(FaceHandle            ) const = &Mesh::calc_face_normal;
@@ -783,7 +787,9 @@ void expose_mesh(const char *_name) {
 		.def("is_simple_link", &Mesh::is_simple_link)
 		.def("is_simply_connected", &Mesh::is_simply_connected)
 		.def("remove_edge", &Mesh::remove_edge)
+#ifndef OM_NO_PREV_HALFEDGE
 		.def("reinsert_edge", &Mesh::reinsert_edge)
+#endif
 		.def("triangulate", triangulate_fh)
 		.def("triangulate", triangulate_void)
 		.def("split_edge", &Mesh::split_edge)
@@ -859,9 +865,9 @@ void expose_mesh(const char *_name) {
 		.def("split", split_fh_vh)
 		.def("split", split_eh_vh)
 
-		.def("update_normals", &Mesh::update_normals)
+		.def("update_normals", update_normals)
 		.def("update_normal", update_normal_fh)
-		.def("update_face_normals", &Mesh::update_face_normals)
+		.def("update_face_normals", update_face_normals)
 
 		.def("calc_face_normal", calc_face_normal)
 
@@ -876,7 +882,7 @@ void expose_mesh(const char *_name) {
 		.def("is_estimated_feature_edge", &Mesh::is_estimated_feature_edge)
 
 		.def("update_normal", update_normal_vh)
-		.def("update_vertex_normals", &Mesh::update_vertex_normals)
+		.def("update_vertex_normals", update_vertex_normals)
 
 		.def("calc_vertex_normal", &Mesh::calc_vertex_normal)
 		.def("calc_vertex_normal_fast", &Mesh::calc_vertex_normal_fast)
@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/importer/ImporterT.hh>
 #include <iostream>
+#include <algorithm>
 
 namespace {
     
@@ -44,6 +46,49 @@ class OpenMeshAddFacePolyMesh : public OpenMeshBasePoly {
     //Mesh mesh_;  
 };
 
+/*
+ * Compares the connectivity of a mesh built with add_faces() to a mesh
+ * built with add_face(). Edge and face indices have to be identical,
+ * vertex one-rings have to contain the same neighbors.
+ */
+template <class MeshT>
+void compare_bulk_connectivity(const MeshT& _bulk, const MeshT& _ref)
+{
+  ASSERT_EQ(_ref.n_vertices(), _bulk.n_vertices()) << "Wrong number of vertices";
+  ASSERT_EQ(_ref.n_edges(),    _bulk.n_edges())    << "Wrong number of edges";
+  ASSERT_EQ(_ref.n_faces(),    _bulk.n_faces())    << "Wrong number of faces";
+
+  for (unsigned int i = 0; i < _ref.n_halfedges(); ++i) {
+    typename MeshT::HalfedgeHandle heh(i);
+    EXPECT_EQ(_ref.to_vertex_handle(heh),   _bulk.to_vertex_handle(heh))   << "Wrong to vertex at halfedge " << i;
+    EXPECT_EQ(_ref.from_vertex_handle(heh), _bulk.from_vertex_handle(heh)) << "Wrong from vertex at halfedge " << i;
+    EXPECT_EQ(_ref.face_handle(heh),        _bulk.face_handle(heh))        << "Wrong face at halfedge " << i;
+    if (!_ref.is_boundary(heh))
+      EXPECT_EQ(_ref.next_halfedge_handle(heh), _bulk.next_halfedge_handle(heh)) << "Wrong next halfedge at halfedge " << i;
+    EXPECT_EQ(heh, _bulk.prev_halfedge_handle(_bulk.next_halfedge_handle(heh))) << "Inconsistent prev halfedge at halfedge " << i;
+  }
+
+  for (unsigned int i = 0; i < _ref.n_faces(); ++i) {
+    typename MeshT::FaceHandle fh(i);
+    EXPECT_EQ(_ref.halfedge_handle(fh), _bulk.halfedge_handle(fh)) << "Wrong halfedge at face " << i;
+  }
+
+  for (unsigned int i = 0; i < _ref.n_vertices(); ++i) {
+    typename MeshT::VertexHandle vh(i);
+    EXPECT_EQ(_ref.is_boundary(vh), _bulk.is_boundary(vh)) << "Wrong boundary flag at vertex " << i;
+    EXPECT_EQ(_ref.valence(vh),     _bulk.valence(vh))     << "Wrong valence at vertex " << i;
+
+    std::vector<int> ref_ring, bulk_ring;
+    for (typename MeshT::ConstVertexVertexIter vv_it = _ref.cvv_iter(vh); vv_it.is_valid(); ++vv_it)
+      ref_ring.push_back(vv_it->idx());
+    for (typename MeshT::ConstVertexVertexIter vv_it = _bulk.cvv_iter(vh); vv_it.is_valid(); ++vv_it)
+      bulk_ring.push_back(vv_it->idx());
+    std::sort(ref_ring.begin(), ref_ring.end());
+    std::sort(bulk_ring.begin(), bulk_ring.end());
+    EXPECT_EQ(ref_ring, bulk_ring) << "Wrong one-ring at vertex " << i;
+  }
+}
+
 /*
  * ====================================================================
  * Define tests below
@@ -428,4 +473,213 @@ TEST_F(OpenMeshAddFacePolyMesh, CreatePolyMeshCube) {
 
 }
 
+/* Adds a triangulated grid with add_faces() and compares it to add_face()
+ */
+TEST_F(OpenMeshAddFaceTriangleMesh, AddFacesBulkGrid) {
+
+  mesh_.clear();
+
+  Mesh reference;
+
+  const int n = 8;
+
+  for (int y = 0; y <= n; ++y)
+    for (int x = 0; x <= n; ++x) {
+      mesh_.add_vertex(Mesh::Point(float(x), float(y), 0));
+      reference.add_vertex(Mesh::Point(float(x), float(y), 0));
+    }
+
+  // quads, split into triangles by add_faces
+  std::vector<Mesh::VertexHandle> indices;
+  std::vector<unsigned int>       sizes;
+
+  for (int y = 0; y < n; ++y)
+    for (int x = 0; x < n; ++x) {
+      indices.push_back(Mesh::VertexHandle( y    * (n+1) + x    ));
+      indices.push_back(Mesh::VertexHandle( y    * (n+1) + x + 1));
+      indices.push_back(Mesh::VertexHandle((y+1) * (n+1) + x + 1));
+      indices.push_back(Mesh::VertexHandle((y+1) * (n+1) + x    ));
+      sizes.push_back(4);
+
+      reference.add_face(&indices[indices.size()-4], 4);
+    }
+
+  std::vector<Mesh::FaceHandle> fhandles(sizes.size());
+
+  size_t n_added = mesh_.add_faces(&indices[0], &sizes[0], sizes.size(), &fhandles[0]);
+
+  EXPECT_EQ(2u * n * n, n_added) << "Wrong number of added faces";
+  EXPECT_EQ(Mesh::FaceHandle(1), fhandles[0]) << "Wrong handle for first quad";
+  EXPECT_EQ(Mesh::FaceHandle(2 * n * n - 1), fhandles.back()) << "Wrong handle for last quad";
+
+  compare_bulk_connectivity(mesh_, reference);
+}
+
+/* Adds the strange configuration with add_faces(). The non-manifold face has
+ * to be rejected as with add_face()
+ */
+TEST_F(OpenMeshAddFaceTriangleMesh, AddFacesBulkStrangeConfig) {
+
+  mesh_.clear();
+
+  Mesh::VertexHandle vh[7];
+
+  for (int i = 0; i < 7; ++i)
+    vh[i] = mesh_.add_vertex(Mesh::Point(float(i), float(i), float(i)));
+
+  Mesh::VertexHandle indices[] = { vh[0], vh[1], vh[2],
+                                   vh[0], vh[3], vh[4],
+                                   vh[0], vh[5], vh[6],
+                                   vh[3], vh[0], vh[4] }; // non-manifold!
+  unsigned int sizes[] = { 3, 3, 3, 3 };
+
+  Mesh::FaceHandle fhandles[4];
+
+  size_t n_added = mesh_.add_faces(indices, sizes, 4, fhandles);
+
+  EXPECT_EQ(3u, n_added) << "Wrong number of added faces";
+  EXPECT_EQ(7u, mesh_.n_vertices() ) << "Wrong number of vertices";
+  EXPECT_EQ(3u, mesh_.n_faces() )    << "Wrong number of faces";
+  EXPECT_EQ(Mesh::InvalidFaceHandle, fhandles[3] ) << "non manifold face is valid";
+
+  // Without the non-manifold face, vertex 0 has three open fans
+  mesh_.clear();
+
+  for (int i = 0; i < 7; ++i)
+    vh[i] = mesh_.add_vertex(Mesh::Point(float(i), float(i), float(i)));
+
+  n_added = mesh_.add_faces(indices, sizes, 3, fhandles);
+
+  EXPECT_EQ(3u, n_added) << "Wrong number of added faces";
+  EXPECT_EQ(9u, mesh_.n_edges() ) << "Wrong number of edges";
+  EXPECT_EQ(6u, mesh_.valence(vh[0]) ) << "Wrong valence of the non-manifold vertex";
+  EXPECT_TRUE(mesh_.is_boundary(vh[0]) ) << "Non-manifold vertex is not a boundary vertex";
+}
+
+/* Faces with an out of range vertex index or a repeated vertex are
+ * rejected by add_faces() instead of being passed on to add_face()
+ */
+TEST_F(OpenMeshAddFaceTriangleMesh, AddFacesBulkBadIndex) {
+
+  mesh_.clear();
+
+  Mesh::VertexHandle vh[4];
+
+  for (int i = 0; i < 4; ++i)
+    vh[i] = mesh_.add_vertex(Mesh::Point(float(i), float(i*i), 0.0f));
+
+  Mesh::VertexHandle indices[] = { vh[0], vh[1], vh[2],
+                                   vh[0], vh[2], Mesh::VertexHandle(9),  // out of range
+                                   vh[0], vh[2], vh[2],                  // repeated vertex
+                                   vh[0], vh[2], vh[3] };
+  unsigned int sizes[] = { 3, 3, 3, 3 };
+
+  Mesh::FaceHandle fhandles[4];
+
+  size_t n_added = mesh_.add_faces(indices, sizes, 4, fhandles);
+
+  EXPECT_EQ(2u, n_added) << "Wrong number of added faces";
+  EXPECT_EQ(4u, mesh_.n_vertices() ) << "Wrong number of vertices";
+  EXPECT_EQ(2u, mesh_.n_faces() )    << "Wrong number of faces";
+  EXPECT_EQ(5u, mesh_.n_edges() )    << "Wrong number of edges";
+  EXPECT_TRUE(fhandles[0].is_valid() ) << "Valid face not added";
+  EXPECT_EQ(Mesh::InvalidFaceHandle, fhandles[1] ) << "Face with invalid index is valid";
+  EXPECT_EQ(Mesh::InvalidFaceHandle, fhandles[2] ) << "Face with repeated vertex is valid";
+  EXPECT_TRUE(fhandles[3].is_valid() ) << "Valid face not added";
+}
+
+/* Adds a cube with add_faces() to a polymesh and compares it to add_face()
+ */
+TEST_F(OpenMeshAddFacePolyMesh, AddFacesBulkCube) {
+
+  mesh_.clear();
+
+  PolyMesh reference;
+
+  for (int i = 0; i < 8; ++i) {
+    PolyMesh::Point p(float(i & 1), float((i >> 1) & 1), float((i >> 2) & 1));
+    mesh_.add_vertex(p);
+    reference.add_vertex(p);
+  }
+
+  int cube[] = { 0, 2, 3, 1,
+                 4, 5, 7, 6,
+                 0, 1, 5, 4,
+                 2, 6, 7, 3,
+                 0, 4, 6, 2,
+                 1, 3, 7, 5 };
+
+  std::vector<PolyMesh::VertexHandle> indices;
+  std::vector<unsigned int>           sizes(6, 4);
+
+  for (int i = 0; i < 24; ++i)
+    indices.push_back(PolyMesh::VertexHandle(cube[i]));
+
+  for (int i = 0; i < 6; ++i)
+    reference.add_face(&indices[4*i], 4);
+
+  size_t n_added = mesh_.add_faces(&indices[0], &sizes[0], sizes.size());
+
+  EXPECT_EQ(6u, n_added) << "Wrong number of added faces";
+  EXPECT_EQ(12u, mesh_.n_edges()) << "Wrong number of edges";
+
+  compare_bulk_connectivity(mesh_, reference);
+
+  for (PolyMesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    EXPECT_FALSE(mesh_.is_boundary(*v_it)) << "Cube vertex is a boundary vertex";
+}
+
+/*
+ * The importer adds a batch of faces like one face after the other,
+ * including the faces that have to be split off as isolated faces
+ */
+TEST_F(OpenMeshAddFacePolyMesh, ImporterAddFacesLikeAddFace) {
+
+  typedef OpenMesh::IO::BaseImporter::VHandles VHandles;
+  typedef Mesh::VertexHandle VH;
+
+  // a complex edge (third face on 0-1), equal vertices, an invalid index
+  const int faces[][3] = { {0,1,2}, {1,0,3}, {0,1,4}, {2,2,3}, {2,1,9}, {1,4,2} };
+  const size_t n_faces = sizeof(faces) / sizeof(faces[0]);
+
+  VHandles                  indices;
+  std::vector<unsigned int> face_sizes;
+  for (size_t f = 0; f < n_faces; ++f) {
+    for (int j = 0; j < 3; ++j)
+      indices.push_back(VH(faces[f][j]));
+    face_sizes.push_back(3);
+  }
+
+  Mesh single;
+  {
+    OpenMesh::IO::ImporterT<Mesh> importer(single);
+    for (int i = 0; i < 5; ++i)
+      importer.add_vertex(OpenMesh::Vec3f(float(i), float(i*i), 0.0f));
+    for (size_t f = 0; f < n_faces; ++f)
+      importer.add_face(VHandles(indices.begin() + 3*f, indices.begin() + 3*f + 3));
+    importer.finish();
+  }
+
+  Mesh batch;
+  {
+    OpenMesh::IO::ImporterT<Mesh> importer(batch);
+    for (int i = 0; i < 5; ++i)
+      importer.add_vertex(OpenMesh::Vec3f(float(i), float(i*i), 0.0f));
+    EXPECT_EQ(3u, importer.add_faces(indices, face_sizes)) << "Wrong number of faces added";
+    importer.finish();
+  }
+
+  EXPECT_EQ(single.n_vertices(), batch.n_vertices()) << "Different number of vertices";
+  EXPECT_EQ(single.n_edges(),    batch.n_edges())    << "Different number of edges";
+  EXPECT_EQ(single.n_faces(),    batch.n_faces())    << "Different number of faces";
+  EXPECT_EQ(5u, batch.n_faces()) << "The failed faces have not been added as isolated faces";
+
+  for (Mesh::FaceIter f_it = single.faces_begin(); f_it != single.faces_end(); ++f_it) {
+    Mesh::FaceVertexIter fv_single = single.fv_iter(*f_it);
+    Mesh::FaceVertexIter fv_batch  = batch.fv_iter(*f_it);
+    for (; fv_single.is_valid(); ++fv_single, ++fv_batch)
+      EXPECT_EQ(*fv_single, *fv_batch) << "Different vertex in face " << f_it->idx();
+  }
+}
+
 }
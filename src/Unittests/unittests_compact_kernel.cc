@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+namespace {
+
+class OpenMeshCompactKernel : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+// prev and next handles have to be inverse to each other
+void check_prev_next(const Mesh& _mesh) {
+
+  for (Mesh::HalfedgeIter h_it = _mesh.halfedges_begin(); h_it != _mesh.halfedges_end(); ++h_it) {
+    EXPECT_EQ(*h_it, _mesh.prev_halfedge_handle(_mesh.next_halfedge_handle(*h_it))) << "prev(next(h)) != h for halfedge " << h_it->idx();
+    EXPECT_EQ(*h_it, _mesh.next_halfedge_handle(_mesh.prev_halfedge_handle(*h_it))) << "next(prev(h)) != h for halfedge " << h_it->idx();
+  }
+}
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Size of the kernel items in the selected layout
+ */
+TEST_F(OpenMeshCompactKernel, ItemSizes) {
+
+#ifdef OM_NO_PREV_HALFEDGE
+  EXPECT_FALSE(Mesh::HasPrevHalfedge::my_bool) << "Prev handle not dropped";
+  EXPECT_EQ(3*sizeof(int), sizeof(Mesh::Halfedge));
+#else
+  EXPECT_TRUE(Mesh::HasPrevHalfedge::my_bool);
+  EXPECT_EQ(4*sizeof(int), sizeof(Mesh::Halfedge));
+#endif
+  EXPECT_EQ(2*sizeof(Mesh::Halfedge), sizeof(Mesh::Edge));
+
+#ifdef OM_COMPACT_STATUS
+  EXPECT_EQ(1u, sizeof(OpenMesh::Attributes::StatusInfo)) << "Status not packed";
+#else
+  EXPECT_EQ(sizeof(unsigned int), sizeof(OpenMesh::Attributes::StatusInfo));
+#endif
+}
+
+/*
+ * All standard status bits are stored independently
+ */
+TEST_F(OpenMeshCompactKernel, StatusBits) {
+
+  const unsigned int bits[] = { OpenMesh::Attributes::DELETED,  OpenMesh::Attributes::LOCKED,
+                                OpenMesh::Attributes::SELECTED, OpenMesh::Attributes::HIDDEN,
+                                OpenMesh::Attributes::FEATURE,  OpenMesh::Attributes::TAGGED,
+                                OpenMesh::Attributes::TAGGED2,  OpenMesh::Attributes::FIXEDNONMANIFOLD };
+
+  OpenMesh::Attributes::StatusInfo status;
+  for (int i = 0; i < 8; ++i) {
+    status.set_bit(bits[i]);
+    for (int j = 0; j < 8; ++j)
+      EXPECT_EQ(j <= i, status.is_bit_set(bits[j])) << "Bit " << bits[j] << " after setting " << bits[i];
+  }
+
+  status.set_tagged(false);
+  EXPECT_FALSE(status.tagged());
+  EXPECT_TRUE(status.tagged2());
+  EXPECT_TRUE(status.fixed_nonmanifold());
+
+  status.set_bits(0);
+  EXPECT_EQ(0u, status.bits());
+}
+
+/*
+ * Prev handles stay consistent through deletion and garbage collection,
+ * including the boundary
+ */
+TEST_F(OpenMeshCompactKernel, PrevHalfedgeAfterGarbageCollection) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  check_prev_next(mesh_);
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  for (int i = 0; i < 40; ++i)
+    mesh_.delete_face(Mesh::FaceHandle(17*i));
+
+  mesh_.status(Mesh::VertexHandle(3)).set_feature(true);
+  const Mesh::Point p3 = mesh_.point(Mesh::VertexHandle(3));
+
+  std::vector<Mesh::VertexHandle> vh_map;
+  mesh_.garbage_collection(&vh_map, NULL, NULL, true);
+
+  EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check()) << "Mesh broken by garbage collection";
+  check_prev_next(mesh_);
+
+  size_t n_boundary = 0;
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it)
+    if (mesh_.is_boundary(*h_it)) ++n_boundary;
+  EXPECT_LT(0u, n_boundary) << "No boundary after deleting faces";
+
+  ASSERT_TRUE(vh_map[3].is_valid());
+  EXPECT_EQ(p3, mesh_.point(vh_map[3]));
+  EXPECT_TRUE(mesh_.status(vh_map[3]).feature()) << "Status bit lost";
+}
+
+}
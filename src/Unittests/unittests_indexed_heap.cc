@@ -0,0 +1,201 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/HeapT.hh>
+#include <OpenMesh/Tools/Utils/IndexedHeapT.hh>
+
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+/// Heap interface reading keys and positions from plain arrays
+class ArrayHeapInterface
+{
+public:
+
+  ArrayHeapInterface(std::vector<float>& _keys, std::vector<int>& _pos)
+    : keys_(&_keys), pos_(&_pos)
+  { }
+
+  bool less(OpenMesh::VertexHandle _h0, OpenMesh::VertexHandle _h1)
+  { return (*keys_)[_h0.idx()] < (*keys_)[_h1.idx()]; }
+
+  bool greater(OpenMesh::VertexHandle _h0, OpenMesh::VertexHandle _h1)
+  { return (*keys_)[_h0.idx()] > (*keys_)[_h1.idx()]; }
+
+  float get_key(OpenMesh::VertexHandle _h)
+  { return (*keys_)[_h.idx()]; }
+
+  int get_heap_position(OpenMesh::VertexHandle _h)
+  { return (*pos_)[_h.idx()]; }
+
+  void set_heap_position(OpenMesh::VertexHandle _h, int _pos)
+  { (*pos_)[_h.idx()] = _pos; }
+
+private:
+  std::vector<float>* keys_;
+  std::vector<int>*   pos_;
+};
+
+typedef OpenMesh::Utils::IndexedHeapT<OpenMesh::VertexHandle, ArrayHeapInterface> IndexedHeap;
+typedef OpenMesh::Utils::HeapT<OpenMesh::VertexHandle, ArrayHeapInterface>        Heap;
+
+class OpenMeshIndexedHeap : public testing::Test {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            srand(42);
+            keys_.resize(1000);
+            pos_.assign(1000, -1);
+            for (size_t i = 0; i < keys_.size(); ++i)
+              keys_[i] = float(rand() % 500);
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+        /// Pop all entries and return their keys
+        template <class HeapType>
+        std::vector<float> pop_all(HeapType& _heap) {
+          std::vector<float> result;
+          while (!_heap.empty()) {
+            result.push_back(keys_[_heap.front().idx()]);
+            _heap.pop_front();
+          }
+          return result;
+        }
+
+    std::vector<float> keys_;
+    std::vector<int>   pos_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/* Inserted entries come out sorted
+ */
+TEST_F(OpenMeshIndexedHeap, InsertAndPop) {
+
+  IndexedHeap heap(ArrayHeapInterface(keys_, pos_));
+
+  for (int i = 0; i < int(keys_.size()); ++i)
+    heap.insert(OpenMesh::VertexHandle(i));
+
+  EXPECT_EQ(keys_.size(), heap.size());
+  EXPECT_TRUE(heap.check());
+
+  std::vector<float> expected(keys_);
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_EQ(expected, pop_all(heap));
+  EXPECT_FALSE(heap.is_stored(OpenMesh::VertexHandle(0)));
+}
+
+/* build() gives the same heap content as single insertions
+ */
+TEST_F(OpenMeshIndexedHeap, Build) {
+
+  IndexedHeap heap(ArrayHeapInterface(keys_, pos_));
+
+  std::vector<OpenMesh::VertexHandle> entries;
+  for (int i = 0; i < int(keys_.size()); i += 2)
+    entries.push_back(OpenMesh::VertexHandle(i));
+
+  heap.build(entries.begin(), entries.end());
+
+  EXPECT_EQ(entries.size(), heap.size());
+  EXPECT_TRUE(heap.check());
+  EXPECT_TRUE(heap.is_stored(OpenMesh::VertexHandle(0)));
+  EXPECT_FALSE(heap.is_stored(OpenMesh::VertexHandle(1)));
+
+  std::vector<float> expected;
+  for (size_t i = 0; i < entries.size(); ++i)
+    expected.push_back(keys_[entries[i].idx()]);
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_EQ(expected, pop_all(heap));
+}
+
+/* Random updates and removals give the same results as with HeapT
+ */
+TEST_F(OpenMeshIndexedHeap, UpdateAndRemoveLikeHeapT) {
+
+  std::vector<int> pos_ref(keys_.size(), -1);
+
+  IndexedHeap heap(ArrayHeapInterface(keys_, pos_));
+  Heap        ref(ArrayHeapInterface(keys_, pos_ref));
+
+  for (int i = 0; i < int(keys_.size()); ++i) {
+    heap.insert(OpenMesh::VertexHandle(i));
+    ref.insert(OpenMesh::VertexHandle(i));
+  }
+
+  for (int i = 0; i < 2000; ++i) {
+    OpenMesh::VertexHandle vh(rand() % int(keys_.size()));
+    ASSERT_EQ(ref.is_stored(vh), heap.is_stored(vh));
+
+    if (!heap.is_stored(vh)) {
+      heap.insert(vh);
+      ref.insert(vh);
+    } else if (i % 5 == 0) {
+      heap.remove(vh);
+      ref.remove(vh);
+    } else {
+      keys_[vh.idx()] = float(rand() % 500);
+      heap.update(vh);
+      ref.update(vh);
+    }
+  }
+
+  EXPECT_TRUE(heap.check());
+  EXPECT_EQ(ref.size(), heap.size());
+  EXPECT_EQ(pop_all(ref), pop_all(heap));
+}
+
+/* Batch updates, both with single sift operations and with a rebuild
+ */
+TEST_F(OpenMeshIndexedHeap, BatchUpdate) {
+
+  IndexedHeap heap(ArrayHeapInterface(keys_, pos_));
+
+  std::vector<OpenMesh::VertexHandle> entries;
+  for (int i = 0; i < 500; ++i)
+    entries.push_back(OpenMesh::VertexHandle(i));
+  heap.build(entries.begin(), entries.end());
+
+  // small batch of updates
+  std::vector<OpenMesh::VertexHandle> batch;
+  for (int i = 0; i < 10; ++i) {
+    batch.push_back(OpenMesh::VertexHandle(i * 7));
+    keys_[i * 7] = float(rand() % 500);
+  }
+  heap.update(batch.begin(), batch.end());
+  EXPECT_TRUE(heap.check());
+
+  // large batch of updates and insertions
+  batch.clear();
+  for (int i = 250; i < 1000; ++i) {
+    batch.push_back(OpenMesh::VertexHandle(i));
+    keys_[i] = float(rand() % 500);
+  }
+  heap.update(batch.begin(), batch.end());
+  EXPECT_TRUE(heap.check());
+  EXPECT_EQ(keys_.size(), heap.size());
+
+  std::vector<float> expected(keys_);
+  std::sort(expected.begin(), expected.end());
+
+  EXPECT_EQ(expected, pop_all(heap));
+}
+
+}
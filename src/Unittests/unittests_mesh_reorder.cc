@@ -0,0 +1,185 @@
+
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Utils/MeshReorderT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+
+#include <vector>
+
+namespace {
+
+class OpenMeshMeshReorder : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+typedef OpenMesh::Utils::MeshReorderT<Mesh> Reorder;
+
+// Deterministic pseudo random permutation of 0.._n-1
+std::vector<int> shuffled(size_t _n) {
+
+  std::vector<int> map(_n);
+  for (size_t i = 0; i < _n; ++i)
+    map[i] = int(i);
+
+  unsigned int state = 12345u;
+  for (size_t i = _n; i > 1; --i) {
+    state = state * 1103515245u + 12345u;
+    std::swap(map[i-1], map[(state >> 8) % i]);
+  }
+
+  return map;
+}
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Permuting moves the elements together with all their properties
+ */
+TEST_F(OpenMeshMeshReorder, PermuteKeepsProperties) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  OpenMesh::VPropHandleT<int> vprop;
+  OpenMesh::EPropHandleT<int> eprop;
+  OpenMesh::HPropHandleT<int> hprop;
+  OpenMesh::FPropHandleT<int> fprop;
+  mesh_.add_property(vprop);
+  mesh_.add_property(eprop);
+  mesh_.add_property(hprop);
+  mesh_.add_property(fprop);
+  mesh_.request_vertex_status();
+
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    mesh_.property(vprop, *v_it) = v_it->idx();
+  for (Mesh::EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it)
+    mesh_.property(eprop, *e_it) = e_it->idx();
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it)
+    mesh_.property(hprop, *h_it) = h_it->idx();
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    mesh_.property(fprop, *f_it) = f_it->idx();
+  mesh_.status(Mesh::VertexHandle(0)).set_tagged(true);
+
+  // remember the corner positions of each face
+  std::vector<Mesh::Point> corners;
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    for (Mesh::FaceVertexIter fv_it = mesh_.fv_iter(*f_it); fv_it.is_valid(); ++fv_it)
+      corners.push_back(mesh_.point(*fv_it));
+
+  const std::vector<int> v_map = shuffled(mesh_.n_vertices());
+  const std::vector<int> e_map = shuffled(mesh_.n_edges());
+  const std::vector<int> f_map = shuffled(mesh_.n_faces());
+
+  ASSERT_TRUE(mesh_.permute(v_map, e_map, f_map)) << "Valid permutation rejected";
+
+  EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check()) << "Mesh broken by permute";
+
+  for (size_t i = 0; i < v_map.size(); ++i)
+    EXPECT_EQ(int(i), mesh_.property(vprop, Mesh::VertexHandle(v_map[i]))) << "Vertex property did not follow its vertex";
+  for (size_t i = 0; i < e_map.size(); ++i) {
+    EXPECT_EQ(int(i), mesh_.property(eprop, Mesh::EdgeHandle(e_map[i]))) << "Edge property did not follow its edge";
+    EXPECT_EQ(int(2*i),   mesh_.property(hprop, Mesh::HalfedgeHandle(2*e_map[i])))   << "Halfedge property did not follow its halfedge";
+    EXPECT_EQ(int(2*i+1), mesh_.property(hprop, Mesh::HalfedgeHandle(2*e_map[i]+1))) << "Halfedge property did not follow its halfedge";
+  }
+  for (size_t i = 0; i < f_map.size(); ++i)
+    EXPECT_EQ(int(i), mesh_.property(fprop, Mesh::FaceHandle(f_map[i]))) << "Face property did not follow its face";
+
+  EXPECT_TRUE(mesh_.status(Mesh::VertexHandle(v_map[0])).tagged()) << "Status did not follow its vertex";
+
+  // the faces still have the same corners
+  for (size_t i = 0; i < f_map.size(); ++i) {
+    size_t j = 3*i;
+    for (Mesh::FaceVertexIter fv_it = mesh_.fv_iter(Mesh::FaceHandle(f_map[i])); fv_it.is_valid(); ++fv_it, ++j)
+      EXPECT_EQ(corners[j], mesh_.point(*fv_it)) << "Wrong corner of face " << i;
+  }
+}
+
+/*
+ * Vectors that are no permutation are rejected, empty ones keep the order
+ */
+TEST_F(OpenMeshMeshReorder, PermuteInvalid) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal.obj");
+  ASSERT_TRUE(ok);
+
+  std::vector<int> v_map(mesh_.n_vertices(), 0);
+  std::vector<int> none;
+
+  EXPECT_FALSE(mesh_.permute(v_map, none, none)) << "Duplicate indices accepted";
+
+  v_map.resize(3);
+  EXPECT_FALSE(mesh_.permute(v_map, none, none)) << "Wrong size accepted";
+
+  const Mesh::Point p0 = mesh_.point(Mesh::VertexHandle(0));
+  EXPECT_TRUE(mesh_.permute(none, none, none));
+  EXPECT_EQ(p0, mesh_.point(Mesh::VertexHandle(0))) << "Empty permutation changed the mesh";
+}
+
+/*
+ * Reordering a shuffled mesh reduces the estimated cache misses
+ */
+TEST_F(OpenMeshMeshReorder, ReorderShuffled) {
+
+  const Reorder::Order orders[] = { Reorder::ORDER_SPACE_FILLING_CURVE,
+                                    Reorder::ORDER_BFS,
+                                    Reorder::ORDER_VERTEX_CACHE };
+
+  for (int o = 0; o < 3; ++o) {
+
+    mesh_.clear();
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+    ASSERT_TRUE(ok);
+
+    ASSERT_TRUE(mesh_.permute(shuffled(mesh_.n_vertices()), shuffled(mesh_.n_edges()), shuffled(mesh_.n_faces())));
+
+    Reorder reorder(mesh_);
+    reorder.set_cache_size(4*1024);
+
+    Reorder::CacheStatistics before, after;
+    ASSERT_TRUE(reorder.reorder(orders[o], &before, &after));
+
+    EXPECT_TRUE(OpenMesh::Utils::MeshCheckerT<Mesh>(mesh_).check()) << "Mesh broken by reorder " << o;
+
+    EXPECT_LT(after.misses, before.misses)     << "No fewer cache misses for order " << o;
+    EXPECT_LT(after.acmr(), before.acmr())     << "No better vertex cache use for order " << o;
+    EXPECT_EQ(mesh_.n_faces(), after.n_faces);
+  }
+}
+
+/*
+ * The vertex cache order gets close to the optimum for a triangle mesh
+ */
+TEST_F(OpenMeshMeshReorder, ReorderVertexCache) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok);
+
+  Reorder reorder(mesh_);
+  Reorder::CacheStatistics before, after;
+  ASSERT_TRUE(reorder.reorder(Reorder::ORDER_VERTEX_CACHE, &before, &after));
+
+  EXPECT_LT(after.acmr(), 0.8) << "Poor vertex cache optimization";
+  EXPECT_LE(after.acmr(), before.acmr());
+}
+
+}
@@ -375,4 +375,107 @@ TEST_F(OpenMeshNormals, NormalCalculations_calc_vertex_normal_loop) {
 
 
 
+/*
+ * Multi-threaded normal computation has to give bit-identical results
+ */
+TEST_F(OpenMeshNormals, NormalCalculationsMultiThreaded) {
+
+  mesh_.clear();
+
+  mesh_.request_vertex_normals();
+  mesh_.request_halfedge_normals();
+  mesh_.request_face_normals();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  // Serial reference
+  mesh_.update_normals();
+
+  std::vector<Mesh::Normal> face_normals, vertex_normals, halfedge_normals;
+
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    face_normals.push_back(mesh_.normal(*f_it));
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    vertex_normals.push_back(mesh_.normal(*v_it));
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it)
+    halfedge_normals.push_back(mesh_.normal(*h_it));
+
+  // Reset and recompute on four threads
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    mesh_.set_normal(*f_it, Mesh::Normal(0, 0, 0));
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    mesh_.set_normal(*v_it, Mesh::Normal(0, 0, 0));
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it)
+    mesh_.set_normal(*h_it, Mesh::Normal(0, 0, 0));
+
+  mesh_.update_normals(4);
+
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    EXPECT_EQ(face_normals[f_it->idx()], mesh_.normal(*f_it)) << "Face normal differs at face " << f_it->idx();
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    EXPECT_EQ(vertex_normals[v_it->idx()], mesh_.normal(*v_it)) << "Vertex normal differs at vertex " << v_it->idx();
+  for (Mesh::HalfedgeIter h_it = mesh_.halfedges_begin(); h_it != mesh_.halfedges_end(); ++h_it)
+    EXPECT_EQ(halfedge_normals[h_it->idx()], mesh_.normal(*h_it)) << "Halfedge normal differs at halfedge " << h_it->idx();
+}
+
+/*
+ * Like the serial version, the multi-threaded normal computation visits
+ * deleted and hidden items
+ */
+TEST_F(OpenMeshNormals, NormalCalculationsMultiThreadedDeletedHidden) {
+
+  mesh_.clear();
+
+  mesh_.request_vertex_normals();
+  mesh_.request_halfedge_normals();
+  mesh_.request_face_normals();
+  mesh_.request_vertex_status();
+  mesh_.request_halfedge_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  for (int i = 0; i < 30; ++i) {
+    mesh_.delete_face(Mesh::FaceHandle(23*i), false);
+    mesh_.status(Mesh::FaceHandle(23*i+7)).set_hidden(true);
+    mesh_.status(Mesh::VertexHandle(11*i)).set_hidden(true);
+  }
+
+  // Serial reference
+  mesh_.update_normals();
+
+  std::vector<Mesh::Normal> face_normals, vertex_normals, halfedge_normals;
+
+  for (size_t i = 0; i < mesh_.n_faces(); ++i)
+    face_normals.push_back(mesh_.normal(Mesh::FaceHandle(int(i))));
+  for (size_t i = 0; i < mesh_.n_vertices(); ++i)
+    vertex_normals.push_back(mesh_.normal(Mesh::VertexHandle(int(i))));
+  for (size_t i = 0; i < mesh_.n_halfedges(); ++i)
+    halfedge_normals.push_back(mesh_.normal(Mesh::HalfedgeHandle(int(i))));
+
+  // Reset and recompute on four threads
+  for (size_t i = 0; i < mesh_.n_faces(); ++i)
+    mesh_.set_normal(Mesh::FaceHandle(int(i)), Mesh::Normal(0, 0, 0));
+  for (size_t i = 0; i < mesh_.n_vertices(); ++i)
+    mesh_.set_normal(Mesh::VertexHandle(int(i)), Mesh::Normal(0, 0, 0));
+  for (size_t i = 0; i < mesh_.n_halfedges(); ++i)
+    mesh_.set_normal(Mesh::HalfedgeHandle(int(i)), Mesh::Normal(0, 0, 0));
+
+  mesh_.update_normals(4);
+
+  EXPECT_NE(Mesh::Normal(0, 0, 0), mesh_.normal(Mesh::FaceHandle(7))) << "Hidden face got no normal";
+
+  for (size_t i = 0; i < mesh_.n_faces(); ++i)
+    EXPECT_EQ(face_normals[i], mesh_.normal(Mesh::FaceHandle(int(i)))) << "Face normal differs at face " << i;
+  for (size_t i = 0; i < mesh_.n_vertices(); ++i)
+    EXPECT_EQ(vertex_normals[i], mesh_.normal(Mesh::VertexHandle(int(i)))) << "Vertex normal differs at vertex " << i;
+  for (size_t i = 0; i < mesh_.n_halfedges(); ++i)
+    EXPECT_EQ(halfedge_normals[i], mesh_.normal(Mesh::HalfedgeHandle(int(i)))) << "Halfedge normal differs at halfedge " << i;
+}
+
 }
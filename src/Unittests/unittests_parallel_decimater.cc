@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Tools/Decimater/ParallelDecimaterT.hh>
+#include <OpenMesh/Tools/Decimater/ModQuadricT.hh>
+#include <OpenMesh/Tools/Decimater/ModNormalFlippingT.hh>
+
+namespace {
+
+class OpenMeshParallelDecimater : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+            
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;  
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ */
+TEST_F(OpenMeshParallelDecimater, DecimateMesh) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+    
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::ParallelDecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+
+  Decimater decimaterDBG(mesh_);
+  HModQuadric hModQuadricDBG;
+  decimaterDBG.add( hModQuadricDBG );
+  decimaterDBG.initialize();
+  size_t removedVertices = 0;
+  removedVertices = decimaterDBG.decimate_to(5000);
+                    decimaterDBG.mesh().garbage_collection();
+
+  EXPECT_EQ(2526u, removedVertices)     << "The number of remove vertices is not correct!";
+  EXPECT_EQ(5000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+  EXPECT_EQ(14994u, mesh_.n_edges())   << "The number of edges after decimation is not correct!";
+  EXPECT_EQ(9996u, mesh_.n_faces())    << "The number of faces after decimation is not correct!";
+}
+
+TEST_F(OpenMeshParallelDecimater, DecimateMeshToFaceFaceLimit) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  typedef OpenMesh::Decimater::ParallelDecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+
+  Decimater decimaterDBG(mesh_);
+  HModQuadric hModQuadricDBG;
+  decimaterDBG.add( hModQuadricDBG );
+  decimaterDBG.initialize();
+  size_t removedVertices = 0;
+  removedVertices = decimaterDBG.decimate_to_faces(4500, 9996);
+                    decimaterDBG.mesh().garbage_collection();
+
+  EXPECT_EQ(2526u, removedVertices) << "The number of remove vertices is not correct!";
+  EXPECT_EQ(5000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+  EXPECT_EQ(14994u, mesh_.n_edges()) << "The number of edges after decimation is not correct!";
+  EXPECT_EQ(9996u, mesh_.n_faces()) << "The number of faces after decimation is not correct!";
+}
+
+/*
+ * The selection of the collapses does not depend on the number of threads,
+ * so decimating with one and with several threads gives the same mesh.
+ */
+TEST_F(OpenMeshParallelDecimater, SameResultForAllThreadCounts) {
+
+  typedef OpenMesh::Decimater::ParallelDecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+
+  Mesh mesh1, mesh4;
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh1, "cube1.off"));
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh4, "cube1.off"));
+
+  Decimater decimater1(mesh1);
+  HModQuadric hModQuadric1;
+  decimater1.add( hModQuadric1 );
+  decimater1.initialize();
+  decimater1.set_num_threads(1);
+
+  Decimater decimater4(mesh4);
+  HModQuadric hModQuadric4;
+  decimater4.add( hModQuadric4 );
+  decimater4.initialize();
+  decimater4.set_num_threads(4);
+
+  EXPECT_EQ(decimater1.decimate_to(1000), decimater4.decimate_to(1000));
+
+  mesh1.garbage_collection();
+  mesh4.garbage_collection();
+
+  ASSERT_EQ(1000u, mesh1.n_vertices());
+  ASSERT_EQ(mesh1.n_faces(), mesh4.n_faces());
+
+  for (Mesh::VertexIter v_it = mesh1.vertices_begin(); v_it != mesh1.vertices_end(); ++v_it)
+    EXPECT_EQ(mesh1.point(*v_it), mesh4.point(*v_it)) << "Point of vertex " << v_it->idx() << " differs";
+
+  for (Mesh::FaceIter f_it = mesh1.faces_begin(); f_it != mesh1.faces_end(); ++f_it) {
+    Mesh::FaceVertexIter fv1 = mesh1.fv_iter(*f_it);
+    Mesh::FaceVertexIter fv4 = mesh4.fv_iter(*f_it);
+    for (; fv1.is_valid() && fv4.is_valid(); ++fv1, ++fv4)
+      EXPECT_EQ(fv1->idx(), fv4->idx()) << "Face " << f_it->idx() << " differs";
+  }
+}
+
+/*
+ * A module that is not thread safe makes the decimater fall back to
+ * a single thread.
+ */
+TEST_F(OpenMeshParallelDecimater, DecimateMeshWithUnsafeModule) {
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  mesh_.request_face_normals();
+  mesh_.update_face_normals();
+
+  typedef OpenMesh::Decimater::ParallelDecimaterT< Mesh >  Decimater;
+  typedef OpenMesh::Decimater::ModQuadricT< Mesh >::Handle HModQuadric;
+  typedef OpenMesh::Decimater::ModNormalFlippingT< Mesh >::Handle HModNormalFlipping;
+
+  Decimater decimaterDBG(mesh_);
+  HModQuadric hModQuadricDBG;
+  HModNormalFlipping hModNormalFlippingDBG;
+  decimaterDBG.add( hModQuadricDBG );
+  decimaterDBG.add( hModNormalFlippingDBG );
+  decimaterDBG.initialize();
+  decimaterDBG.set_num_threads(4);
+
+  size_t removedVertices = decimaterDBG.decimate_to(3000);
+                           decimaterDBG.mesh().garbage_collection();
+
+  EXPECT_EQ(4526u, removedVertices) << "The number of remove vertices is not correct!";
+  EXPECT_EQ(3000u, mesh_.n_vertices()) << "The number of vertices after decimation is not correct!";
+}
+
+}
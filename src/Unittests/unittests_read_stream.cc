@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+
+#include <algorithm>
+
+
+namespace {
+
+class OpenMeshReadStream : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * Collects all batches and checks their order
+ */
+class CollectBatches : public OpenMesh::IO::StreamCallback {
+
+  public:
+
+    CollectBatches() : max_batch(0), max_index(-1), faces_before_vertices(false) {}
+
+    void vertices(const OpenMesh::IO::VertexBatch& _batch) {
+      EXPECT_EQ(points.size(), _batch.first) << "Vertex batches are not consecutive";
+      max_batch = std::max(max_batch, _batch.size());
+      points.insert(points.end(), _batch.points.begin(), _batch.points.end());
+      normals.insert(normals.end(), _batch.normals.begin(), _batch.normals.end());
+      texcoords.insert(texcoords.end(), _batch.texcoords.begin(), _batch.texcoords.end());
+    }
+
+    void faces(const OpenMesh::IO::FaceBatch& _batch) {
+      EXPECT_EQ(face_list.size(), _batch.first) << "Face batches are not consecutive";
+      max_batch = std::max(max_batch, _batch.size());
+      for (size_t i = 0; i < _batch.size(); ++i) {
+        std::vector<int> face(_batch.face(i), _batch.face(i) + _batch.valence(i));
+        for (size_t j = 0; j < face.size(); ++j) {
+          max_index = std::max(max_index, face[j]);
+          faces_before_vertices |= (size_t(face[j]) >= points.size());
+        }
+        face_list.push_back(face);
+      }
+    }
+
+    size_t max_batch;
+    int    max_index;
+    bool   faces_before_vertices;
+
+    std::vector<OpenMesh::Vec3f>  points;
+    std::vector<OpenMesh::Vec3f>  normals;
+    std::vector<OpenMesh::Vec2f>  texcoords;
+    std::vector<std::vector<int> > face_list;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Stream an off file in small batches and compare it with the mesh
+ */
+TEST_F(OpenMeshReadStream, StreamOFFFileInBatches) {
+
+    mesh_.clear();
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+    ASSERT_TRUE(ok);
+
+    CollectBatches batches;
+    OpenMesh::IO::Options opt;
+    ok = OpenMesh::IO::read_stream("cube1.off", batches, opt, 1000);
+    EXPECT_TRUE(ok);
+
+    EXPECT_EQ(1000u, batches.max_batch) << "Wrong batch size";
+    EXPECT_FALSE(batches.faces_before_vertices) << "Faces delivered before their vertices";
+
+    ASSERT_EQ(mesh_.n_vertices(), batches.points.size()) << "The number of streamed vertices is not correct!";
+    ASSERT_EQ(mesh_.n_faces(), batches.face_list.size()) << "The number of streamed faces is not correct!";
+    EXPECT_TRUE(batches.normals.empty()) << "Normals streamed without request";
+
+    bool wrong = false;
+    for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end() && !wrong; ++v_it)
+      wrong = (mesh_.point(*v_it) != batches.points[v_it->idx()]);
+    EXPECT_FALSE(wrong) << "min one point differs";
+
+    wrong = false;
+    for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end() && !wrong; ++f_it) {
+      std::vector<int> face;
+      for (Mesh::FaceVertexIter fv_it = mesh_.fv_iter(*f_it); fv_it.is_valid(); ++fv_it)
+        face.push_back(fv_it->idx());
+      std::vector<int> streamed = batches.face_list[f_it->idx()];
+      std::sort(face.begin(), face.end());
+      std::sort(streamed.begin(), streamed.end());
+      wrong = (face != streamed);
+    }
+    EXPECT_FALSE(wrong) << "min one face differs";
+}
+
+/*
+ * Stream a ply file with vertex normals, the last batch is not full
+ */
+TEST_F(OpenMeshReadStream, StreamPLYFileWithNormals) {
+
+    CollectBatches batches;
+    OpenMesh::IO::Options opt = OpenMesh::IO::Options::VertexNormal;
+    bool ok = OpenMesh::IO::read_stream("cube-minimal-normals.ply", batches, opt, 3);
+    EXPECT_TRUE(ok);
+
+    EXPECT_TRUE(opt.vertex_has_normal()) << "Wrong user options are returned!";
+
+    ASSERT_EQ(8u, batches.points.size()) << "The number of streamed vertices is not correct!";
+    ASSERT_EQ(8u, batches.normals.size()) << "The number of streamed normals is not correct!";
+    ASSERT_EQ(6u, batches.face_list.size()) << "The number of streamed faces is not correct!";
+    EXPECT_EQ(3u, batches.max_batch) << "Wrong batch size";
+    EXPECT_EQ(7, batches.max_index) << "Wrong vertex index";
+
+    EXPECT_EQ(OpenMesh::Vec3f(1, 1, 1), batches.points[6]) << "Wrong coordinates at vertex 6";
+    EXPECT_EQ(OpenMesh::Vec3f(1, 1, 2), batches.normals[7]) << "Wrong normal at vertex 7";
+
+    for (size_t i = 0; i < batches.face_list.size(); ++i)
+      EXPECT_EQ(4u, batches.face_list[i].size()) << "Wrong valence of face " << i;
+}
+
+/*
+ * Stream an obj file with normals and texture coordinates. They are
+ * assigned to the vertices by the faces and can not be streamed.
+ */
+TEST_F(OpenMeshReadStream, StreamOBJFileWithNormalsAndTexCoords) {
+
+    mesh_.clear();
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube-minimal-texCoords.obj");
+    ASSERT_TRUE(ok);
+
+    CollectBatches batches;
+    OpenMesh::IO::Options opt;
+    opt += OpenMesh::IO::Options::VertexNormal;
+    opt += OpenMesh::IO::Options::VertexTexCoord;
+    ok = OpenMesh::IO::read_stream("cube-minimal-texCoords.obj", batches, opt, 3);
+    EXPECT_TRUE(ok);
+
+    EXPECT_FALSE(opt.vertex_has_normal()) << "Normals reported as streamed";
+    EXPECT_FALSE(opt.vertex_has_texcoord()) << "Texture coordinates reported as streamed";
+    EXPECT_TRUE(batches.normals.empty()) << "Partial normals streamed";
+    EXPECT_TRUE(batches.texcoords.empty()) << "Partial texture coordinates streamed";
+    EXPECT_FALSE(batches.faces_before_vertices) << "Faces delivered before their vertices";
+
+    ASSERT_EQ(mesh_.n_vertices(), batches.points.size()) << "The number of streamed vertices is not correct!";
+    ASSERT_EQ(mesh_.n_faces(), batches.face_list.size()) << "The number of streamed faces is not correct!";
+
+    bool wrong = false;
+    for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end() && !wrong; ++v_it)
+      wrong = (mesh_.point(*v_it) != batches.points[v_it->idx()]);
+    EXPECT_FALSE(wrong) << "min one point differs";
+
+    for (size_t i = 0; i < batches.face_list.size(); ++i)
+      EXPECT_EQ(3u, batches.face_list[i].size()) << "Wrong valence of face " << i;
+}
+
+}
@@ -1,5 +1,10 @@
 
 #include <gtest/gtest.h>
+#include <OpenMesh/Core/IO/writer/AsciiBuffer.hh>
+
+#include <sstream>
+#include <fstream>
+#include <clocale>
 #include <Unittests/unittests_common.hh>
 
 
@@ -47,6 +52,41 @@ TEST_F(OpenMeshReadWriteOBJ, LoadSimpleOBJ) {
     EXPECT_EQ(12u , mesh_.n_faces()) << "The number of loaded faces is not correct!";
 }
 
+/*
+ * Load an obj file using different number formats, whitespace and relative indices
+ */
+TEST_F(OpenMeshReadWriteOBJ, LoadOBJNumberFormatsAndRelativeIndices) {
+
+    mesh_.clear();
+    mesh_.request_vertex_normals();
+
+    OpenMesh::IO::Options opt;
+    opt += OpenMesh::IO::Options::VertexNormal;
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "square-number-formats.obj", opt);
+
+    EXPECT_TRUE(ok) << "Unable to load square-number-formats.obj";
+
+    EXPECT_EQ(4u  , mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(5u  , mesh_.n_edges()) << "The number of loaded edges is not correct!";
+    EXPECT_EQ(2u  , mesh_.n_faces()) << "The number of loaded faces is not correct!";
+
+    EXPECT_TRUE(opt.vertex_has_normal());
+
+    EXPECT_EQ(1.0f        , mesh_.point(Mesh::VertexHandle(1))[0]) << "Wrong coordinate at vertex 1 component 0";
+    EXPECT_EQ(0.0f        , mesh_.point(Mesh::VertexHandle(1))[2]) << "Wrong coordinate at vertex 1 component 2";
+    EXPECT_EQ(1.000000001f, mesh_.point(Mesh::VertexHandle(2))[0]) << "Wrong coordinate at vertex 2 component 0";
+    EXPECT_EQ(1.0f        , mesh_.point(Mesh::VertexHandle(2))[1]) << "Wrong coordinate at vertex 2 component 1";
+    EXPECT_EQ(-0.25f      , mesh_.point(Mesh::VertexHandle(3))[0]) << "Wrong coordinate at vertex 3 component 0";
+    EXPECT_EQ(1.0f        , mesh_.point(Mesh::VertexHandle(3))[1]) << "Wrong coordinate at vertex 3 component 1";
+    EXPECT_EQ(12345678.5f , mesh_.point(Mesh::VertexHandle(3))[2]) << "Wrong coordinate at vertex 3 component 2";
+
+    EXPECT_EQ(1.0f, mesh_.normal(Mesh::VertexHandle(0))[2]) << "Wrong normal at vertex 0";
+    EXPECT_EQ(1.0f, mesh_.normal(Mesh::VertexHandle(3))[2]) << "Wrong normal at vertex 3";
+
+    mesh_.release_vertex_normals();
+}
+
 /*
  * Just load a obj file of a cube with degenerated faces
  */
@@ -333,4 +373,110 @@ TEST_F(OpenMeshReadWriteOBJ, LoadSimpleOBJWithVertexColorsAsVCLines) {
     mesh_.release_vertex_colors();
 
 }
+/*
+ * The ASCII writers format into AsciiBuffers, which have to produce
+ * the same characters as the stream they are written to
+ */
+TEST_F(OpenMeshReadWriteOBJ, AsciiBufferFormatsLikeStream) {
+
+    const double values[] = { 0.0, -0.0, 1.0, -1.5, 0.1, 1.0/3.0, 123456789.0, 1e-7, -2.5e21, 65504.0 };
+    const int n_values = int(sizeof(values) / sizeof(values[0]));
+
+    const std::ios_base::fmtflags fields[] = { std::ios_base::fmtflags(0), std::ios_base::fixed, std::ios_base::scientific };
+
+    for (int f = 0; f < 3; ++f) {
+      for (int precision = 0; precision < 12; precision += 3) {
+        std::ostringstream stream;
+        stream.setf(fields[f], std::ios_base::floatfield);
+        stream.precision(precision);
+
+        OpenMesh::IO::AsciiBuffer buffer(stream);
+        for (int i = 0; i < n_values; ++i) {
+          stream << values[i] << ' ' << float(values[i]) << ' ';
+          buffer << values[i] << ' ' << float(values[i]) << ' ';
+        }
+        stream << -7 << ' ' << 0u << ' ' << 2147483647 << ' ' << OpenMesh::Vec3f(1.f, 2.5f, -3.f);
+        buffer << -7 << ' ' << 0u << ' ' << 2147483647 << ' ' << OpenMesh::Vec3f(1.f, 2.5f, -3.f);
+
+        std::ostringstream written;
+        buffer.write(written);
+        EXPECT_EQ(stream.str(), written.str()) << "Different output for precision " << precision;
+      }
+    }
+}
+
+/*
+ * Write a mesh with more vertices and faces than one formatting block
+ * holds and read it again
+ */
+TEST_F(OpenMeshReadWriteOBJ, WriteReadOBJInBlocks) {
+
+    mesh_.clear();
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+    ASSERT_TRUE(ok);
+
+    const std::string filename = "cube1-blocks.obj";
+
+    // 9 digits restore a float exactly
+    ok = OpenMesh::IO::write_mesh(mesh_, filename, OpenMesh::IO::Options::Default, 9);
+    EXPECT_TRUE(ok) << "Unable to write " << filename;
+
+    Mesh cmpMesh;
+    ok = OpenMesh::IO::read_mesh(cmpMesh, filename);
+    EXPECT_TRUE(ok) << "Unable to read " << filename;
+
+    ASSERT_EQ(mesh_.n_vertices(), cmpMesh.n_vertices()) << "The number of loaded vertices is not correct!";
+    ASSERT_EQ(mesh_.n_faces(),    cmpMesh.n_faces())    << "The number of loaded faces is not correct!";
+
+    bool wrong = false;
+    for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end() && !wrong; ++v_it)
+      wrong = (mesh_.point(*v_it) != cmpMesh.point(*v_it));
+    EXPECT_FALSE(wrong) << "min one point differs";
+
+    wrong = false;
+    for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end() && !wrong; ++f_it)
+      wrong = (mesh_.halfedge_handle(*f_it) != cmpMesh.halfedge_handle(*f_it));
+    EXPECT_FALSE(wrong) << "min one face differs";
+
+    remove(filename.c_str());
+}
+/*
+ * Coordinates with more digits than the fast path handles do not depend
+ * on the C locale of the application
+ */
+TEST_F(OpenMeshReadWriteOBJ, LoadLongCoordinatesWithDecimalCommaLocale) {
+
+    const std::string filename = "long-coordinates.obj";
+    {
+      std::ofstream out(filename.c_str());
+      out << "v 0.1234567891 1.0000000001 -2.5e-20\n"
+          << "v 1 0 0\n"
+          << "v 0 1 0\n"
+          << "f 1 2 3\n";
+    }
+
+    const std::string old_locale = setlocale(LC_NUMERIC, 0);
+    const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "de_DE", "German_Germany.1252" };
+    bool comma = false;
+    for (size_t i = 0; i < sizeof(locales)/sizeof(locales[0]) && !comma; ++i)
+      comma = setlocale(LC_NUMERIC, locales[i]) != 0;
+    if (!comma)
+      std::cerr << "Warning: No decimal comma locale available, reading with the C locale." << std::endl;
+
+    mesh_.clear();
+    bool ok = OpenMesh::IO::read_mesh(mesh_, filename);
+
+    setlocale(LC_NUMERIC, old_locale.c_str());
+
+    ASSERT_TRUE(ok) << "Unable to read " << filename;
+    ASSERT_EQ(3u, mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+
+    const Mesh::Point p = mesh_.point(Mesh::VertexHandle(0));
+    EXPECT_EQ(0.1234567891f, p[0]) << "Wrong x coordinate";
+    EXPECT_EQ(1.0000000001f, p[1]) << "Wrong y coordinate";
+    EXPECT_EQ(-2.5e-20f,     p[2]) << "Wrong z coordinate";
+
+    remove(filename.c_str());
+}
 }
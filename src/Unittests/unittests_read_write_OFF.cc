@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/reader/OFFReader.hh>
+#include <fstream>
 
 
 namespace {
@@ -202,4 +204,44 @@ TEST_F(OpenMeshReadWriteOFF, WriteAndReadBinaryFloatVertexColorsToAndFromOFFFile
 
     mesh_.release_vertex_colors();
 }
+
+/*
+ * Read an ascii OFF file from a stream after a binary one was read
+ * through the file interface. The stream reader has to parse the header
+ * itself and must not use the options of the previous file.
+ */
+TEST_F(OpenMeshReadWriteOFF, ReadOFFFromStreamAfterBinaryFile) {
+
+    mesh_.clear();
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+    EXPECT_TRUE(ok) << "cube1.off could not be read!";
+
+    OpenMesh::IO::Options opt = OpenMesh::IO::Options::Binary;
+    ok = OpenMesh::IO::write_mesh(mesh_, "cube1_stream_binary.off", opt);
+    EXPECT_TRUE(ok) << "cube1_stream_binary.off could not be written!";
+
+    mesh_.clear();
+
+    ok = OpenMesh::IO::read_mesh(mesh_, "cube1_stream_binary.off", opt);
+    EXPECT_TRUE(ok) << "cube1_stream_binary.off could not be read!";
+    EXPECT_TRUE(opt.is_binary());
+
+    mesh_.clear();
+
+    std::ifstream ifs("cube1.off");
+    OpenMesh::IO::ImporterT<Mesh> importer(mesh_);
+    opt.clear();
+
+    importer.prepare();
+    ok = OpenMesh::IO::OFFReader().read(ifs, importer, opt);
+    importer.finish();
+
+    EXPECT_TRUE(ok);
+    EXPECT_FALSE(opt.is_binary()) << "Wrong user opt are returned!";
+
+    EXPECT_EQ(7526u , mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(22572u, mesh_.n_edges()) << "The number of loaded edges is not correct!";
+    EXPECT_EQ(15048u, mesh_.n_faces()) << "The number of loaded faces is not correct!";
+}
 }
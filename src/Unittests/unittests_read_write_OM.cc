@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/OMCodec.hh>
+
+#include <fstream>
+#include <sstream>
 
 
 namespace {
@@ -670,4 +674,356 @@ TEST_F(OpenMeshReadWriteOM, ReadBigMeshWithCustomProperty) {
   EXPECT_FALSE(wrong) << "min one vertex has worng vertex property";
 }
 
+/*
+ * Load custom properties deferred: the data is restored from the mapped
+ * file on the first access of each property.
+ */
+TEST_F(OpenMeshReadWriteOM, ReadBigMeshWithDeferredCustomProperty) {
+
+  OpenMesh::FPropHandleT<double> faceProp;
+  OpenMesh::VPropHandleT<int> vertexProp;
+
+  Mesh mesh;
+  mesh.add_property(faceProp,"DFProp");
+  mesh.property(faceProp).set_persistent(true);
+
+  mesh.add_property(vertexProp, "IVProp");
+  mesh.property(vertexProp).set_persistent(true);
+
+  OpenMesh::IO::Options options = OpenMesh::IO::Options::DeferredProperties;
+  bool ok = OpenMesh::IO::read_mesh(mesh,"cube1_customProps.om", options);
+  EXPECT_TRUE(ok) << "Unable to read cube1_customProps.om";
+
+  EXPECT_EQ(7526u , mesh.n_vertices()) << "The number of loaded vertices is not correct!";
+  EXPECT_EQ(15048u, mesh.n_faces()) << "The number of loaded faces is not correct!";
+
+  if (!options.check(OpenMesh::IO::Options::DeferredProperties)) {
+    std::cerr << "Warning: File could not be mapped, properties have been loaded directly." << std::endl;
+    return;
+  }
+
+  // look the properties up without accessing them
+  const OpenMesh::BaseProperty* fprop = *(mesh.fprops_begin() + faceProp.idx());
+  const OpenMesh::BaseProperty* vprop = *(mesh.vprops_begin() + vertexProp.idx());
+
+  EXPECT_FALSE(fprop->loaded()) << "Face property has been loaded up front";
+  EXPECT_FALSE(vprop->loaded()) << "Vertex property has been loaded up front";
+
+  bool wrong = false;
+  for (Mesh::FaceIter fIter = mesh.faces_begin(); fIter != mesh.faces_end() && !wrong; ++fIter)
+    wrong = (0.3 != mesh.property(faceProp,*fIter));
+  EXPECT_FALSE(wrong) << "min one face has wrong face property";
+
+  EXPECT_TRUE(fprop->loaded()) << "Face property has not been loaded on access";
+  EXPECT_FALSE(vprop->loaded()) << "Vertex property has been loaded without access";
+
+  // changing the number of vertices restores the data first
+  Mesh::VertexHandle vh = mesh.add_vertex(Mesh::Point(0.0,0.0,0.0));
+  EXPECT_TRUE(vprop->loaded()) << "Vertex property has not been loaded on resize";
+  mesh.property(vertexProp, vh) = -1;
+
+  wrong = false;
+  for (Mesh::VertexIter vIter = mesh.vertices_begin(); vIter != mesh.vertices_end() && !wrong; ++vIter)
+    wrong = (vIter->idx() != mesh.property(vertexProp,*vIter)) && (*vIter != vh);
+  EXPECT_FALSE(wrong) << "min one vertex has wrong vertex property";
+}
+
+/*
+ * Save a mesh with its raw half-edge connectivity and load it again. The
+ * kernel arrays have to be restored exactly, including the edge order
+ * produced by a garbage collection.
+ */
+TEST_F(OpenMeshReadWriteOM, WriteReadTriangleConnectivity) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok) << "Unable to read cube1.off";
+
+  // punch some holes so the edge order differs from rebuilding via add_face
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+  for (unsigned int i = 0; i < mesh_.n_faces(); i += 7)
+    mesh_.delete_face(Mesh::FaceHandle(int(i)), true);
+  mesh_.garbage_collection();
+
+  OpenMesh::EPropHandleT<int> prop;
+  mesh_.add_property(prop, "EIProp");
+  mesh_.property(prop).set_persistent(true);
+  for (Mesh::EdgeIter e_it = mesh_.edges_begin(); e_it != mesh_.edges_end(); ++e_it)
+    mesh_.property(prop, *e_it) = e_it->idx();
+
+  const std::string filename = "cube1-connectivity.om";
+
+  OpenMesh::IO::Options options = OpenMesh::IO::Options::Connectivity;
+  ok = OpenMesh::IO::write_mesh(mesh_, filename, options);
+  EXPECT_TRUE(ok) << "Unable to write " << filename;
+
+  Mesh cmpMesh;
+  cmpMesh.add_property(prop, "EIProp");
+  cmpMesh.property(prop).set_persistent(true);
+
+  OpenMesh::IO::Options read_options = OpenMesh::IO::Options::Connectivity;
+  ok = OpenMesh::IO::read_mesh(cmpMesh, filename, read_options);
+  EXPECT_TRUE(ok) << "Unable to read " << filename;
+  EXPECT_TRUE(read_options.check(OpenMesh::IO::Options::Connectivity)) << "Connectivity has not been restored";
+
+  EXPECT_EQ(mesh_.n_vertices(), cmpMesh.n_vertices()) << "The number of loaded vertices is not correct!";
+  EXPECT_EQ(mesh_.n_edges(),    cmpMesh.n_edges())    << "The number of loaded edges is not correct!";
+  EXPECT_EQ(mesh_.n_faces(),    cmpMesh.n_faces())    << "The number of loaded faces is not correct!";
+
+  std::vector<int> vh0, h0, fh0, vh1, h1, fh1;
+  mesh_.get_connectivity(vh0, h0, fh0);
+  cmpMesh.get_connectivity(vh1, h1, fh1);
+
+  EXPECT_TRUE(vh0 == vh1) << "Vertex halfedges differ";
+  EXPECT_TRUE(h0  == h1)  << "Halfedges differ";
+  EXPECT_TRUE(fh0 == fh1) << "Face halfedges differ";
+
+  bool wrong = false;
+  for (Mesh::HalfedgeIter h_it = cmpMesh.halfedges_begin(); h_it != cmpMesh.halfedges_end() && !wrong; ++h_it)
+    wrong = (cmpMesh.prev_halfedge_handle(cmpMesh.next_halfedge_handle(*h_it)) != *h_it);
+  EXPECT_FALSE(wrong) << "Previous halfedges not restored";
+
+  wrong = false;
+  for (Mesh::EdgeIter e_it = cmpMesh.edges_begin(); e_it != cmpMesh.edges_end() && !wrong; ++e_it)
+    wrong = (cmpMesh.property(prop, *e_it) != e_it->idx());
+  EXPECT_FALSE(wrong) << "Edge property does not match the restored edges";
+
+  // A plain load without the option uses the same chunks
+  Mesh plainMesh;
+  ok = OpenMesh::IO::read_mesh(plainMesh, filename);
+  EXPECT_TRUE(ok) << "Unable to read " << filename;
+  EXPECT_EQ(mesh_.n_faces(), plainMesh.n_faces()) << "The number of loaded faces is not correct!";
+
+  remove(filename.c_str());
+}
+
+/*
+ * Raw connectivity arrays with an inconsistent topology are rejected and
+ * leave the mesh untouched
+ */
+TEST_F(OpenMeshReadWriteOM, SetConnectivityRejectsCorruptArrays) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok) << "Unable to read cube1.off";
+
+  std::vector<int> vh, h, fh;
+  mesh_.get_connectivity(vh, h, fh);
+
+  // halfedge 0 and a halfedge of another face
+  const int other = mesh_.halfedge_handle(Mesh::FaceHandle(1)).idx();
+
+  for (int corruption = 0; corruption < 6; ++corruption) {
+    std::vector<int> cvh(vh), ch(h), cfh(fh);
+    switch (corruption) {
+      case 0: std::swap(ch[1], ch[3*other+1]); break;  // next halfedges of two faces swapped
+      case 1: ch[3*2+1] = ch[1];               break;  // two halfedges with the same next
+      case 2: ch[0] = ch[3];                   break;  // edge from a vertex to itself
+      case 3: ch[2] = ch[3*other+2];           break;  // halfedge in the wrong face
+      case 4: cvh[0] ^= 1;                     break;  // vertex halfedge points into the vertex
+      case 5: cfh[0] = cfh[1];                 break;  // face halfedge of another face
+    }
+
+    Mesh cmpMesh;
+    for (size_t i = 0; i < vh.size(); ++i)
+      cmpMesh.add_vertex(Mesh::Point(0.0, 0.0, 0.0));
+
+    EXPECT_FALSE(cmpMesh.set_connectivity(cvh, ch, cfh)) << "Corruption " << corruption << " not detected";
+    EXPECT_EQ(0u, cmpMesh.n_edges()) << "Mesh changed by corruption " << corruption;
+    EXPECT_EQ(0u, cmpMesh.n_faces()) << "Mesh changed by corruption " << corruption;
+  }
+
+  Mesh cmpMesh;
+  for (size_t i = 0; i < vh.size(); ++i)
+    cmpMesh.add_vertex(Mesh::Point(0.0, 0.0, 0.0));
+  EXPECT_TRUE(cmpMesh.set_connectivity(vh, h, fh)) << "Valid arrays rejected";
+  EXPECT_EQ(mesh_.n_faces(), cmpMesh.n_faces()) << "The number of restored faces is not correct!";
+}
+
+
+/*
+ * Save a mesh with compressed chunks and load it again. The data has to
+ * be restored exactly and the file has to be smaller than without
+ * compression.
+ */
+TEST_F(OpenMeshReadWriteOM, WriteReadTriangleCompressed) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+  ASSERT_TRUE(ok) << "Unable to read cube1.off";
+
+  mesh_.request_vertex_normals();
+  mesh_.request_face_normals();
+  mesh_.update_normals();
+
+  mesh_.request_vertex_colors();
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+    mesh_.set_color(*v_it, Mesh::Color(v_it->idx() % 256, 0, 255));
+
+  OpenMesh::FPropHandleT<double> faceProp;
+  mesh_.add_property(faceProp, "DFProp");
+  mesh_.property(faceProp).set_persistent(true);
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it)
+    mesh_.property(faceProp, *f_it) = 0.5 * f_it->idx();
+
+  const std::string filename       = "cube1-compressed.om";
+  const std::string filename_plain = "cube1-uncompressed.om";
+
+  OpenMesh::IO::Options options;
+  options += OpenMesh::IO::Options::VertexNormal;
+  options += OpenMesh::IO::Options::VertexColor;
+  options += OpenMesh::IO::Options::Connectivity;
+
+  ok = OpenMesh::IO::write_mesh(mesh_, filename_plain, options);
+  EXPECT_TRUE(ok) << "Unable to write " << filename_plain;
+
+  options += OpenMesh::IO::Options::Compressed;
+  ok = OpenMesh::IO::write_mesh(mesh_, filename, options);
+  EXPECT_TRUE(ok) << "Unable to write " << filename;
+
+  std::ifstream plain(filename_plain.c_str(), std::ios::binary | std::ios::ate);
+  std::ifstream compressed(filename.c_str(), std::ios::binary | std::ios::ate);
+  EXPECT_LT(compressed.tellg(), plain.tellg()) << "Compressed file is not smaller";
+  plain.close();
+  compressed.close();
+
+  Mesh cmpMesh;
+  cmpMesh.request_vertex_normals();
+  cmpMesh.request_vertex_colors();
+
+  OpenMesh::FPropHandleT<double> cmpFaceProp;
+  cmpMesh.add_property(cmpFaceProp, "DFProp");
+  cmpMesh.property(cmpFaceProp).set_persistent(true);
+
+  OpenMesh::IO::Options read_options = options;
+  ok = OpenMesh::IO::read_mesh(cmpMesh, filename, read_options);
+  EXPECT_TRUE(ok) << "Unable to read " << filename;
+  EXPECT_TRUE(read_options.check(OpenMesh::IO::Options::Compressed)) << "File has no compressed chunks";
+  EXPECT_TRUE(read_options.check(OpenMesh::IO::Options::Connectivity)) << "Connectivity has not been restored";
+
+  EXPECT_EQ(mesh_.n_vertices(), cmpMesh.n_vertices()) << "The number of loaded vertices is not correct!";
+  EXPECT_EQ(mesh_.n_edges(),    cmpMesh.n_edges())    << "The number of loaded edges is not correct!";
+  EXPECT_EQ(mesh_.n_faces(),    cmpMesh.n_faces())    << "The number of loaded faces is not correct!";
+
+  bool wrong = false;
+  for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end() && !wrong; ++v_it)
+    wrong = mesh_.point(*v_it)  != cmpMesh.point(*v_it)  ||
+            mesh_.normal(*v_it) != cmpMesh.normal(*v_it) ||
+            mesh_.color(*v_it)  != cmpMesh.color(*v_it);
+  EXPECT_FALSE(wrong) << "min one vertex differs";
+
+  wrong = false;
+  for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end() && !wrong; ++f_it) {
+    Mesh::ConstFaceVertexIter fv0 = mesh_.cfv_iter(*f_it);
+    Mesh::ConstFaceVertexIter fv1 = cmpMesh.cfv_iter(*f_it);
+    wrong = (mesh_.property(faceProp, *f_it) != cmpMesh.property(cmpFaceProp, *f_it)) ||
+            (*fv0 != *fv1);
+  }
+  EXPECT_FALSE(wrong) << "min one face differs";
+
+  // Without connectivity the faces are built from the compressed face list
+  Mesh plainMesh;
+  ok = OpenMesh::IO::read_mesh(plainMesh, filename);
+  EXPECT_TRUE(ok) << "Unable to read " << filename;
+  EXPECT_EQ(mesh_.n_faces(), plainMesh.n_faces()) << "The number of loaded faces is not correct!";
+
+  remove(filename.c_str());
+  remove(filename_plain.c_str());
+}
+
+/*
+ * Save a polygonal mesh with compressed chunks and load it again
+ */
+TEST_F(OpenMeshReadWriteOM, WriteReadPolyCompressed) {
+
+  PolyMesh mesh;
+  bool ok = OpenMesh::IO::read_mesh(mesh, "cube-minimal.obj");
+  ASSERT_TRUE(ok) << "Unable to read cube-minimal.obj";
+
+  const std::string filename = "cube-minimal-compressed.om";
+
+  ok = OpenMesh::IO::write_mesh(mesh, filename, OpenMesh::IO::Options::Compressed);
+  EXPECT_TRUE(ok) << "Unable to write " << filename;
+
+  PolyMesh cmpMesh;
+  ok = OpenMesh::IO::read_mesh(cmpMesh, filename);
+  EXPECT_TRUE(ok) << "Unable to read " << filename;
+
+  EXPECT_EQ(mesh.n_vertices(), cmpMesh.n_vertices()) << "The number of loaded vertices is not correct!";
+  EXPECT_EQ(mesh.n_faces(),    cmpMesh.n_faces())    << "The number of loaded faces is not correct!";
+
+  bool wrong = false;
+  for (PolyMesh::VertexIter v_it = mesh.vertices_begin(); v_it != mesh.vertices_end() && !wrong; ++v_it)
+    wrong = mesh.point(*v_it) != cmpMesh.point(*v_it);
+  EXPECT_FALSE(wrong) << "min one vertex differs";
+
+  wrong = false;
+  for (PolyMesh::FaceIter f_it = mesh.faces_begin(); f_it != mesh.faces_end() && !wrong; ++f_it)
+    wrong = mesh.valence(*f_it) != cmpMesh.valence(*f_it);
+  EXPECT_FALSE(wrong) << "min one face has a different valence";
+
+  remove(filename.c_str());
+}
+
+/*
+ * Sizes from a corrupt file are rejected before anything is allocated
+ */
+TEST_F(OpenMeshReadWriteOM, DecompressCorruptSizes) {
+
+  using namespace OpenMesh::IO::OMFormat;
+
+  const char  packed[] = { 0x10, 0x41 };
+  std::string raw;
+  const size_t huge = size_t(0xffffffffu);
+
+  EXPECT_FALSE(decompress(Chunk::Codec_None,        4, 1, packed, 2, huge, raw)) << "Codec_None accepted a wrong size";
+  EXPECT_FALSE(decompress(Chunk::Codec_DeltaVarint, 4, 4, packed, 2, huge & ~size_t(3), raw)) << "Codec_DeltaVarint accepted a huge size";
+  EXPECT_FALSE(decompress(Chunk::Codec_LZ,          1, 1, packed, 2, huge, raw)) << "Codec_LZ accepted a huge size";
+  EXPECT_GT(size_t(1024), raw.capacity()) << "Memory allocated for a corrupt size";
+
+  EXPECT_TRUE(decompress(Chunk::Codec_LZ, 1, 1, packed, 2, 1, raw)) << "Valid LZ data rejected";
+  EXPECT_EQ(std::string("A"), raw);
+}
+
+/*
+ * A truncated compressed file fails to load instead of throwing
+ */
+TEST_F(OpenMeshReadWriteOM, ReadTruncatedCompressed) {
+
+  Mesh mesh;
+  bool ok = OpenMesh::IO::read_mesh(mesh, "cube1.off");
+  ASSERT_TRUE(ok) << "Unable to read cube1.off";
+
+  const std::string filename = "cube1-compressed.om";
+  const std::string truncated_filename = "cube1-truncated.om";
+
+  ok = OpenMesh::IO::write_mesh(mesh, filename, OpenMesh::IO::Options::Compressed);
+  ASSERT_TRUE(ok) << "Unable to write " << filename;
+
+  std::ifstream in(filename.c_str(), std::ios::binary);
+  std::stringstream buffer;
+  buffer << in.rdbuf();
+  const std::string data = buffer.str();
+  ASSERT_LT(size_t(100000), data.size());
+
+  for (size_t cut = 1; cut < 100000; cut *= 10) {
+    {
+      std::ofstream out(truncated_filename.c_str(), std::ios::binary);
+      out.write(data.data(), data.size() - cut);
+    }
+
+    Mesh cmpMesh;
+    EXPECT_NO_THROW(ok = OpenMesh::IO::read_mesh(cmpMesh, truncated_filename)) << "Cut " << cut;
+    EXPECT_FALSE(ok) << "Truncated file read successfully, cut " << cut;
+  }
+
+  remove(filename.c_str());
+  remove(truncated_filename.c_str());
+}
+
 }
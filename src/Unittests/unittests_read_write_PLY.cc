@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 
+#include <fstream>
+
 
 namespace {
 
@@ -667,4 +669,152 @@ TEST_F(OpenMeshReadWritePLY, WriteReadSimplePLYWithCustomProps) {
     remove(outFilename);
 
 }
+/*
+ * Write a grid with normals and colors as little and big endian binary ply
+ * and read it back. This covers the block decoder of the binary reader.
+ */
+TEST_F(OpenMeshReadWritePLY, WriteAndReadBinaryPLYGridLSBAndMSB) {
+
+  const int n = 40;
+
+  Mesh grid;
+  grid.request_vertex_normals();
+  grid.request_vertex_colors();
+
+  std::vector<Mesh::VertexHandle> vhandles;
+  for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i) {
+      Mesh::VertexHandle vh = grid.add_vertex(Mesh::Point(0.5f * i, -0.25f * j, float(i*j) / n));
+      grid.set_normal(vh, Mesh::Normal(0.0f, float(i) / n, 1.0f));
+      grid.set_color(vh, Mesh::Color((unsigned char)(i), (unsigned char)(j), (unsigned char)(i+j)));
+      vhandles.push_back(vh);
+    }
+
+  for (int j = 0; j < n-1; ++j)
+    for (int i = 0; i < n-1; ++i) {
+      const int v = j*n + i;
+      grid.add_face(vhandles[v], vhandles[v+1], vhandles[v+n+1]);
+      grid.add_face(vhandles[v], vhandles[v+n+1], vhandles[v+n]);
+    }
+
+  for (int msb = 0; msb < 2; ++msb) {
+
+    OpenMesh::IO::Options options;
+    options += OpenMesh::IO::Options::Binary;
+    options += OpenMesh::IO::Options::VertexNormal;
+    options += OpenMesh::IO::Options::VertexColor;
+    if (msb)
+      options += OpenMesh::IO::Options::MSB;
+
+    bool ok = OpenMesh::IO::write_mesh(grid, "grid_binary.ply", options);
+    EXPECT_TRUE(ok) << "Unable to write grid_binary.ply";
+
+    mesh_.clear();
+    mesh_.request_vertex_normals();
+    mesh_.request_vertex_colors();
+
+    OpenMesh::IO::Options read_options;
+    read_options += OpenMesh::IO::Options::VertexNormal;
+    read_options += OpenMesh::IO::Options::VertexColor;
+    ok = OpenMesh::IO::read_mesh(mesh_, "grid_binary.ply", read_options);
+    EXPECT_TRUE(ok) << "Unable to load grid_binary.ply";
+
+    ASSERT_EQ(grid.n_vertices(), mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    ASSERT_EQ(grid.n_faces(),    mesh_.n_faces())    << "The number of loaded faces is not correct!";
+
+    for (Mesh::VertexIter v_it = grid.vertices_begin(); v_it != grid.vertices_end(); ++v_it) {
+      EXPECT_EQ(grid.point(*v_it),  mesh_.point(*v_it))  << "Wrong point at vertex " << v_it->idx();
+      EXPECT_EQ(grid.normal(*v_it), mesh_.normal(*v_it)) << "Wrong normal at vertex " << v_it->idx();
+      EXPECT_EQ(grid.color(*v_it),  mesh_.color(*v_it))  << "Wrong color at vertex " << v_it->idx();
+    }
+
+    for (Mesh::FaceIter f_it = grid.faces_begin(); f_it != grid.faces_end(); ++f_it) {
+      Mesh::FaceVertexIter fv_grid = grid.fv_iter(*f_it);
+      Mesh::FaceVertexIter fv_read = mesh_.fv_iter(*f_it);
+      for (; fv_grid.is_valid() && fv_read.is_valid(); ++fv_grid, ++fv_read)
+        EXPECT_EQ((*fv_grid).idx(), (*fv_read).idx()) << "Wrong vertex of face " << f_it->idx();
+    }
+
+    EXPECT_TRUE(read_options.vertex_has_normal()) << "Wrong user options are returned!";
+    EXPECT_TRUE(read_options.vertex_has_color())  << "Wrong user options are returned!";
+
+    mesh_.release_vertex_normals();
+    mesh_.release_vertex_colors();
+  }
+
+  remove("grid_binary.ply");
+}
+
+/*
+ * Write a polygonal mesh with face texcoords as binary ply.
+ * binary_size() has to predict the size of the file and the data has to
+ * be read back.
+ */
+TEST_F(OpenMeshReadWritePLY, WriteAndReadBinaryPLYPolyWithFaceTexcoords) {
+
+  const int n = 30;
+
+  PolyMesh poly;
+  poly.request_halfedge_texcoords2D();
+
+  std::vector<PolyMesh::VertexHandle> vhandles;
+  for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i)
+      vhandles.push_back(poly.add_vertex(PolyMesh::Point(float(i), float(j), 0.0f)));
+
+  std::vector<PolyMesh::VertexHandle> face_vhandles;
+  for (int j = 0; j < n-1; ++j)
+    for (int i = 0; i < n-1; ++i) {
+      const int v = j*n + i;
+      face_vhandles.clear();
+      face_vhandles.push_back(vhandles[v]);
+      face_vhandles.push_back(vhandles[v+1]);
+      face_vhandles.push_back(vhandles[v+n+1]);
+      if ((i + j) % 2)
+        face_vhandles.push_back(vhandles[v+n]);
+      else {
+        poly.add_face(face_vhandles);
+        face_vhandles.erase(face_vhandles.begin() + 1);
+        face_vhandles.push_back(vhandles[v+n]);
+      }
+      poly.add_face(face_vhandles);
+    }
+
+  for (PolyMesh::HalfedgeIter h_it = poly.halfedges_begin(); h_it != poly.halfedges_end(); ++h_it)
+    poly.set_texcoord2D(*h_it, PolyMesh::TexCoord2D(0.5f * h_it->idx(), 1.0f));
+
+  OpenMesh::IO::Options options;
+  options += OpenMesh::IO::Options::Binary;
+  options += OpenMesh::IO::Options::FaceTexCoord;
+
+  bool ok = OpenMesh::IO::write_mesh(poly, "poly_binary.ply", options);
+  EXPECT_TRUE(ok) << "Unable to write poly_binary.ply";
+
+  std::ifstream ifs("poly_binary.ply", std::ios::binary | std::ios::ate);
+  EXPECT_EQ(size_t(ifs.tellg()), OpenMesh::IO::binary_size(poly, "poly_binary.ply", options))
+    << "binary_size() does not match the size of the file";
+  ifs.close();
+
+  PolyMesh loaded;
+  loaded.request_halfedge_texcoords2D();
+
+  ok = OpenMesh::IO::read_mesh(loaded, "poly_binary.ply", options);
+  EXPECT_TRUE(ok) << "Unable to load poly_binary.ply";
+
+  ASSERT_EQ(poly.n_vertices(), loaded.n_vertices()) << "The number of loaded vertices is not correct!";
+  ASSERT_EQ(poly.n_faces(),    loaded.n_faces())    << "The number of loaded faces is not correct!";
+
+  for (PolyMesh::FaceIter f_it = poly.faces_begin(); f_it != poly.faces_end(); ++f_it) {
+    PolyMesh::FaceHalfedgeIter fh_poly = poly.fh_iter(*f_it);
+    PolyMesh::FaceHalfedgeIter fh_read = loaded.fh_iter(*f_it);
+    for (; fh_poly.is_valid() && fh_read.is_valid(); ++fh_poly, ++fh_read) {
+      EXPECT_EQ(poly.to_vertex_handle(*fh_poly), loaded.to_vertex_handle(*fh_read)) << "Wrong vertex of face " << f_it->idx();
+      EXPECT_EQ(poly.texcoord2D(*fh_poly), loaded.texcoord2D(*fh_read)) << "Wrong texcoord of face " << f_it->idx();
+    }
+    EXPECT_FALSE(fh_poly.is_valid() || fh_read.is_valid()) << "Wrong valence of face " << f_it->idx();
+  }
+
+  remove("poly_binary.ply");
+}
+
 }
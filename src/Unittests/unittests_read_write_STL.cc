@@ -1,6 +1,11 @@
 
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/IO/reader/STLReader.hh>
+
+#include <fstream>
+#include <iterator>
+#include <sstream>
 
 
 namespace {
@@ -205,4 +210,110 @@ TEST_F(OpenMeshReadWriteSTL, ReadWriteSimpleSTLBinaryFileWithNormals) {
 }
 
 
+/*
+ * The memory mapped binary reader (used when reading from a file) and the
+ * stream based reader have to produce identical meshes
+ */
+TEST_F(OpenMeshReadWriteSTL, LoadSimpleSTLBinaryFileMappedVsStream) {
+
+    mesh_.clear();
+
+    OpenMesh::IO::Options opt;
+    opt += OpenMesh::IO::Options::Binary;
+
+    bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1Binary.stl", opt);
+
+    EXPECT_TRUE(ok);
+
+    Mesh stream_mesh;
+
+    std::ifstream ifs("cube1Binary.stl", std::ios::binary);
+
+    ASSERT_TRUE(ifs.is_open());
+
+    OpenMesh::IO::ImporterT<Mesh> importer(stream_mesh);
+    OpenMesh::IO::Options stream_opt = OpenMesh::IO::Options::Binary;
+
+    ok = OpenMesh::IO::STLReader().read(ifs, importer, stream_opt);
+
+    EXPECT_TRUE(ok);
+
+    ASSERT_EQ(stream_mesh.n_vertices(), mesh_.n_vertices()) << "The number of loaded vertices differs!";
+    ASSERT_EQ(stream_mesh.n_faces(), mesh_.n_faces()) << "The number of loaded faces differs!";
+    EXPECT_EQ(stream_mesh.n_edges(), mesh_.n_edges()) << "The number of loaded edges differs!";
+
+    for (Mesh::VertexIter v_it = mesh_.vertices_begin(); v_it != mesh_.vertices_end(); ++v_it)
+      EXPECT_EQ(stream_mesh.point(*v_it), mesh_.point(*v_it)) << "Point differs at vertex " << v_it->idx();
+
+    for (Mesh::FaceIter f_it = mesh_.faces_begin(); f_it != mesh_.faces_end(); ++f_it) {
+      Mesh::FaceVertexIter fv_it  = mesh_.fv_iter(*f_it);
+      Mesh::FaceVertexIter sfv_it = stream_mesh.fv_iter(*f_it);
+      for (; fv_it.is_valid(); ++fv_it, ++sfv_it)
+        EXPECT_EQ(sfv_it->idx(), fv_it->idx()) << "Vertex index differs at face " << f_it->idx();
+    }
+}
+
+/*
+ * Corners that differ by less than the epsilon of the reader are merged
+ */
+TEST_F(OpenMeshReadWriteSTL, LoadSTLWithEpsilon) {
+
+    const char* stla =
+      "solid gap\n"
+      "facet normal 0 0 1\n outer loop\n"
+      "  vertex 0 0 0\n  vertex 1 0 0\n  vertex 0 1 0\n"
+      " endloop\nendfacet\n"
+      "facet normal 0 0 1\n outer loop\n"
+      "  vertex 1.0001 0 0\n  vertex 1 1 0\n  vertex 0 1.0001 0\n"
+      " endloop\nendfacet\n"
+      "endsolid gap\n";
+
+    OpenMesh::IO::_STLReader_& reader = OpenMesh::IO::STLReader();
+    const float eps = reader.epsilon();
+
+    OpenMesh::IO::ImporterT<Mesh> importer(mesh_);
+    OpenMesh::IO::Options opt;
+
+    mesh_.clear();
+    std::istringstream exact(stla);
+    EXPECT_TRUE(reader.read(exact, importer, opt));
+    EXPECT_EQ(6u, mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+
+    reader.set_epsilon(0.001f);
+
+    mesh_.clear();
+    std::istringstream welded(stla);
+    EXPECT_TRUE(reader.read(welded, importer, opt));
+
+    reader.set_epsilon(eps);
+
+    EXPECT_EQ(4u, mesh_.n_vertices()) << "The number of loaded vertices is not correct!";
+    EXPECT_EQ(2u, mesh_.n_faces()) << "The number of loaded faces is not correct!";
+    EXPECT_EQ(5u, mesh_.n_edges()) << "The number of loaded edges is not correct!";
+}
+
+/*
+ * A binary stream that ends before the announced number of triangles is
+ * read up to its end
+ */
+TEST_F(OpenMeshReadWriteSTL, LoadTruncatedSTLBinaryStream) {
+
+    std::ifstream ifs("cube1Binary.stl", std::ios::binary);
+    ASSERT_TRUE(ifs.is_open());
+
+    std::string data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    ASSERT_GT(data.size(), 84u + 10*50u);
+
+    // the header still announces all triangles
+    std::istringstream truncated(data.substr(0, 84 + 10*50 + 25), std::ios::binary);
+
+    mesh_.clear();
+    OpenMesh::IO::ImporterT<Mesh> importer(mesh_);
+    OpenMesh::IO::Options opt = OpenMesh::IO::Options::Binary;
+
+    EXPECT_TRUE(OpenMesh::IO::STLReader().read(truncated, importer, opt));
+
+    EXPECT_EQ(10u, mesh_.n_faces()) << "The number of loaded faces is not correct!";
+}
+
 }
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+
+namespace {
+
+class OpenMeshReadWriteThreads : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+};
+
+/*
+ * What a read returned, compared between the serial and the
+ * concurrent reads of the same file.
+ */
+struct ReadResult {
+
+    ReadResult() : ok(false), n_vertices(0), n_faces(0), point_sum(0,0,0), color_sum(0),
+                   vertex_colors(false), face_colors(false), binary(false) {}
+
+    bool operator==(const ReadResult& _other) const {
+      return ok == _other.ok && n_vertices == _other.n_vertices && n_faces == _other.n_faces &&
+             point_sum == _other.point_sum && color_sum == _other.color_sum &&
+             vertex_colors == _other.vertex_colors && face_colors == _other.face_colors &&
+             binary == _other.binary;
+    }
+
+    bool            ok;
+    size_t          n_vertices;
+    size_t          n_faces;
+    OpenMesh::Vec3d point_sum;
+    size_t          color_sum;
+    bool            vertex_colors;
+    bool            face_colors;
+    bool            binary;
+};
+
+/*
+ * Read _filename with vertex and face colors into _mesh
+ */
+ReadResult read_file(const std::string& _filename, Mesh& _mesh) {
+
+    _mesh.clear();
+    _mesh.request_vertex_colors();
+    _mesh.request_face_colors();
+
+    OpenMesh::IO::Options opt;
+    opt += OpenMesh::IO::Options::VertexColor;
+    opt += OpenMesh::IO::Options::FaceColor;
+
+    ReadResult result;
+    result.ok = OpenMesh::IO::read_mesh(_mesh, _filename, opt);
+
+    result.n_vertices    = _mesh.n_vertices();
+    result.n_faces       = _mesh.n_faces();
+    // STL has no colors, the reader leaves the requested options set and
+    // the color properties uninitialized
+    const bool stl = _filename.find(".stl") != std::string::npos;
+
+    result.vertex_colors = opt.vertex_has_color() && !stl;
+    result.face_colors   = opt.face_has_color() && !stl;
+    result.binary        = opt.is_binary();
+
+    for (Mesh::VertexIter v_it = _mesh.vertices_begin(); v_it != _mesh.vertices_end(); ++v_it) {
+      result.point_sum += OpenMesh::vector_cast<OpenMesh::Vec3d>(_mesh.point(*v_it));
+      if (result.vertex_colors)
+        result.color_sum += _mesh.color(*v_it)[0] + _mesh.color(*v_it)[1] + _mesh.color(*v_it)[2];
+    }
+
+    if (result.face_colors)
+      for (Mesh::FaceIter f_it = _mesh.faces_begin(); f_it != _mesh.faces_end(); ++f_it)
+        result.color_sum += _mesh.color(*f_it)[0] + _mesh.color(*f_it)[1] + _mesh.color(*f_it)[2];
+
+    return result;
+}
+
+/*
+ * Read and write files of all formats from several threads at the same
+ * time. Every read has to return what a serial read of the same file
+ * returned, and every written file has to be readable again.
+ */
+TEST_F(OpenMeshReadWriteThreads, ReadAndWriteFromSeveralThreads) {
+
+    // Binary variants of the ascii files, written serially before
+    ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "cube1.off"));
+    ASSERT_TRUE(OpenMesh::IO::write_mesh(mesh_, "threads_cube1_binary.off", OpenMesh::IO::Options::Binary));
+    ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "meshlab.ply"));
+    ASSERT_TRUE(OpenMesh::IO::write_mesh(mesh_, "threads_meshlab_binary.ply", OpenMesh::IO::Options::Binary));
+
+    std::vector<std::string> files;
+    files.push_back("cube1.off");
+    files.push_back("threads_cube1_binary.off");
+    files.push_back("meshlab.ply");
+    files.push_back("threads_meshlab_binary.ply");
+    files.push_back("cube-minimal-vertexColors.ply");
+    files.push_back("cube-minimal.obj");
+    files.push_back("cube-minimal-vertex-colors-as-vc-lines.obj");
+    files.push_back("square_material.obj");
+    files.push_back("cube1.stl");
+    files.push_back("cube1Binary.stl");
+    files.push_back("cube-minimal.om");
+    files.push_back("cube-minimal-vertexColors.om");
+    files.push_back("cube1_customProps.om");
+
+    const char* formats[] = { "obj", "off", "ply", "om", "stl" };
+    const int   n_formats = 5;
+
+    // Serial reference
+    std::vector<ReadResult> expected(files.size());
+    for (size_t i = 0; i < files.size(); ++i) {
+      expected[i] = read_file(files[i], mesh_);
+      EXPECT_TRUE(expected[i].ok) << files[i] << " could not be read!";
+    }
+
+    const int n_files = int(files.size());
+    const int n_jobs  = 8 * n_files;
+
+    std::vector<int> read_failed(n_jobs, 0);
+    std::vector<int> write_failed(n_jobs, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) num_threads(8)
+#endif
+    for (int job = 0; job < n_jobs; ++job) {
+
+      // Jobs next to each other read different formats
+      const int file = (job * 7) % n_files;
+
+      Mesh mesh;
+      const ReadResult result = read_file(files[file], mesh);
+
+      if (!(result == expected[file])) {
+        read_failed[job] = 1;
+        continue;
+      }
+
+      // Write the mesh in another format and read it back
+      const std::string format = formats[job % n_formats];
+
+      std::ostringstream base;
+      base << "threads_output_" << job;
+      const std::string name = base.str() + "." + format;
+
+      OpenMesh::IO::Options wopt;
+      if (job % 2 && format != "obj")
+        wopt += OpenMesh::IO::Options::Binary;
+      if (result.face_colors && format == "obj")
+        wopt += OpenMesh::IO::Options::FaceColor;
+
+      Mesh copy;
+      if (!OpenMesh::IO::write_mesh(mesh, name, wopt) ||
+          !OpenMesh::IO::read_mesh(copy, name) ||
+          copy.n_vertices() != mesh.n_vertices() ||
+          copy.n_faces() != mesh.n_faces())
+        write_failed[job] = 1;
+
+      std::remove(name.c_str());
+      if (wopt.face_has_color())
+        std::remove((base.str() + ".mtl").c_str());
+    }
+
+    for (int job = 0; job < n_jobs; ++job) {
+      EXPECT_EQ(0, read_failed[job])  << "Concurrent read of " << files[(job * 7) % n_files] << " differs from the serial read";
+      EXPECT_EQ(0, write_failed[job]) << "Concurrent write of " << files[(job * 7) % n_files] << " as "
+                                      << formats[job % n_formats] << " failed";
+    }
+}
+
+}
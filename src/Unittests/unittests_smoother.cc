@@ -126,4 +126,106 @@ TEST_F(OpenMeshSmoother_Poly, Smoother_Triangle_Laplace) {
 }
 
 
+/*
+ * Smooth with one and with four threads. The results have to be identical.
+ */
+TEST_F(OpenMeshSmoother_Triangle, Smoother_Laplace_MultiThreaded) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  const OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Component components[] = {
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Tangential,
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Tangential_and_Normal,
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Normal
+  };
+
+  const OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Continuity continuities[] = {
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::C0,
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::C1,
+    OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::C0
+  };
+
+  for (int run = 0; run < 3; ++run) {
+
+    Mesh serial   = mesh_;
+    Mesh parallel = mesh_;
+
+    {
+      OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh> smoother(serial);
+      smoother.initialize(components[run], continuities[run]);
+      if (run == 1)
+        smoother.set_relative_local_error(0.001f);
+      smoother.smooth(5);
+    }
+
+    {
+      OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh> smoother(parallel);
+      smoother.set_num_threads(4);
+      smoother.initialize(components[run], continuities[run]);
+      if (run == 1)
+        smoother.set_relative_local_error(0.001f);
+      smoother.smooth(5);
+    }
+
+    size_t n_moved = 0;
+
+    for (Mesh::VertexIter v_it = serial.vertices_begin(); v_it != serial.vertices_end(); ++v_it) {
+      EXPECT_EQ(serial.point(*v_it), parallel.point(*v_it)) << "Different result at vertex " << v_it->idx() << " in run " << run;
+      if (serial.point(*v_it) != mesh_.point(*v_it))
+        ++n_moved;
+    }
+
+    EXPECT_GT(n_moved, 0u) << "Smoother did not move any vertex in run " << run;
+  }
+}
+
+/*
+ * C1 smoothing reads the umbrellas of all neighbours, a hidden neighbour
+ * must not change the result of an active vertex.
+ */
+TEST_F(OpenMeshSmoother_Triangle, Smoother_Laplace_C1_HiddenNeighbour) {
+
+  mesh_.clear();
+
+  bool ok = OpenMesh::IO::read_mesh(mesh_, "cube1.off");
+
+  ASSERT_TRUE(ok);
+
+  Mesh reference = mesh_;
+  Mesh hidden    = mesh_;
+
+  hidden.request_vertex_status();
+  const Mesh::VertexHandle vh(0);
+  hidden.status(vh).set_hidden(true);
+
+  for (int threads = 1; threads <= 4; threads += 3) {
+
+    Mesh a = reference;
+    Mesh b = hidden;
+
+    {
+      OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh> smoother(a);
+      smoother.set_num_threads(threads);
+      smoother.initialize(OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Tangential_and_Normal,
+                          OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::C1);
+      smoother.smooth(1);
+    }
+
+    {
+      OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh> smoother(b);
+      smoother.set_num_threads(threads);
+      smoother.initialize(OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::Tangential_and_Normal,
+                          OpenMesh::Smoother::JacobiLaplaceSmootherT<Mesh>::C1);
+      smoother.smooth(1);
+    }
+
+    for (Mesh::VertexVertexIter vv_it = a.vv_iter(vh); vv_it.is_valid(); ++vv_it)
+      EXPECT_EQ(a.point(*vv_it), b.point(*vv_it)) << "Neighbour " << vv_it->idx() << " of the hidden vertex differs with " << threads << " threads";
+  }
+}
+
 }
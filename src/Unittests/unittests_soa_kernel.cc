@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+
+#include <iostream>
+
+namespace {
+
+struct SoATraits : public OpenMesh::DefaultTraits {
+  VertexAttributes(OpenMesh::Attributes::SoA | OpenMesh::Attributes::Status);
+  FaceAttributes(OpenMesh::Attributes::Status);
+  EdgeAttributes(OpenMesh::Attributes::Status);
+};
+
+typedef OpenMesh::TriMesh_ArrayKernelT<SoATraits> SoAMesh;
+
+class OpenMeshSoAKernel : public OpenMeshBase {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+
+    // Member already defined in OpenMeshBase
+    //Mesh mesh_;
+
+    SoAMesh soa_mesh_;
+};
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Load a mesh into a default and a SoA mesh and compare points and normals
+ */
+TEST_F(OpenMeshSoAKernel, LoadAndUpdateNormals) {
+
+  mesh_.clear();
+  soa_mesh_.clear();
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "cube1.off")) << "Could not load cube1.off";
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(soa_mesh_, "cube1.off")) << "Could not load cube1.off";
+
+  ASSERT_EQ(mesh_.n_vertices(), soa_mesh_.n_vertices()) << "Wrong number of vertices";
+  ASSERT_EQ(mesh_.n_faces(),    soa_mesh_.n_faces())    << "Wrong number of faces";
+
+  mesh_.request_vertex_normals();
+  mesh_.request_face_normals();
+  mesh_.update_normals();
+
+  soa_mesh_.request_vertex_normals();
+  soa_mesh_.request_face_normals();
+  soa_mesh_.update_normals();
+
+  for (unsigned int i = 0; i < mesh_.n_vertices(); ++i) {
+    Mesh::VertexHandle vh(i);
+    EXPECT_EQ(mesh_.point(vh),  soa_mesh_.point(vh))  << "Wrong point at vertex "  << i;
+    EXPECT_EQ(mesh_.normal(vh), soa_mesh_.normal(vh)) << "Wrong normal at vertex " << i;
+  }
+
+  for (int c = 0; c < 3; ++c) {
+    const float* points  = soa_mesh_.point_coordinates(c);
+    const float* normals = soa_mesh_.vertex_normal_coordinates(c);
+
+    EXPECT_EQ(0u, reinterpret_cast<size_t>(points)  % 64) << "Points are not aligned";
+    EXPECT_EQ(0u, reinterpret_cast<size_t>(normals) % 64) << "Normals are not aligned";
+
+    for (unsigned int i = 0; i < mesh_.n_vertices(); ++i) {
+      EXPECT_EQ(mesh_.point(Mesh::VertexHandle(i))[c],  points[i])  << "Wrong coordinate at vertex " << i;
+      EXPECT_EQ(mesh_.normal(Mesh::VertexHandle(i))[c], normals[i]) << "Wrong normal coordinate at vertex " << i;
+    }
+  }
+}
+
+/*
+ * Compute a bounding box on the coordinate arrays and modify points
+ */
+TEST_F(OpenMeshSoAKernel, CoordinateArrays) {
+
+  soa_mesh_.clear();
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(soa_mesh_, "cube1.off")) << "Could not load cube1.off";
+
+  const int n = int(soa_mesh_.n_vertices());
+
+  float bb_min[3], bb_max[3];
+  for (int c = 0; c < 3; ++c) {
+    const float* x = soa_mesh_.point_coordinates(c);
+    bb_min[c] = bb_max[c] = x[0];
+    for (int i = 1; i < n; ++i) {
+      bb_min[c] = std::min(bb_min[c], x[i]);
+      bb_max[c] = std::max(bb_max[c], x[i]);
+    }
+  }
+
+  SoAMesh::Point p_min = soa_mesh_.point(SoAMesh::VertexHandle(0));
+  SoAMesh::Point p_max = p_min;
+  for (SoAMesh::VertexIter v_it = soa_mesh_.vertices_begin(); v_it != soa_mesh_.vertices_end(); ++v_it) {
+    p_min.minimize(soa_mesh_.point(*v_it));
+    p_max.maximize(soa_mesh_.point(*v_it));
+  }
+
+  for (int c = 0; c < 3; ++c) {
+    EXPECT_EQ(p_min[c], bb_min[c]) << "Wrong bounding box minimum";
+    EXPECT_EQ(p_max[c], bb_max[c]) << "Wrong bounding box maximum";
+  }
+
+  // Translate the mesh through the arrays and check with point()
+  const float y0 = soa_mesh_.point(SoAMesh::VertexHandle(0))[1];
+
+  float* y = soa_mesh_.point_coordinates(1);
+  for (int i = 0; i < n; ++i)
+    y[i] += 2.0f;
+
+  EXPECT_EQ(y0 + 2.0f, soa_mesh_.point(SoAMesh::VertexHandle(0))[1]) << "Translation not visible through point()";
+
+  // set_point() writes into the arrays
+  soa_mesh_.set_point(SoAMesh::VertexHandle(3), SoAMesh::Point(1.0f, 2.0f, 3.0f));
+
+  EXPECT_EQ(1.0f, soa_mesh_.point_coordinates(0)[3]) << "Wrong x coordinate after set_point";
+  EXPECT_EQ(2.0f, soa_mesh_.point_coordinates(1)[3]) << "Wrong y coordinate after set_point";
+  EXPECT_EQ(3.0f, soa_mesh_.point_coordinates(2)[3]) << "Wrong z coordinate after set_point";
+  EXPECT_EQ(SoAMesh::Point(1.0f, 2.0f, 3.0f), soa_mesh_.point(SoAMesh::VertexHandle(3))) << "Wrong point after set_point";
+}
+
+/*
+ * Delete vertices and collect garbage. Points have to move with their vertices.
+ */
+TEST_F(OpenMeshSoAKernel, GarbageCollectionAndCopy) {
+
+  mesh_.clear();
+  soa_mesh_.clear();
+
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(mesh_, "cube1.off")) << "Could not load cube1.off";
+  ASSERT_TRUE(OpenMesh::IO::read_mesh(soa_mesh_, "cube1.off")) << "Could not load cube1.off";
+
+  mesh_.request_vertex_status();
+  mesh_.request_edge_status();
+  mesh_.request_face_status();
+
+  mesh_.delete_vertex(Mesh::VertexHandle(0));
+  mesh_.delete_vertex(Mesh::VertexHandle(5));
+  mesh_.garbage_collection();
+
+  soa_mesh_.delete_vertex(SoAMesh::VertexHandle(0));
+  soa_mesh_.delete_vertex(SoAMesh::VertexHandle(5));
+  soa_mesh_.garbage_collection();
+
+  ASSERT_EQ(mesh_.n_vertices(), soa_mesh_.n_vertices()) << "Wrong number of vertices after garbage collection";
+
+  for (unsigned int i = 0; i < mesh_.n_vertices(); ++i)
+    EXPECT_EQ(mesh_.point(Mesh::VertexHandle(i)), soa_mesh_.point(SoAMesh::VertexHandle(i))) << "Point did not move with its vertex " << i;
+
+  SoAMesh copy = soa_mesh_;
+
+  ASSERT_EQ(soa_mesh_.n_vertices(), copy.n_vertices()) << "Wrong number of vertices in copy";
+
+  for (SoAMesh::VertexIter v_it = copy.vertices_begin(); v_it != copy.vertices_end(); ++v_it)
+    EXPECT_EQ(soa_mesh_.point(*v_it), copy.point(*v_it)) << "Wrong point in copy";
+
+  EXPECT_NE(soa_mesh_.point_coordinates(0), copy.point_coordinates(0)) << "Copy shares the coordinate arrays";
+}
+
+}
@@ -3,6 +3,7 @@
 #include <Unittests/unittests_common.hh>
 #include <OpenMesh/Tools/Subdivider/Adaptive/Composite/CompositeT.hh>
 #include <OpenMesh/Tools/Subdivider/Adaptive/Composite/RulesT.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
 
 namespace {
 
@@ -299,4 +300,115 @@ TEST_F(OpenMeshSubdividerAdaptive_Triangle, AdaptiveCompositeRefineFace) {
   EXPECT_EQ(458u, mesh.n_faces() )    << "Wrong number of faces after subdivision with sqrt3";
 
 }
+
+/*
+ * Build the test mesh of the tests above
+ */
+void fill_mesh(MyMesh& _mesh, std::vector<VHandle>& _vhandles, std::vector<FHandle>& _fhandles) {
+
+  _mesh.request_vertex_status();
+  _mesh.request_edge_status();
+  _mesh.request_face_status();
+
+  _mesh.request_vertex_normals();
+  _mesh.request_face_normals();
+
+  //  6 === 7 === 8
+  //  |   / |   / |
+  //  |  /  |  /  |
+  //  | /   | /   |
+  //  3 === 4 === 5
+  //  |   / | \   |
+  //  |  /  |  \  |
+  //  | /   |   \ |
+  //  0 === 1 === 2
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      _vhandles.push_back(_mesh.add_vertex(MyMesh::Point(i, j, 0)));
+
+  const int faces[8][3] = { {0, 4, 3}, {0, 1, 4}, {1, 2, 4}, {2, 5, 4},
+                            {3, 7, 6}, {3, 4, 7}, {4, 8, 7}, {4, 5, 8} };
+
+  for (int i = 0; i < 8; ++i)
+    _fhandles.push_back(_mesh.add_face(_vhandles[faces[i][0]], _vhandles[faces[i][1]], _vhandles[faces[i][2]]));
+}
+
+TEST_F(OpenMeshSubdividerAdaptive_Triangle, AdaptiveCompositeRefineFaceBatch) {
+
+  MyMesh               mesh;
+  std::vector<VHandle> vhandles;
+  std::vector<FHandle> fhandles;
+
+  fill_mesh(mesh, vhandles, fhandles);
+
+  // Initialize subdivider
+  OpenMesh::Subdivider::Adaptive::CompositeT<MyMesh> subdivider(mesh);
+
+  subdivider.add<OpenMesh::Subdivider::Adaptive::Tvv3<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::VF<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::FF<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::FVc<MyMesh> >();
+  subdivider.initialize();
+
+  for (size_t i = 0; i < fhandles.size(); ++i)
+    EXPECT_EQ(0, subdivider.level(fhandles[i]) ) << "Wrong initial level of face " << i;
+
+  // Refining all faces to level one is one uniform sqrt3 step. Calling
+  // refine(FaceHandle&) for each face would refine the faces that were
+  // already raised as neighbours again.
+  subdivider.refine(fhandles, 1);
+
+  EXPECT_EQ(17u, mesh.n_vertices() ) << "Wrong number of vertices after batch subdivision with sqrt3";
+  EXPECT_EQ(24u, mesh.n_faces() )    << "Wrong number of faces after batch subdivision with sqrt3";
+
+  for (size_t i = 0; i < fhandles.size(); ++i)
+    EXPECT_EQ(1, subdivider.level(fhandles[i]) ) << "Wrong level of face " << i;
+
+  // Different target levels
+  std::vector<int> levels(fhandles.size(), 2);
+  levels[0] = 3;
+  levels[7] = 1;
+
+  subdivider.refine(fhandles, levels);
+
+  for (size_t i = 0; i < fhandles.size(); ++i)
+    EXPECT_LE(levels[i], subdivider.level(fhandles[i]) ) << "Face " << i << " not refined to its target level";
+
+  EXPECT_TRUE( OpenMesh::Utils::MeshCheckerT<MyMesh>(mesh).check() ) << "Inconsistent mesh after batch subdivision";
+}
+
+TEST_F(OpenMeshSubdividerAdaptive_Triangle, AdaptiveCompositeRefineVertexBatch) {
+
+  MyMesh               mesh;
+  std::vector<VHandle> vhandles;
+  std::vector<FHandle> fhandles;
+
+  fill_mesh(mesh, vhandles, fhandles);
+
+  // Initialize subdivider
+  OpenMesh::Subdivider::Adaptive::CompositeT<MyMesh> subdivider(mesh);
+
+  subdivider.add<OpenMesh::Subdivider::Adaptive::Tvv3<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::VF<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::FF<MyMesh> >();
+  subdivider.add<OpenMesh::Subdivider::Adaptive::FVc<MyMesh> >();
+  subdivider.initialize();
+
+  // One vertex to level one gives the same mesh as refine(VertexHandle&)
+  subdivider.refine(std::vector<VHandle>(1, vhandles[4]), 1);
+
+  EXPECT_EQ(17u, mesh.n_vertices() ) << "Wrong number of vertices after batch subdivision with sqrt3";
+  EXPECT_EQ(24u, mesh.n_faces() )    << "Wrong number of faces after batch subdivision with sqrt3";
+  EXPECT_EQ(1, subdivider.level(vhandles[4]) ) << "Wrong level of the refined vertex";
+
+  std::vector<int> levels(vhandles.size(), 1);
+  levels[4] = 2;
+
+  subdivider.refine(vhandles, levels);
+
+  for (size_t i = 0; i < vhandles.size(); ++i)
+    EXPECT_LE(levels[i], subdivider.level(vhandles[i]) ) << "Vertex " << i << " not raised to its target level";
+
+  EXPECT_TRUE( OpenMesh::Utils::MeshCheckerT<MyMesh>(mesh).check() ) << "Inconsistent mesh after batch subdivision";
+}
 }
@@ -2,7 +2,10 @@
 #include <gtest/gtest.h>
 #include <Unittests/unittests_common.hh>
 #include <OpenMesh/Tools/Subdivider/Uniform/CatmullClarkT.hh>
+#include <OpenMesh/Tools/Subdivider/Uniform/LoopT.hh>
 #include <OpenMesh/Tools/Subdivider/Uniform/Sqrt3T.hh>
+#include <OpenMesh/Tools/Utils/MeshCheckerT.hh>
+#include <cmath>
 
 namespace {
 
@@ -46,6 +49,37 @@ class OpenMeshSubdividerUniform_Triangle : public OpenMeshBase {
     //Mesh mesh_;
 };
 
+/*
+ * Compute the stencils of _n steps, deform _control and check that the
+ * stencils give the same points as subdividing the deformed mesh again
+ */
+template <class MeshT, class Subdivider>
+void check_stencils(MeshT& _control, Subdivider& _subdivider, size_t _n) {
+
+  MeshT                                                       refined;
+  MeshT                                                       expected;
+  OpenMesh::Subdivider::Uniform::StencilTableT<float>         stencils;
+
+  ASSERT_TRUE( _subdivider.compute_stencils( _control, refined, stencils, _n ) ) << "Computing the stencils failed";
+
+  EXPECT_EQ(_control.n_vertices(), stencils.n_control() )  << "Wrong number of control vertices";
+  EXPECT_EQ(refined.n_vertices(),  stencils.n_stencils() ) << "Wrong number of stencils";
+
+  // Deform the control mesh
+  for (typename MeshT::VertexIter v_it = _control.vertices_begin(); v_it != _control.vertices_end(); ++v_it) {
+    typename MeshT::Point p = _control.point(*v_it);
+    _control.set_point(*v_it, typename MeshT::Point(p[0] * 2.0f, p[1] + p[0] * p[0], std::sin(p[0] + p[1])));
+  }
+
+  stencils.update_points(_control, refined);
+
+  ASSERT_TRUE( _subdivider( _control, expected, _n ) ) << "Out of place subdivision failed";
+  ASSERT_EQ(expected.n_vertices(), refined.n_vertices() ) << "Wrong number of vertices";
+
+  for (typename MeshT::VertexIter v_it = refined.vertices_begin(); v_it != refined.vertices_end(); ++v_it)
+    EXPECT_LT( (refined.point(*v_it) - expected.point(*v_it)).norm(), 1e-4 ) << "Wrong position of vertex " << v_it->idx();
+}
+
 /*
  * ====================================================================
  * Define tests below
@@ -244,4 +278,549 @@ TEST_F(OpenMeshSubdividerUniform_Poly, Subdivider_CatmullClark) {
   EXPECT_EQ(256u, mesh_.n_faces() )    << "Wrong number of faces after subdivision with catmull clark";
 
 }
+
+/*
+ * Out of place Loop subdivision has to give the same mesh as in place
+ */
+TEST_F(OpenMeshSubdividerUniform_Triangle, Subdivider_Loop_OutOfPlace) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  Mesh::VertexHandle vhandle[9];
+
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(0, 2, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[4] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[5] = mesh_.add_vertex(Mesh::Point(1, 2, 0));
+  vhandle[6] = mesh_.add_vertex(Mesh::Point(2, 0, 0));
+  vhandle[7] = mesh_.add_vertex(Mesh::Point(2, 1, 0));
+  vhandle[8] = mesh_.add_vertex(Mesh::Point(2, 2, 0));
+
+  // Add eight faces
+  std::vector<Mesh::VertexHandle> face_vhandles;
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[3]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[7]);
+  face_vhandles.push_back(vhandle[6]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[8]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[8]);
+
+  mesh_.add_face(face_vhandles);
+
+  // Test setup:
+  //  6 === 7 === 8
+  //  |   / |   / |
+  //  |  /  |  /  |
+  //  | /   | /   |
+  //  3 === 4 === 5
+  //  |   / | \   |
+  //  |  /  |  \  |
+  //  | /   |   \ |
+  //  0 === 1 === 2
+
+  Mesh reference(mesh_);
+  Mesh result;
+
+  // Initialize subdivider
+  OpenMesh::Subdivider::Uniform::LoopT<Mesh> loop;
+
+  // Execute 2 subdivision steps in place
+  loop.attach(reference);
+  loop( 2 );
+  loop.detach();
+
+  // Execute 2 subdivision steps out of place
+  EXPECT_TRUE( loop( mesh_, result, 2u ) ) << "Out of place subdivision failed";
+
+  EXPECT_EQ(9u, mesh_.n_vertices() ) << "Source mesh was modified";
+
+  EXPECT_TRUE( OpenMesh::Utils::MeshCheckerT<Mesh>(result).check() ) << "Inconsistent mesh after out of place subdivision with loop";
+
+  EXPECT_EQ(reference.n_vertices(), result.n_vertices() ) << "Wrong number of vertices after out of place subdivision with loop";
+  EXPECT_EQ(reference.n_edges(),    result.n_edges() )    << "Wrong number of edges after out of place subdivision with loop";
+  EXPECT_EQ(reference.n_faces(),    result.n_faces() )    << "Wrong number of faces after out of place subdivision with loop";
+
+  // The edges are numbered differently after the first step, so the
+  // vertices of later steps are matched by their position
+  for (Mesh::VertexIter v_it = result.vertices_begin(); v_it != result.vertices_end(); ++v_it) {
+    Mesh::VertexHandle match;
+    for (Mesh::VertexIter r_it = reference.vertices_begin(); r_it != reference.vertices_end(); ++r_it)
+      if ( (result.point(*v_it) - reference.point(*r_it)).norm() < 1e-5 )
+        match = *r_it;
+
+    ASSERT_TRUE( match.is_valid() ) << "Wrong position of vertex " << v_it->idx();
+    EXPECT_EQ( reference.valence(match), result.valence(*v_it) ) << "Wrong valence of vertex " << v_it->idx();
+    EXPECT_EQ( reference.is_boundary(match), result.is_boundary(*v_it) ) << "Wrong boundary flag of vertex " << v_it->idx();
+  }
+
+  for (Mesh::FaceIter f_it = result.faces_begin(); f_it != result.faces_end(); ++f_it)
+    EXPECT_EQ( 3u, result.valence(*f_it) ) << "Face " << f_it->idx() << " is not a triangle";
+}
+
+/*
+ * Out of place sqrt3 subdivision, the vertex numbering differs from the
+ * in place version, so only the element counts and the boundary are compared
+ */
+TEST_F(OpenMeshSubdividerUniform_Triangle, Subdivider_Sqrt3_OutOfPlace) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  Mesh::VertexHandle vhandle[9];
+
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(0, 2, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[4] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[5] = mesh_.add_vertex(Mesh::Point(1, 2, 0));
+  vhandle[6] = mesh_.add_vertex(Mesh::Point(2, 0, 0));
+  vhandle[7] = mesh_.add_vertex(Mesh::Point(2, 1, 0));
+  vhandle[8] = mesh_.add_vertex(Mesh::Point(2, 2, 0));
+
+  // Add eight faces
+  std::vector<Mesh::VertexHandle> face_vhandles;
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[3]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[7]);
+  face_vhandles.push_back(vhandle[6]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[8]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[8]);
+
+  mesh_.add_face(face_vhandles);
+
+  // Test setup:
+  //  6 === 7 === 8
+  //  |   / |   / |
+  //  |  /  |  /  |
+  //  | /   | /   |
+  //  3 === 4 === 5
+  //  |   / | \   |
+  //  |  /  |  \  |
+  //  | /   |   \ |
+  //  0 === 1 === 2
+
+  Mesh result;
+
+  // Initialize subdivider
+  OpenMesh::Subdivider::Uniform::Sqrt3T<Mesh> sqrt3;
+
+  // Execute 3 subdivision steps out of place
+  EXPECT_TRUE( sqrt3( mesh_, result, 3u ) ) << "Out of place subdivision failed";
+
+  EXPECT_TRUE( OpenMesh::Utils::MeshCheckerT<Mesh>(result).check() ) << "Inconsistent mesh after out of place subdivision with sqrt3";
+
+  EXPECT_EQ(121u, result.n_vertices() ) << "Wrong number of vertices after out of place subdivision with sqrt3";
+  EXPECT_EQ(216u, result.n_faces() )    << "Wrong number of faces after out of place subdivision with sqrt3";
+
+  size_t boundary_vertices = 0;
+  for (Mesh::VertexIter v_it = result.vertices_begin(); v_it != result.vertices_end(); ++v_it)
+    if ( result.is_boundary(*v_it) )
+      ++boundary_vertices;
+
+  // 8 boundary edges, each split into three in the odd generation
+  EXPECT_EQ(24u, boundary_vertices ) << "Wrong number of boundary vertices after out of place subdivision with sqrt3";
+}
+
+/*
+ * Out of place Catmull-Clark subdivision has to give the same mesh as in place
+ */
+TEST_F(OpenMeshSubdividerUniform_Poly, Subdivider_CatmullClark_OutOfPlace) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  PolyMesh::VertexHandle vhandle[9];
+
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      vhandle[3*i+j] = mesh_.add_vertex(PolyMesh::Point(i, j, 0));
+
+  // Add four faces
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 2; ++j)
+      mesh_.add_face(vhandle[3*i+j], vhandle[3*i+j+1], vhandle[3*i+j+4], vhandle[3*i+j+3]);
+
+  // Test setup:
+  //  6 === 7 === 8
+  //  |     |     |
+  //  3 === 4 === 5
+  //  |     |     |
+  //  0 === 1 === 2
+
+  PolyMesh reference(mesh_);
+  PolyMesh result;
+
+  // Initialize subdivider
+  OpenMesh::Subdivider::Uniform::CatmullClarkT<PolyMesh> catmull;
+
+  // Execute 3 subdivision steps in place
+  catmull.attach(reference);
+  catmull( 3 );
+  catmull.detach();
+
+  // Execute 3 subdivision steps out of place
+  EXPECT_TRUE( catmull( mesh_, result, 3u ) ) << "Out of place subdivision failed";
+
+  EXPECT_EQ(9u, mesh_.n_vertices() ) << "Source mesh was modified";
+
+  EXPECT_TRUE( OpenMesh::Utils::MeshCheckerT<PolyMesh>(result).check() ) << "Inconsistent mesh after out of place subdivision with catmull clark";
+
+  EXPECT_EQ(289u, result.n_vertices() ) << "Wrong number of vertices after out of place subdivision with catmull clark";
+  EXPECT_EQ(544u, result.n_edges() )    << "Wrong number of edges after out of place subdivision with catmull clark";
+  EXPECT_EQ(256u, result.n_faces() )    << "Wrong number of faces after out of place subdivision with catmull clark";
+
+  // The edges are numbered differently after the first step, so the
+  // vertices of later steps are matched by their position
+  for (PolyMesh::VertexIter v_it = result.vertices_begin(); v_it != result.vertices_end(); ++v_it) {
+    PolyMesh::VertexHandle match;
+    for (PolyMesh::VertexIter r_it = reference.vertices_begin(); r_it != reference.vertices_end(); ++r_it)
+      if ( (result.point(*v_it) - reference.point(*r_it)).norm() < 1e-5 )
+        match = *r_it;
+
+    ASSERT_TRUE( match.is_valid() ) << "Wrong position of vertex " << v_it->idx();
+    EXPECT_EQ( reference.valence(match), result.valence(*v_it) ) << "Wrong valence of vertex " << v_it->idx();
+    EXPECT_EQ( reference.is_boundary(match), result.is_boundary(*v_it) ) << "Wrong boundary flag of vertex " << v_it->idx();
+  }
+
+  for (PolyMesh::FaceIter f_it = result.faces_begin(); f_it != result.faces_end(); ++f_it)
+    EXPECT_EQ( 4u, result.valence(*f_it) ) << "Face " << f_it->idx() << " is not a quad";
+}
+
+/*
+ * Stencils of Loop subdivision
+ */
+TEST_F(OpenMeshSubdividerUniform_Triangle, Subdivider_Loop_Stencils) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  Mesh::VertexHandle vhandle[9];
+
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(0, 2, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[4] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[5] = mesh_.add_vertex(Mesh::Point(1, 2, 0));
+  vhandle[6] = mesh_.add_vertex(Mesh::Point(2, 0, 0));
+  vhandle[7] = mesh_.add_vertex(Mesh::Point(2, 1, 0));
+  vhandle[8] = mesh_.add_vertex(Mesh::Point(2, 2, 0));
+
+  // Add eight faces
+  std::vector<Mesh::VertexHandle> face_vhandles;
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[3]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[7]);
+  face_vhandles.push_back(vhandle[6]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[8]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[8]);
+
+  mesh_.add_face(face_vhandles);
+
+  // Test setup:
+  //  6 === 7 === 8
+  //  |   / |   / |
+  //  |  /  |  /  |
+  //  | /   | /   |
+  //  3 === 4 === 5
+  //  |   / | \   |
+  //  |  /  |  \  |
+  //  | /   |   \ |
+  //  0 === 1 === 2
+
+  OpenMesh::Subdivider::Uniform::LoopT<Mesh> loop;
+
+  check_stencils(mesh_, loop, 3);
+}
+
+/*
+ * Stencils of sqrt3 subdivision, with even and odd steps
+ */
+TEST_F(OpenMeshSubdividerUniform_Triangle, Subdivider_Sqrt3_Stencils) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  Mesh::VertexHandle vhandle[9];
+
+  vhandle[0] = mesh_.add_vertex(Mesh::Point(0, 0, 0));
+  vhandle[1] = mesh_.add_vertex(Mesh::Point(0, 1, 0));
+  vhandle[2] = mesh_.add_vertex(Mesh::Point(0, 2, 0));
+  vhandle[3] = mesh_.add_vertex(Mesh::Point(1, 0, 0));
+  vhandle[4] = mesh_.add_vertex(Mesh::Point(1, 1, 0));
+  vhandle[5] = mesh_.add_vertex(Mesh::Point(1, 2, 0));
+  vhandle[6] = mesh_.add_vertex(Mesh::Point(2, 0, 0));
+  vhandle[7] = mesh_.add_vertex(Mesh::Point(2, 1, 0));
+  vhandle[8] = mesh_.add_vertex(Mesh::Point(2, 2, 0));
+
+  // Add eight faces
+  std::vector<Mesh::VertexHandle> face_vhandles;
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[3]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[0]);
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[1]);
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[2]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[4]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[7]);
+  face_vhandles.push_back(vhandle[6]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[3]);
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[8]);
+  face_vhandles.push_back(vhandle[7]);
+
+  mesh_.add_face(face_vhandles);
+  face_vhandles.clear();
+
+  face_vhandles.push_back(vhandle[4]);
+  face_vhandles.push_back(vhandle[5]);
+  face_vhandles.push_back(vhandle[8]);
+
+  mesh_.add_face(face_vhandles);
+
+  // Test setup:
+  //  6 === 7 === 8
+  //  |   / |   / |
+  //  |  /  |  /  |
+  //  | /   | /   |
+  //  3 === 4 === 5
+  //  |   / | \   |
+  //  |  /  |  \  |
+  //  | /   |   \ |
+  //  0 === 1 === 2
+
+  OpenMesh::Subdivider::Uniform::Sqrt3T<Mesh> sqrt3;
+
+  check_stencils(mesh_, sqrt3, 3);
+}
+
+/*
+ * Stencils of Catmull-Clark subdivision
+ */
+TEST_F(OpenMeshSubdividerUniform_Poly, Subdivider_CatmullClark_Stencils) {
+
+  mesh_.clear();
+
+  // Add some vertices
+  PolyMesh::VertexHandle vhandle[9];
+
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      vhandle[3*i+j] = mesh_.add_vertex(PolyMesh::Point(i, j, 0));
+
+  // Add three quads and two triangles
+  mesh_.add_face(vhandle[0], vhandle[1], vhandle[4], vhandle[3]);
+  mesh_.add_face(vhandle[1], vhandle[2], vhandle[5], vhandle[4]);
+  mesh_.add_face(vhandle[3], vhandle[4], vhandle[7], vhandle[6]);
+  mesh_.add_face(vhandle[4], vhandle[5], vhandle[8]);
+  mesh_.add_face(vhandle[4], vhandle[8], vhandle[7]);
+
+  OpenMesh::Subdivider::Uniform::CatmullClarkT<PolyMesh> catmull;
+
+  check_stencils(mesh_, catmull, 3);
+}
+/*
+ * An empty stencil evaluates to the zero vector, the old contents of the
+ * refined points are overwritten
+ */
+TEST_F(OpenMeshSubdividerUniform_Triangle, Subdivider_Stencils_Empty) {
+
+  typedef OpenMesh::Subdivider::Uniform::StencilTableT<float> Table;
+
+  std::vector<Table::Stencil> stencils(2);
+  stencils[0].push_back(Table::Entry(0, 0.5f));
+  stencils[0].push_back(Table::Entry(1, 0.5f));
+
+  Table table;
+  table.set(2, stencils);
+
+  std::vector<Mesh::Point> control;
+  control.push_back(Mesh::Point(0, 0, 0));
+  control.push_back(Mesh::Point(2, 4, 6));
+
+  std::vector<Mesh::Point> refined(2, Mesh::Point(7, 7, 7));
+  table.apply(control, refined);
+
+  EXPECT_EQ(Mesh::Point(1, 2, 3), refined[0]) << "Wrong point of the first stencil";
+  EXPECT_EQ(Mesh::Point(0, 0, 0), refined[1]) << "Empty stencil did not give the zero vector";
+}
+
 }
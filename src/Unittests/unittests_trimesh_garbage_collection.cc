@@ -485,4 +485,132 @@ TEST_F(OpenMeshTriMeshGarbageCollection, TrackedGarbageCollection) {
 }
 
 
+/* Builds a triangulated 5x5 vertex grid, tags every element with its original
+ * index and checks the remap tables returned by garbage collection, both for
+ * the classic and the order preserving compaction
+ */
+static void fill_grid(Mesh& _mesh)
+{
+  _mesh.clear();
+
+  _mesh.request_vertex_status();
+  _mesh.request_edge_status();
+  _mesh.request_halfedge_status();
+  _mesh.request_face_status();
+
+  const int n = 5;
+  std::vector<Mesh::VertexHandle> vhandle;
+  for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i)
+      vhandle.push_back(_mesh.add_vertex(Mesh::Point(float(i), float(j), 0)));
+
+  for (int j = 0; j < n-1; ++j)
+    for (int i = 0; i < n-1; ++i)
+    {
+      const int v = j*n + i;
+      _mesh.add_face(vhandle[v], vhandle[v+1], vhandle[v+n+1]);
+      _mesh.add_face(vhandle[v], vhandle[v+n+1], vhandle[v+n]);
+    }
+}
+
+static void check_remap(Mesh& _mesh, bool _preserve_order)
+{
+  OpenMesh::VPropHandleT<int> vidx;
+  OpenMesh::HPropHandleT<int> hidx;
+  OpenMesh::FPropHandleT<int> fidx;
+  _mesh.add_property(vidx);
+  _mesh.add_property(hidx);
+  _mesh.add_property(fidx);
+
+  for (Mesh::VertexIter v_it = _mesh.vertices_begin(); v_it != _mesh.vertices_end(); ++v_it)
+    _mesh.property(vidx, *v_it) = v_it->idx();
+  for (Mesh::HalfedgeIter h_it = _mesh.halfedges_begin(); h_it != _mesh.halfedges_end(); ++h_it)
+    _mesh.property(hidx, *h_it) = h_it->idx();
+  for (Mesh::FaceIter f_it = _mesh.faces_begin(); f_it != _mesh.faces_end(); ++f_it)
+    _mesh.property(fidx, *f_it) = f_it->idx();
+
+  const size_t nV = _mesh.n_vertices();
+  const size_t nH = _mesh.n_halfedges();
+  const size_t nF = _mesh.n_faces();
+
+  // Inner vertices 6, 12 and 18 on the diagonal, which also
+  // deletes the then isolated corners 0 and 24
+  _mesh.delete_vertex(Mesh::VertexHandle(6));
+  _mesh.delete_vertex(Mesh::VertexHandle(12));
+  _mesh.delete_vertex(Mesh::VertexHandle(18));
+
+  std::vector<Mesh::VertexHandle>   vh_map;
+  std::vector<Mesh::HalfedgeHandle> hh_map;
+  std::vector<Mesh::FaceHandle>     fh_map;
+  _mesh.garbage_collection(&vh_map, &hh_map, &fh_map, _preserve_order);
+
+  EXPECT_EQ(20u, _mesh.n_vertices() ) << "Wrong number of vertices after garbage collection";
+  ASSERT_EQ(nV, vh_map.size() )       << "Wrong size of the vertex map";
+  ASSERT_EQ(nH, hh_map.size() )       << "Wrong size of the halfedge map";
+  ASSERT_EQ(nF, fh_map.size() )       << "Wrong size of the face map";
+
+  size_t n_kept = 0;
+  for (size_t i = 0; i < vh_map.size(); ++i)
+  {
+    if (!vh_map[i].is_valid())
+      continue;
+    ++n_kept;
+    EXPECT_EQ(int(i), _mesh.property(vidx, vh_map[i]) ) << "Wrong vertex map entry";
+  }
+  EXPECT_EQ(_mesh.n_vertices(), n_kept) << "Wrong number of mapped vertices";
+  EXPECT_FALSE(vh_map[6].is_valid() )   << "Deleted vertex should map to an invalid handle";
+
+  n_kept = 0;
+  for (size_t i = 0; i < hh_map.size(); ++i)
+  {
+    if (!hh_map[i].is_valid())
+      continue;
+    ++n_kept;
+    EXPECT_EQ(int(i), _mesh.property(hidx, hh_map[i]) ) << "Wrong halfedge map entry";
+  }
+  EXPECT_EQ(_mesh.n_halfedges(), n_kept) << "Wrong number of mapped halfedges";
+
+  n_kept = 0;
+  for (size_t i = 0; i < fh_map.size(); ++i)
+  {
+    if (!fh_map[i].is_valid())
+      continue;
+    ++n_kept;
+    EXPECT_EQ(int(i), _mesh.property(fidx, fh_map[i]) ) << "Wrong face map entry";
+  }
+  EXPECT_EQ(_mesh.n_faces(), n_kept) << "Wrong number of mapped faces";
+
+  if (_preserve_order)
+  {
+    for (size_t i = 1; i < _mesh.n_vertices(); ++i)
+      EXPECT_LT(_mesh.property(vidx, Mesh::VertexHandle(int(i-1))), _mesh.property(vidx, Mesh::VertexHandle(int(i))) ) << "Vertex order not preserved";
+    for (size_t i = 1; i < _mesh.n_faces(); ++i)
+      EXPECT_LT(_mesh.property(fidx, Mesh::FaceHandle(int(i-1))), _mesh.property(fidx, Mesh::FaceHandle(int(i))) ) << "Face order not preserved";
+  }
+
+  // Connectivity has to be consistent with the compacted arrays
+  for (Mesh::HalfedgeIter h_it = _mesh.halfedges_begin(); h_it != _mesh.halfedges_end(); ++h_it)
+  {
+    EXPECT_TRUE(_mesh.is_valid_handle(_mesh.to_vertex_handle(*h_it)) )       << "Invalid vertex handle";
+    EXPECT_EQ(*h_it, _mesh.prev_halfedge_handle(_mesh.next_halfedge_handle(*h_it)) ) << "Broken next/prev link";
+    EXPECT_EQ(_mesh.face_handle(*h_it), _mesh.face_handle(_mesh.next_halfedge_handle(*h_it)) ) << "Broken face link";
+  }
+  for (Mesh::FaceIter f_it = _mesh.faces_begin(); f_it != _mesh.faces_end(); ++f_it)
+    EXPECT_EQ(*f_it, _mesh.face_handle(_mesh.halfedge_handle(*f_it)) ) << "Broken face halfedge";
+  for (Mesh::VertexIter v_it = _mesh.vertices_begin(); v_it != _mesh.vertices_end(); ++v_it)
+    EXPECT_EQ(*v_it, _mesh.from_vertex_handle(_mesh.halfedge_handle(*v_it)) ) << "Broken vertex halfedge";
+}
+
+TEST_F(OpenMeshTriMeshGarbageCollection, GarbageCollectionRemapTables) {
+
+  fill_grid(mesh_);
+  check_remap(mesh_, false);
+}
+
+TEST_F(OpenMeshTriMeshGarbageCollection, GarbageCollectionPreserveOrder) {
+
+  fill_grid(mesh_);
+  check_remap(mesh_, true);
+}
+
 }
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <Unittests/unittests_common.hh>
+#include <OpenMesh/Core/Utils/VertexWelderT.hh>
+
+#include <vector>
+
+namespace {
+
+class OpenMeshVertexWelder : public testing::Test {
+
+    protected:
+
+        // This function is called before each test is run
+        virtual void SetUp() {
+
+            // Do some initial stuff with the member data here...
+        }
+
+        // This function is called after all tests are through
+        virtual void TearDown() {
+
+            // Do some final stuff with the member data here...
+        }
+};
+
+typedef OpenMesh::VertexWelderT<OpenMesh::Vec3f> Welder;
+
+/*
+ * ====================================================================
+ * Define tests below
+ * ====================================================================
+ */
+
+/*
+ * Equal points are merged, vertices are numbered by first occurrence
+ */
+TEST_F(OpenMeshVertexWelder, WeldExact) {
+
+    std::vector<OpenMesh::Vec3f> points;
+    points.push_back(OpenMesh::Vec3f(1.0f, 2.0f, 3.0f));
+    points.push_back(OpenMesh::Vec3f(0.0f, 0.0f, 0.0f));
+    points.push_back(OpenMesh::Vec3f(1.0f, 2.0f, 3.0f));
+    points.push_back(OpenMesh::Vec3f(-0.0f, 0.0f, -0.0f));
+    points.push_back(OpenMesh::Vec3f(1.0f, 2.0f, 3.0001f));
+
+    std::vector<int> map;
+    size_t n = Welder().weld(points, map);
+
+    EXPECT_EQ(3u, n) << "Wrong number of vertices";
+    ASSERT_EQ(5u, map.size()) << "Wrong size of the map";
+    EXPECT_EQ(0, map[0]);
+    EXPECT_EQ(1, map[1]);
+    EXPECT_EQ(0, map[2]) << "Equal points not merged";
+    EXPECT_EQ(1, map[3]) << "-0 and +0 not merged";
+    EXPECT_EQ(2, map[4]) << "Different points merged";
+}
+
+/*
+ * Points closer than epsilon are merged, also across cell borders
+ */
+TEST_F(OpenMeshVertexWelder, WeldEpsilon) {
+
+    std::vector<OpenMesh::Vec3f> points;
+    points.push_back(OpenMesh::Vec3f(0.0f, 0.0f, 0.0f));
+    points.push_back(OpenMesh::Vec3f(0.0f, 0.0f, 0.001f));
+    points.push_back(OpenMesh::Vec3f(-0.0005f, 0.0005f, 0.0f));
+    points.push_back(OpenMesh::Vec3f(0.0f, 0.0f, 0.1f));
+
+    std::vector<int> map;
+
+    EXPECT_EQ(4u, Welder(0.0001f).weld(points, map)) << "Wrong number of vertices for small epsilon";
+
+    size_t n = Welder(0.01f).weld(points, map);
+
+    EXPECT_EQ(2u, n) << "Wrong number of vertices";
+    ASSERT_EQ(4u, map.size()) << "Wrong size of the map";
+    EXPECT_EQ(0, map[0]);
+    EXPECT_EQ(0, map[1]) << "Close points not merged";
+    EXPECT_EQ(0, map[2]) << "Close points in neighbour cells not merged";
+    EXPECT_EQ(1, map[3]) << "Distant points merged";
+}
+
+/*
+ * The result must not depend on the number of threads
+ */
+TEST_F(OpenMeshVertexWelder, WeldThreadsIndependent) {
+
+    // corners of a 100x100x10 grid, every point three times
+    std::vector<OpenMesh::Vec3f> points;
+    for (int k = 0; k < 3; ++k)
+      for (int x = 0; x < 100; ++x)
+        for (int y = 0; y < 100; ++y)
+          for (int z = 0; z < 10; ++z)
+            points.push_back(OpenMesh::Vec3f(x * 0.5f, y * 0.5f + k * 0.001f, z * 0.5f));
+
+    std::vector<int> map_single, map_multi;
+
+    Welder welder;
+
+    EXPECT_EQ(300000u, welder.weld(points, map_single, 1)) << "Wrong number of vertices in exact mode";
+
+    welder.set_epsilon(0.01f);
+
+    size_t n_single = welder.weld(points, map_single, 1);
+    size_t n_multi  = welder.weld(points, map_multi, 4);
+
+    EXPECT_EQ(100000u, n_single) << "Wrong number of vertices in epsilon mode";
+    EXPECT_EQ(n_single, n_multi) << "Number of vertices depends on the number of threads";
+    EXPECT_TRUE(map_single == map_multi) << "Map depends on the number of threads";
+}
+
+/*
+ * Welding one point at a time matches weld() in exact mode and merges
+ * close points with the first point of a vertex in epsilon mode
+ */
+TEST_F(OpenMeshVertexWelder, WeldIncremental) {
+
+    std::vector<OpenMesh::Vec3f> points;
+    for (int k = 0; k < 3; ++k)
+      for (int x = 0; x < 20; ++x)
+        for (int y = 0; y < 20; ++y)
+          points.push_back(OpenMesh::Vec3f(x * 0.5f, y * 0.5f + k * 0.001f, (x + y) % 2 ? -0.0f : 0.0f));
+
+    std::vector<int> map;
+    Welder welder;
+    EXPECT_EQ(1200u, welder.weld(points, map)) << "Wrong number of vertices in exact mode";
+
+    bool wrong = false;
+    for (size_t i = 0; i < points.size() && !wrong; ++i)
+      wrong = (welder.add(points[i]) != map[i]);
+    EXPECT_FALSE(wrong) << "add() differs from weld() in exact mode";
+    EXPECT_EQ(1200u, welder.n_vertices()) << "Wrong number of vertices after add()";
+
+    Welder close(0.01f);
+    wrong = false;
+    for (size_t i = 0; i < points.size() && !wrong; ++i)
+      wrong = (close.add(points[i]) != int(i % 400));
+    EXPECT_FALSE(wrong) << "Close points not merged with the first point of their vertex";
+    EXPECT_EQ(400u, close.n_vertices()) << "Wrong number of vertices in epsilon mode";
+
+    close.clear();
+    EXPECT_EQ(0u, close.n_vertices()) << "Vertices not cleared";
+    EXPECT_EQ(0, close.add(points[1])) << "Wrong vertex number after clear()";
+}
+
+}